@@ -11,6 +11,8 @@
 
 #include <C++Kit/Defines.hpp>
 
+#include <vector>
+
 // @brief NewCPU backend for C++ Kit a RISC architecture.
 // It aims to be as simple as the Motorola 68k
 // @file Arch/NewCPU.hpp
@@ -53,8 +55,22 @@ inline std::vector<NCOpcode> kOpcodesStd = {
         kAsmOpcodeDecl("stw", 0b0100011, 0b100, kAsmImmediate)
         kAsmOpcodeDecl("ldw", 0b0000011, 0b100, kAsmImmediate)
         kAsmOpcodeDecl("lda", 0b0000011, 0b101, kAsmImmediate)
+        kAsmOpcodeDecl("ldb", 0b0000011, 0b000, kAsmImmediate) // load byte
+        kAsmOpcodeDecl("stb", 0b0100011, 0b001, kAsmImmediate) // store byte
         kAsmOpcodeDecl("add", 0b0101011, 0b100, kAsmImmediate)
         kAsmOpcodeDecl("dec", 0b0101011, 0b101, kAsmImmediate)
+        // arithmetic and logic, the left register is also the destination.
+        kAsmOpcodeDecl("sub", 0b0110011, 0b000, kAsmRegToReg)
+        kAsmOpcodeDecl("mul", 0b0110011, 0b001, kAsmRegToReg)
+        kAsmOpcodeDecl("div", 0b0110011, 0b010, kAsmRegToReg)
+        kAsmOpcodeDecl("mod", 0b0110011, 0b011, kAsmRegToReg)
+        kAsmOpcodeDecl("and", 0b0110011, 0b100, kAsmRegToReg)
+        kAsmOpcodeDecl("or", 0b0110011, 0b101, kAsmRegToReg)
+        kAsmOpcodeDecl("xor", 0b0110011, 0b110, kAsmRegToReg)
+        kAsmOpcodeDecl("shl", 0b0110011, 0b111, kAsmRegToReg)
+        kAsmOpcodeDecl("shr", 0b0111011, 0b000, kAsmRegToReg)
+        kAsmOpcodeDecl("neg", 0b0111011, 0b001, kAsmImmediate)
+        kAsmOpcodeDecl("not", 0b0111011, 0b010, kAsmImmediate)
         kAsmOpcodeDecl("scall", 0b1110011, 0b00, kAsmSyscall)
         kAsmOpcodeDecl("sbreak", 0b1110011, 0b01, kAsmSyscall)
         // Machine halt
@@ -68,6 +84,7 @@ inline std::vector<NCOpcode> kOpcodesStd = {
 
 #define kAsmRegisterPrefix "r"
 #define kAsmRegisterLimit  35
+#define kAsmZeroRegister   0
 #define kAsmPcRegister     33
 #define kAsmCrRegister     34
 #define kAsmSpRegister     32
@@ -75,6 +92,33 @@ inline std::vector<NCOpcode> kOpcodesStd = {
 
 /////////////////////////////////////////////////////////////////////////////
 
+// CALLING CONVENTION
+
+// The first kAsmArgRegisterCount arguments go in r17..r22, left to right.
+// The rest are pushed right to left, so that the seventh argument sits
+// right above the return address 'jlr' pushes, and the caller drops them
+// once the call returns. The result comes back in r31.
+
+// r9..r14 are callee saved, a function that writes one of them puts it
+// back before 'jrl'. r1..r8, r15, r16, the argument registers, r23..r30
+// and r31 are caller saved, a value living in one of them across a call is
+// saved by the caller around that call. Code generators leave r23..r30 to
+// leaf functions, which call nothing and so never have to save them.
+//
+// A call in tail position may tear its caller's frame down and 'jb' to the
+// callee instead, which then returns straight to the caller's caller.
+
+/////////////////////////////////////////////////////////////////////////////
+
+#define kAsmArgRegister       17
+#define kAsmArgRegisterCount  6
+#define kAsmCalleeSavedFirst  9
+#define kAsmCalleeSavedLast   14
+#define kAsmLeafFirst         23
+#define kAsmLeafLast          30
+
+/////////////////////////////////////////////////////////////////////////////
+
 // SYSTEM CALL ADDRESSING
 
 // | OPCODE | FUNCT3 | FUNCT7 | OFF                 |
@@ -0,0 +1,1239 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#include <AsmKit/IR.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+//! @file IR.cpp
+//! @brief NewCPU intermediate representation, linear scan register allocation.
+
+namespace CxxKit
+{
+	void IRFunction::Label(const std::string& label)
+	{
+		fCode.push_back({ .fOpcode = kIRLabel, .fSymbol = label });
+	}
+
+	void IRFunction::Move(Int32 dst, Int32 src)
+	{
+		fCode.push_back({ .fOpcode = kIRMove, .fDst = dst, .fSrc = src });
+	}
+
+	void IRFunction::Constant(Int32 dst, Int64 value)
+	{
+		fCode.push_back({ .fOpcode = kIRConstant, .fDst = dst, .fImm = value });
+	}
+
+	void IRFunction::Address(Int32 dst, const std::string& symbol)
+	{
+		fCode.push_back({ .fOpcode = kIRAddress, .fDst = dst, .fSymbol = symbol });
+	}
+
+	void IRFunction::FrameAddress(Int32 dst, Int32 base, Int64 offset)
+	{
+		fCode.push_back({ .fOpcode = kIRFrameAddress, .fDst = dst, .fSrc = base, .fImm = offset });
+	}
+
+	void IRFunction::Load(Int32 dst, Int32 base, Int64 offset, Int32 width)
+	{
+		fCode.push_back({ .fOpcode = kIRLoad, .fDst = dst, .fSrc = base, .fImm = offset, .fWidth = width });
+	}
+
+	void IRFunction::Store(Int32 src, Int32 base, Int64 offset, Int32 width)
+	{
+		fCode.push_back({ .fOpcode = kIRStore, .fSrc = src, .fSrc2 = base, .fImm = offset, .fWidth = width });
+	}
+
+	void IRFunction::Arith(const std::string& mnemonic, Int32 dst, Int32 lhs, Int32 rhs)
+	{
+		fCode.push_back({ .fOpcode = kIRArith, .fMnemonic = mnemonic, .fDst = dst, .fSrc = lhs, .fSrc2 = rhs });
+	}
+
+	void IRFunction::ArithImm(Int32 dst, Int32 src, Int64 value)
+	{
+		fCode.push_back({ .fOpcode = kIRArithImm, .fMnemonic = "add", .fDst = dst, .fSrc = src, .fImm = value });
+	}
+
+	void IRFunction::Unary(const std::string& mnemonic, Int32 dst, Int32 src)
+	{
+		fCode.push_back({ .fOpcode = kIRUnary, .fMnemonic = mnemonic, .fDst = dst, .fSrc = src });
+	}
+
+	void IRFunction::Branch(const std::string& mnemonic, Int32 lhs, Int32 rhs, const std::string& label)
+	{
+		fCode.push_back({ .fOpcode = kIRBranch, .fMnemonic = mnemonic, .fSrc = lhs, .fSrc2 = rhs, .fSymbol = label });
+	}
+
+	void IRFunction::Jump(const std::string& label)
+	{
+		fCode.push_back({ .fOpcode = kIRJump, .fSymbol = label });
+	}
+
+	void IRFunction::JumpTable(Int32 target, const std::string& table, std::vector<std::string> labels)
+	{
+		fCode.push_back({ .fOpcode = kIRJumpTable, .fSrc = target, .fSymbol = table, .fTargets = std::move(labels) });
+	}
+
+	void IRFunction::Push(Int32 src)
+	{
+		fCode.push_back({ .fOpcode = kIRPush, .fSrc = src });
+	}
+
+	void IRFunction::Drop(Int64 bytes)
+	{
+		if (bytes > 0)
+			fCode.push_back({ .fOpcode = kIRDrop, .fImm = bytes });
+	}
+
+	void IRFunction::CallBegin()
+	{
+		fCode.push_back({ .fOpcode = kIRCallBegin, .fImm = (Int64)fSaved.size() });
+		fSaved.emplace_back();
+	}
+
+	void IRFunction::Call(const std::string& symbol, Int32 target)
+	{
+		fCode.push_back({ .fOpcode = kIRCall, .fSrc = target, .fSymbol = symbol });
+	}
+
+	void IRFunction::CallEnd()
+	{
+		Int64 depth = 0;
+
+		// pair with the innermost open call sequence.
+		for (auto it = fCode.rbegin(); it != fCode.rend(); ++it)
+		{
+			if (it->fOpcode == kIRCallEnd)
+				++depth;
+
+			if (it->fOpcode == kIRCallBegin &&
+				depth-- == 0)
+			{
+				fCode.push_back({ .fOpcode = kIRCallEnd, .fImm = it->fImm });
+				return;
+			}
+		}
+	}
+
+	void IRFunction::Return()
+	{
+		fCode.push_back({ .fOpcode = kIRReturn });
+	}
+
+	void IRFunction::Local(Int64 offset, SizeType size)
+	{
+		fLocals.emplace_back(offset, size);
+	}
+
+	SizeType IRFunction::Cost() const
+	{
+		return std::count_if(fCode.begin(), fCode.end(), [](const IRInstr& instr) {
+			return instr.fOpcode != kIRNop &&
+				instr.fOpcode != kIRLabel &&
+				instr.fOpcode != kIRCallBegin &&
+				instr.fOpcode != kIRCallEnd;
+		});
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Inline
+	// @brief Put a copy of callee in place of a call sequence.
+	// The callee gets fresh registers, labels and call sequences, its locals go
+	// after ours, what it reads from the argument registers is read from the
+	// values that were to be moved there, and what it writes to the return
+	// register goes in a register of its own, which the caller then reads instead.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool IRFunction::Inline(SizeType call, const IRFunction& callee)
+	{
+		if (call >= fCode.size() ||
+			fCode[call].fOpcode != kIRCall ||
+			fCode[call].fSymbol.empty())
+			return false;
+
+		// arguments on the stack leave a drop between the call and its end.
+		auto end = call + 1;
+
+		if (end >= fCode.size() ||
+			fCode[end].fOpcode != kIRCallEnd)
+			return false;
+
+		auto begin = call;
+
+		for (Int64 depth = 0; begin-- > 0;)
+		{
+			if (fCode[begin].fOpcode == kIRCallEnd)
+				++depth;
+
+			if (fCode[begin].fOpcode == kIRCallBegin &&
+				depth-- == 0)
+				break;
+		}
+
+		if (begin >= call ||
+			fCode[begin].fImm != fCode[end].fImm)
+			return false;
+
+		// the callee must not look for arguments on the stack either,
+		// nor have a jump table, whose labels would need a table of their own.
+		for (auto& instr : callee.fCode)
+		{
+			if (instr.fSrc == kIRArgRegister ||
+				instr.fSrc2 == kIRArgRegister ||
+				instr.fOpcode == kIRJumpTable)
+				return false;
+		}
+
+		std::vector<Int32> args(kAsmArgRegisterCount, kIRNoRegister);
+
+		for (auto at = call; at-- > begin + 1;)
+		{
+			auto& instr = fCode[at];
+
+			if (instr.fOpcode != kIRMove ||
+				instr.fDst < kAsmArgRegister ||
+				instr.fDst >= kAsmArgRegister + kAsmArgRegisterCount)
+				break;
+
+			args[instr.fDst - kAsmArgRegister] = instr.fSrc;
+			instr.fOpcode = kIRNop;
+		}
+
+		const Int32 base = fNextRegister - kIRVirtualRegister;
+		const Int64 shift = fLocalSize;
+		const Int64 saved = fSaved.size();
+
+		fNextRegister += callee.fNextRegister - kIRVirtualRegister;
+		fSaved.resize(fSaved.size() + callee.fSaved.size());
+
+		for (auto& [offset, size] : callee.fLocals)
+			fLocals.emplace_back(offset + shift, size);
+
+		fLocalSize += callee.fLocalSize;
+
+		std::unordered_map<std::string, std::string> labels;
+
+		for (auto& instr : callee.fCode)
+		{
+			if (instr.fOpcode == kIRLabel)
+				labels[instr.fSymbol] = fLabelPrefix + "I" + std::to_string(fInlineCount++);
+		}
+
+		auto exit = fLabelPrefix + "I" + std::to_string(fInlineCount++);
+		auto result = this->NewRegister();
+
+		std::vector<IRInstr> body;
+
+		body.push_back({ .fOpcode = kIRConstant, .fDst = result });
+
+		auto read = [&](Int32& reg) {
+			if (reg >= kIRVirtualRegister)
+			{
+				reg += base;
+				return;
+			}
+
+			if (reg < kAsmArgRegister ||
+				reg >= kAsmArgRegister + kAsmArgRegisterCount)
+				return;
+
+			// a parameter the caller passes nothing for.
+			if (args[reg - kAsmArgRegister] == kIRNoRegister)
+			{
+				args[reg - kAsmArgRegister] = this->NewRegister();
+				body.insert(body.begin(), { .fOpcode = kIRConstant, .fDst = args[reg - kAsmArgRegister] });
+			}
+
+			reg = args[reg - kAsmArgRegister];
+		};
+
+		for (SizeType index = 0; index < callee.fCode.size(); ++index)
+		{
+			auto instr = callee.fCode[index];
+
+			read(instr.fSrc);
+			read(instr.fSrc2);
+
+			if (instr.fDst >= kIRVirtualRegister)
+				instr.fDst += base;
+			else if (instr.fDst == kAsmRetRegister)
+				instr.fDst = result;
+
+			switch (instr.fOpcode)
+			{
+			case kIRLoad:
+			case kIRFrameAddress:
+				if (instr.fSrc == kIRFrameRegister)
+					instr.fImm += shift;
+				break;
+			case kIRStore:
+				if (instr.fSrc2 == kIRFrameRegister)
+					instr.fImm += shift;
+				break;
+			case kIRLabel:
+			case kIRBranch:
+			case kIRJump:
+				instr.fSymbol = labels[instr.fSymbol];
+				break;
+			case kIRCallBegin:
+			case kIRCallEnd:
+				instr.fImm += saved;
+				break;
+			case kIRReturn:
+				// the last return falls through to the exit.
+				if (index + 1 == callee.fCode.size())
+					continue;
+
+				instr = { .fOpcode = kIRJump, .fSymbol = exit };
+				break;
+			default:
+				break;
+			}
+
+			body.push_back(instr);
+		}
+
+		body.push_back({ .fOpcode = kIRLabel, .fSymbol = exit });
+
+		fCode[begin].fOpcode = kIRNop;
+		fCode[end].fOpcode = kIRNop;
+
+		// the caller takes the result right after the call sequence.
+		if (end + 1 < fCode.size() &&
+			fCode[end + 1].fOpcode == kIRMove &&
+			fCode[end + 1].fSrc == kAsmRetRegister)
+			fCode[end + 1].fSrc = result;
+
+		fCode.erase(fCode.begin() + call);
+		fCode.insert(fCode.begin() + call, body.begin(), body.end());
+
+		return true;
+	}
+
+	SizeType ir_inline_calls(IRFunction& code, const std::vector<IRFunction>& bodies,
+							 const std::unordered_map<std::string, SizeType>& functions, SizeType limit)
+	{
+		std::vector<SizeType> calls;
+
+		for (SizeType index = 0; index < code.fCode.size(); ++index)
+		{
+			if (code.fCode[index].fOpcode == kIRCall &&
+				functions.count(code.fCode[index].fSymbol))
+				calls.push_back(index);
+		}
+
+		SizeType budget = kIRInlineGrowth * limit;
+		SizeType count = 0;
+
+		// from the last call back, the indices of the calls before it stay the same.
+		for (auto call = calls.rbegin(); call != calls.rend(); ++call)
+		{
+			auto& callee = bodies[functions.at(code.fCode[*call].fSymbol)];
+
+			if (callee.fName == code.fName)
+				continue;
+
+			auto cost = callee.Cost();
+
+			if (cost > limit * (callee.fInline ? kIRInlineHint : 1) ||
+				cost > budget)
+				continue;
+
+			if (code.Inline(*call, callee))
+			{
+				budget -= cost;
+				++count;
+			}
+		}
+
+		std::erase_if(code.fCode, [](const IRInstr& instr) { return instr.fOpcode == kIRNop; });
+
+		return count;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name TailCalls
+	// @brief A direct call, passing nothing on the stack, whose result only goes
+	// through copies, labels and jumps to a return, jumps to the callee with our
+	// frame torn down. The callee returns to our caller, a recursion in tail
+	// position runs in constant stack space, inlined calls included, whose
+	// results reach the return through the exit of the inlined body. Nothing
+	// lives across such a call, so its call sequence goes away, with the copies
+	// of the result up to the first label, which other paths may still reach.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	SizeType IRFunction::TailCalls()
+	{
+		if (std::any_of(fCode.begin(), fCode.end(), [](const IRInstr& instr) { return instr.fOpcode == kIRFrameAddress; }))
+			return 0;
+
+		std::unordered_map<std::string, SizeType> labels;
+
+		for (SizeType index = 0; index < fCode.size(); ++index)
+		{
+			if (fCode[index].fOpcode == kIRLabel)
+				labels[fCode[index].fSymbol] = index;
+		}
+
+		SizeType count = 0;
+
+		for (SizeType index = 0; index + 1 < fCode.size(); ++index)
+		{
+			if (fCode[index].fOpcode != kIRCall ||
+				fCode[index].fSymbol.empty() ||
+				fCode[index + 1].fOpcode != kIRCallEnd)
+				continue;
+
+			// the registers holding the result, on the way to the return.
+			std::unordered_set<Int32> result = { kAsmRetRegister };
+
+			auto at = index + 2;
+			auto straight = at; // the end of what only the call reaches.
+			bool joined = false;
+			bool tail = false;
+
+			for (SizeType steps = 0; at < fCode.size() && steps < fCode.size(); ++steps)
+			{
+				auto& instr = fCode[at];
+
+				if (instr.fOpcode == kIRReturn)
+				{
+					tail = result.count(kAsmRetRegister);
+					break;
+				}
+
+				if (instr.fOpcode == kIRMove)
+				{
+					if (result.count(instr.fSrc))
+						result.insert(instr.fDst);
+					else
+						result.erase(instr.fDst);
+				}
+				else if (instr.fOpcode == kIRLabel)
+				{
+					joined = true;
+				}
+				else if (instr.fOpcode == kIRJump &&
+						 labels.count(instr.fSymbol))
+				{
+					joined = true;
+					at = labels[instr.fSymbol];
+
+					continue;
+				}
+				else if (instr.fOpcode != kIRNop)
+				{
+					break;
+				}
+
+				++at;
+
+				if (!joined)
+					straight = at;
+			}
+
+			if (!tail)
+				continue;
+
+			for (auto begin = index; begin-- > 0;)
+			{
+				if (fCode[begin].fOpcode == kIRCallBegin &&
+					fCode[begin].fImm == fCode[index + 1].fImm)
+				{
+					fCode[begin].fOpcode = kIRNop;
+					break;
+				}
+			}
+
+			fCode[index].fOpcode = kIRTailCall;
+
+			// straight on to the return, it goes too.
+			if (!joined)
+				straight = at + 1;
+
+			for (auto next = index + 1; next < straight; ++next)
+				fCode[next].fOpcode = kIRNop;
+
+			++count;
+		}
+
+		fCode.erase(std::remove_if(fCode.begin(), fCode.end(), [](const IRInstr& instr) {
+			return instr.fOpcode == kIRNop;
+		}), fCode.end());
+
+		return count;
+	}
+
+	void ir_uses(const IRInstr& instr, std::vector<Int32>& uses)
+	{
+		uses.clear();
+
+		switch (instr.fOpcode)
+		{
+		case kIRMove:
+		case kIRLoad:
+		case kIRPush:
+		case kIRCall:
+		case kIRJumpTable:
+		case kIRArithImm:
+		case kIRUnary:
+			uses.push_back(instr.fSrc);
+			break;
+		case kIRStore:
+		case kIRBranch:
+		case kIRArith:
+			uses.push_back(instr.fSrc);
+			uses.push_back(instr.fSrc2);
+			break;
+		default:
+			break;
+		}
+
+		uses.erase(std::remove_if(uses.begin(), uses.end(), [](Int32 reg) { return reg < 0; }), uses.end());
+	}
+
+	Int32 ir_def(const IRInstr& instr)
+	{
+		switch (instr.fOpcode)
+		{
+		case kIRMove:
+		case kIRConstant:
+		case kIRAddress:
+		case kIRFrameAddress:
+		case kIRLoad:
+		case kIRArith:
+		case kIRArithImm:
+		case kIRUnary:
+			return instr.fDst;
+		default:
+			return kIRNoRegister;
+		}
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Allocate
+	// @brief Linear scan over live intervals.
+	// Liveness is solved per basic block, an interval then spans every
+	// instruction its register is live at. Uses sit at 2 * index and
+	// definitions at 2 * index + 1, so a register may be reused by the
+	// instruction that reads it for the last time.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	void IRFunction::Allocate(Int32 first, Int32 last)
+	{
+		struct IRBlock final
+		{
+			SizeType fBegin{ 0 };
+			SizeType fEnd{ 0 };
+			std::vector<SizeType> fSuccessors;
+			std::vector<UInt64> fGen, fKill, fIn, fOut;
+		};
+
+		const SizeType count = fNextRegister - kIRVirtualRegister;
+
+		auto is_virtual = [](Int32 reg) { return reg >= kIRVirtualRegister; };
+		auto test = [](const std::vector<UInt64>& set, SizeType bit) { return (set[bit / 64] >> (bit % 64)) & 1; };
+		auto set = [](std::vector<UInt64>& set, SizeType bit) { set[bit / 64] |= 1ULL << (bit % 64); };
+
+		// basic blocks, they start at labels and right after jumps.
+		std::vector<IRBlock> blocks;
+		std::unordered_map<std::string, SizeType> labels;
+
+		std::vector<bool> leaders(fCode.size() + 1, false);
+
+		for (SizeType index = 0; index < fCode.size(); ++index)
+		{
+			auto opcode = fCode[index].fOpcode;
+
+			if (index == 0 ||
+				opcode == kIRLabel)
+				leaders[index] = true;
+
+			if (opcode == kIRBranch ||
+				opcode == kIRJump ||
+				opcode == kIRJumpTable ||
+				opcode == kIRReturn ||
+				opcode == kIRTailCall)
+				leaders[index + 1] = true;
+		}
+
+		for (SizeType index = 0; index < fCode.size(); ++index)
+		{
+			if (leaders[index])
+			{
+				if (!blocks.empty())
+					blocks.back().fEnd = index;
+
+				blocks.push_back({ .fBegin = index, .fEnd = fCode.size() });
+			}
+
+			if (fCode[index].fOpcode == kIRLabel)
+				labels[fCode[index].fSymbol] = blocks.size() - 1;
+		}
+
+		std::vector<Int32> uses;
+
+		// only registers read before being written in some block live across blocks,
+		// the data flow sets are made of these alone.
+		std::vector<Int64> global(count, -1);
+		std::vector<SizeType> globals;
+		std::vector<SizeType> defined(count, SIZE_MAX);
+
+		for (SizeType index = 0; index < blocks.size(); ++index)
+		{
+			for (auto at = blocks[index].fBegin; at < blocks[index].fEnd; ++at)
+			{
+				ir_uses(fCode[at], uses);
+
+				for (auto reg : uses)
+				{
+					if (!is_virtual(reg))
+						continue;
+
+					auto virt = reg - kIRVirtualRegister;
+
+					if (defined[virt] != index &&
+						global[virt] < 0)
+					{
+						global[virt] = globals.size();
+						globals.push_back(virt);
+					}
+				}
+
+				auto def = ir_def(fCode[at]);
+
+				if (is_virtual(def))
+					defined[def - kIRVirtualRegister] = index;
+			}
+		}
+
+		const SizeType words = (globals.size() + 63) / 64;
+
+		for (SizeType index = 0; index < blocks.size(); ++index)
+		{
+			auto& block = blocks[index];
+			auto& tail = fCode[block.fEnd - 1];
+
+			block.fGen.assign(words, 0);
+			block.fKill.assign(words, 0);
+			block.fIn.assign(words, 0);
+			block.fOut.assign(words, 0);
+
+			if (tail.fOpcode == kIRBranch ||
+				tail.fOpcode == kIRJump)
+			{
+				if (labels.count(tail.fSymbol))
+					block.fSuccessors.push_back(labels[tail.fSymbol]);
+			}
+
+			if (tail.fOpcode == kIRJumpTable)
+			{
+				for (auto& target : tail.fTargets)
+				{
+					if (labels.count(target) &&
+						std::find(block.fSuccessors.begin(), block.fSuccessors.end(), labels[target]) == block.fSuccessors.end())
+						block.fSuccessors.push_back(labels[target]);
+				}
+			}
+
+			if (tail.fOpcode != kIRJump &&
+				tail.fOpcode != kIRJumpTable &&
+				tail.fOpcode != kIRReturn &&
+				tail.fOpcode != kIRTailCall &&
+				index + 1 < blocks.size())
+				block.fSuccessors.push_back(index + 1);
+
+			if (words == 0)
+				continue;
+
+			for (auto at = block.fBegin; at < block.fEnd; ++at)
+			{
+				ir_uses(fCode[at], uses);
+
+				for (auto reg : uses)
+				{
+					if (is_virtual(reg) &&
+						global[reg - kIRVirtualRegister] >= 0 &&
+						!test(block.fKill, global[reg - kIRVirtualRegister]))
+						set(block.fGen, global[reg - kIRVirtualRegister]);
+				}
+
+				auto def = ir_def(fCode[at]);
+
+				if (is_virtual(def) &&
+					global[def - kIRVirtualRegister] >= 0)
+					set(block.fKill, global[def - kIRVirtualRegister]);
+			}
+		}
+
+		// live variables, backwards until nothing changes.
+		for (bool changed = words > 0; changed;)
+		{
+			changed = false;
+
+			for (auto index = blocks.size(); index-- > 0;)
+			{
+				auto& block = blocks[index];
+
+				for (SizeType word = 0; word < words; ++word)
+				{
+					UInt64 out = 0;
+
+					for (auto succ : block.fSuccessors)
+						out |= blocks[succ].fIn[word];
+
+					UInt64 in = block.fGen[word] | (out & ~block.fKill[word]);
+
+					if (in != block.fIn[word] ||
+						out != block.fOut[word])
+						changed = true;
+
+					block.fIn[word] = in;
+					block.fOut[word] = out;
+				}
+			}
+		}
+
+		// intervals.
+		std::vector<Int64> start(count, INT64_MAX);
+		std::vector<Int64> end(count, -1);
+		std::vector<Int64> hint(count, -1);
+
+		auto extend = [&](SizeType virt, Int64 at) {
+			start[virt] = std::min(start[virt], at);
+			end[virt] = std::max(end[virt], at);
+		};
+
+		for (auto& block : blocks)
+		{
+			for (SizeType word = 0; word < words; ++word)
+			{
+				for (auto bits = block.fIn[word]; bits; bits &= bits - 1)
+					extend(globals[word * 64 + __builtin_ctzll(bits)], block.fBegin * 2);
+
+				for (auto bits = block.fOut[word]; bits; bits &= bits - 1)
+					extend(globals[word * 64 + __builtin_ctzll(bits)], block.fEnd * 2 - 1);
+			}
+
+			for (auto at = block.fBegin; at < block.fEnd; ++at)
+			{
+				ir_uses(fCode[at], uses);
+
+				for (auto reg : uses)
+				{
+					if (is_virtual(reg))
+						extend(reg - kIRVirtualRegister, at * 2);
+				}
+
+				auto def = ir_def(fCode[at]);
+
+				if (is_virtual(def))
+					extend(def - kIRVirtualRegister, at * 2 + 1);
+
+				// 'mv dst, lhs' comes first, the right operand must not share a register with dst.
+				if (fCode[at].fOpcode == kIRArith &&
+					is_virtual(fCode[at].fSrc2))
+					extend(fCode[at].fSrc2 - kIRVirtualRegister, at * 2 + 1);
+
+				// copies go away when both ends get the same register.
+				if (is_virtual(def) &&
+					is_virtual(fCode[at].fSrc) &&
+					(fCode[at].fOpcode == kIRMove ||
+					 fCode[at].fOpcode == kIRArith ||
+					 fCode[at].fOpcode == kIRArithImm ||
+					 fCode[at].fOpcode == kIRUnary))
+					hint[def - kIRVirtualRegister] = fCode[at].fSrc - kIRVirtualRegister;
+			}
+		}
+
+		// a call sequence saves registers before its arguments are pushed, so a value
+		// made among the arguments and read after the call has to live in memory.
+		std::vector<Int64> calls(fCode.size(), -1);
+		std::vector<Int64> pending;
+
+		// walking backwards, the innermost call still to come at each instruction.
+		for (auto index = fCode.size(); index-- > 0;)
+		{
+			if (fCode[index].fOpcode == kIRCallEnd)
+				pending.push_back(-1);
+			else if (fCode[index].fOpcode == kIRCall && !pending.empty())
+				pending.back() = index;
+			else if (fCode[index].fOpcode == kIRCallBegin && !pending.empty())
+				pending.pop_back();
+
+			for (auto it = pending.rbegin(); it != pending.rend(); ++it)
+			{
+				if (*it >= 0)
+				{
+					calls[index] = *it;
+					break;
+				}
+			}
+		}
+
+		// a callee saved register costs a save and a restore per run of the function,
+		// a caller saved one costs them around every call it lives across. Intervals
+		// that live across more than one call, or across one in a loop, prefer the former.
+		std::vector<bool> looped(fCode.size(), false);
+
+		for (SizeType index = 0; index < blocks.size(); ++index)
+		{
+			auto& tail = fCode[blocks[index].fEnd - 1];
+
+			if ((tail.fOpcode != kIRBranch && tail.fOpcode != kIRJump) ||
+				!labels.count(tail.fSymbol) ||
+				labels[tail.fSymbol] > index)
+				continue;
+
+			for (auto at = blocks[labels[tail.fSymbol]].fBegin; at < blocks[index].fEnd; ++at)
+				looped[at] = true;
+		}
+
+		std::vector<Int64> sites;
+		std::vector<Int64> weights(1, 0);
+
+		for (SizeType index = 0; index < fCode.size(); ++index)
+		{
+			if (fCode[index].fOpcode != kIRCall)
+				continue;
+
+			sites.push_back(index * 2);
+			weights.push_back(weights.back() + (looped[index] ? 2 : 1));
+		}
+
+		auto crosses = [&](SizeType reg) {
+			auto from = std::upper_bound(sites.begin(), sites.end(), start[reg]) - sites.begin();
+			auto to = std::lower_bound(sites.begin(), sites.end(), end[reg] - 1) - sites.begin();
+
+			return from < to && weights[to] - weights[from] > 1;
+		};
+
+		auto is_callee_saved = [](Int32 reg) {
+			return reg >= kAsmCalleeSavedFirst && reg <= kAsmCalleeSavedLast;
+		};
+
+		Int64 slots = 0;
+
+		fLocations.assign(count, {});
+		fCalleeSaved.clear();
+
+		// scan.
+		std::vector<SizeType> order;
+
+		for (SizeType reg = 0; reg < count; ++reg)
+		{
+			if (end[reg] < 0)
+				continue;
+
+			auto call = calls[start[reg] / 2];
+
+			if (call >= 0 &&
+				end[reg] > call * 2 + 1)
+			{
+				fLocations[reg].fSlot = slots++;
+				continue;
+			}
+
+			order.push_back(reg);
+		}
+
+		std::sort(order.begin(), order.end(), [&](SizeType lhs, SizeType rhs) { return start[lhs] < start[rhs]; });
+
+		// a leaf function also takes kAsmLeafFirst..kAsmLeafLast, as nothing it calls may clobber them.
+		std::vector<Int32> candidates;
+
+		for (auto candidate = first; candidate <= last; ++candidate)
+			candidates.push_back(candidate);
+
+		if (sites.empty())
+		{
+			for (auto candidate = kAsmLeafFirst; candidate <= kAsmLeafLast; ++candidate)
+				candidates.push_back(candidate);
+		}
+
+		std::vector<SizeType> active;
+		std::vector<bool> busy(kAsmRegisterLimit, false);
+
+		for (auto reg : order)
+		{
+			// free the registers of intervals that ended.
+			active.erase(std::remove_if(active.begin(), active.end(), [&](SizeType other) {
+				if (end[other] >= start[reg])
+					return false;
+
+				busy[fLocations[other].fRegister] = false;
+				return true;
+			}), active.end());
+
+			Int32 free = kIRNoRegister;
+
+			bool across = crosses(reg);
+
+			if (hint[reg] >= 0 &&
+				fLocations[hint[reg]].fRegister != kIRNoRegister &&
+				!busy[fLocations[hint[reg]].fRegister] &&
+				(!across || is_callee_saved(fLocations[hint[reg]].fRegister)))
+				free = fLocations[hint[reg]].fRegister;
+
+			// callee saved registers first across calls, last otherwise.
+			for (Int32 round = 0; round < 2 && free == kIRNoRegister; ++round)
+			{
+				for (auto candidate : candidates)
+				{
+					if (!busy[candidate] &&
+						is_callee_saved(candidate) == (across == (round == 0)))
+					{
+						free = candidate;
+						break;
+					}
+				}
+			}
+
+			if (free == kIRNoRegister)
+			{
+				// spill the interval that lives the longest.
+				auto victim = std::max_element(active.begin(), active.end(), [&](SizeType lhs, SizeType rhs) { return end[lhs] < end[rhs]; });
+
+				if (victim != active.end() &&
+					end[*victim] > end[reg])
+				{
+					free = fLocations[*victim].fRegister;
+
+					fLocations[*victim] = { .fRegister = kIRNoRegister, .fSlot = slots++ };
+					active.erase(victim);
+				}
+				else
+				{
+					fLocations[reg].fSlot = slots++;
+					continue;
+				}
+			}
+
+			busy[free] = true;
+			fLocations[reg].fRegister = free;
+
+			if (is_callee_saved(free) &&
+				std::find(fCalleeSaved.begin(), fCalleeSaved.end(), free) == fCalleeSaved.end())
+				fCalleeSaved.push_back(free);
+
+			active.push_back(reg);
+		}
+
+		std::sort(fCalleeSaved.begin(), fCalleeSaved.end());
+
+		// callee saved registers are kept right above the spill slots.
+		fSaveOffset = fLocalSize + slots * kIRWordSize;
+		fFrameSize = fSaveOffset + fCalleeSaved.size() * kIRWordSize;
+
+		// caller saved registers that hold a value across a call are saved by its call sequence.
+		// At most last - first + 1 intervals are in a register at once, so the sweep is cheap.
+		std::vector<Int64> open;
+		std::vector<SizeType> live;
+
+		SizeType next = 0;
+
+		for (SizeType index = 0; index < fCode.size(); ++index)
+		{
+			auto& instr = fCode[index];
+
+			if (instr.fOpcode == kIRCallBegin)
+			{
+				open.push_back(instr.fImm);
+				continue;
+			}
+
+			if (instr.fOpcode == kIRCallEnd)
+			{
+				open.pop_back();
+				continue;
+			}
+
+			if (instr.fOpcode != kIRCall ||
+				open.empty())
+				continue;
+
+			auto at = (Int64)index * 2;
+
+			for (; next < order.size() && start[order[next]] < at; ++next)
+			{
+				if (fLocations[order[next]].fRegister != kIRNoRegister)
+					live.push_back(order[next]);
+			}
+
+			live.erase(std::remove_if(live.begin(), live.end(), [&](SizeType reg) { return end[reg] < at; }), live.end());
+
+			auto& saved = fSaved[open.back()];
+
+			for (auto reg : live)
+			{
+				if (end[reg] > at + 1 &&
+					!is_callee_saved(fLocations[reg].fRegister))
+					saved.push_back(fLocations[reg].fRegister);
+			}
+
+			std::sort(saved.begin(), saved.end());
+			saved.erase(std::unique(saved.begin(), saved.end()), saved.end());
+		}
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Lower
+	// @brief Write MASM lines, with spilled registers reloaded in the scratch registers.
+	// The stack pointer moves with pushes, so frame offsets are tracked as we go.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	void IRFunction::Lower(std::vector<AsmLine>& lines)
+	{
+		Int64 depth = 0;
+
+		auto name = [](Int32 reg) { return AsmOperand::Register(reg); };
+		auto imm = [](UInt64 value) { return AsmOperand::Immediate(value); };
+
+		auto stack = [&](Int64 offset) {
+			return AsmOperand::Memory(kAsmSpRegister, offset + depth);
+		};
+
+		auto memory = [&](Int32 base, Int64 offset) {
+			if (base == kIRFrameRegister)
+				return stack(offset);
+
+			if (base == kIRArgRegister)
+				return stack(fFrameSize + kIRWordSize + offset);
+
+			return AsmOperand::Memory(base, offset);
+		};
+
+		auto emit = [&](const std::string& mnemonic, std::vector<AsmOperand> operands) {
+			lines.push_back(AsmLine::Instr(mnemonic, std::move(operands)));
+		};
+
+		if (fFrameSize > 0)
+			emit("dec", { name(kAsmSpRegister), imm(fFrameSize) });
+
+		for (SizeType index = 0; index < fCalleeSaved.size(); ++index)
+			emit("stw", { name(fCalleeSaved[index]), stack(fSaveOffset + index * kIRWordSize) });
+
+		std::vector<Int32> uses;
+
+		for (auto instr : fCode)
+		{
+			// spilled registers go through the scratch registers.
+			std::vector<std::pair<Int32, Int32>> scratch;
+
+			auto resolve = [&](Int32 reg) -> Int32 {
+				if (reg < kIRVirtualRegister)
+					return reg;
+
+				auto& location = fLocations[reg - kIRVirtualRegister];
+
+				if (location.fRegister != kIRNoRegister)
+					return location.fRegister;
+
+				for (auto& entry : scratch)
+				{
+					if (entry.first == reg)
+						return entry.second;
+				}
+
+				scratch.emplace_back(reg, scratch.empty() ? kIRScratchRegister : kIRScratchRegister2);
+				return scratch.back().second;
+			};
+
+			auto slot = [&](Int32 reg) {
+				auto& location = fLocations[reg - kIRVirtualRegister];
+				return location.fRegister == kIRNoRegister ? location.fSlot : -1;
+			};
+
+			ir_uses(instr, uses);
+
+			for (auto reg : uses)
+			{
+				if (reg >= kIRVirtualRegister &&
+					slot(reg) >= 0 &&
+					std::none_of(scratch.begin(), scratch.end(), [&](auto& entry) { return entry.first == reg; }))
+					emit("ldw", { name(resolve(reg)), stack(fLocalSize + slot(reg) * kIRWordSize) });
+			}
+
+			auto def = ir_def(instr);
+
+			// a spilled result is built in the scratch of its left operand, or in a free one.
+			if (def >= kIRVirtualRegister &&
+				slot(def) >= 0)
+			{
+				Int32 target = kIRScratchRegister;
+
+				for (auto& entry : scratch)
+				{
+					if (entry.second == target)
+						target = kIRScratchRegister2;
+				}
+
+				for (auto& entry : scratch)
+				{
+					if (entry.first == instr.fSrc &&
+						instr.fOpcode != kIRLoad)
+						target = entry.second;
+				}
+
+				scratch.emplace_back(def, target);
+			}
+
+			instr.fDst = instr.fDst >= 0 ? resolve(instr.fDst) : instr.fDst;
+			instr.fSrc = instr.fSrc >= 0 ? resolve(instr.fSrc) : instr.fSrc;
+			instr.fSrc2 = instr.fSrc2 >= 0 ? resolve(instr.fSrc2) : instr.fSrc2;
+
+			switch (instr.fOpcode)
+			{
+			case kIRLabel:
+				lines.push_back(AsmLine::Export(".text", instr.fSymbol));
+				break;
+			case kIRMove:
+				if (instr.fDst != instr.fSrc)
+					emit("mv", { name(instr.fDst), name(instr.fSrc) });
+				break;
+			case kIRConstant:
+				// masm takes no sign, negative values are negated after the load.
+				if (instr.fImm < 0)
+				{
+					emit("ldw", { name(instr.fDst), imm(0ULL - (UInt64)instr.fImm) });
+					emit("neg", { name(instr.fDst) });
+				}
+				else
+				{
+					emit("ldw", { name(instr.fDst), imm(instr.fImm) });
+				}
+				break;
+			case kIRAddress:
+				emit("lda", { name(instr.fDst), AsmOperand::Symbol(instr.fSymbol) });
+				break;
+			case kIRFrameAddress:
+			{
+				auto offset = depth + instr.fImm;
+
+				if (instr.fSrc == kIRArgRegister)
+					offset += fFrameSize + kIRWordSize;
+
+				emit("mv", { name(instr.fDst), name(kAsmSpRegister) });
+
+				if (offset != 0)
+					emit("add", { name(instr.fDst), imm(offset) });
+
+				break;
+			}
+			case kIRLoad:
+				emit(instr.fWidth == 1 ? "ldb" : "ldw", { name(instr.fDst), memory(instr.fSrc, instr.fImm) });
+				break;
+			case kIRStore:
+				emit(instr.fWidth == 1 ? "stb" : "stw", { name(instr.fSrc), memory(instr.fSrc2, instr.fImm) });
+				break;
+			case kIRArith:
+				if (instr.fDst != instr.fSrc)
+					emit("mv", { name(instr.fDst), name(instr.fSrc) });
+
+				emit(instr.fMnemonic, { name(instr.fDst), name(instr.fSrc2) });
+				break;
+			case kIRArithImm:
+				if (instr.fDst != instr.fSrc)
+					emit("mv", { name(instr.fDst), name(instr.fSrc) });
+
+				// immediates take no sign, 'dec' subtracts.
+				if (instr.fImm < 0)
+					emit("dec", { name(instr.fDst), imm(0ULL - (UInt64)instr.fImm) });
+				else if (instr.fImm > 0)
+					emit(instr.fMnemonic, { name(instr.fDst), imm(instr.fImm) });
+
+				break;
+			case kIRUnary:
+				if (instr.fDst != instr.fSrc)
+					emit("mv", { name(instr.fDst), name(instr.fSrc) });
+
+				emit(instr.fMnemonic, { name(instr.fDst) });
+				break;
+			case kIRBranch:
+				emit(instr.fMnemonic, { name(instr.fSrc), name(instr.fSrc2), AsmOperand::Symbol(instr.fSymbol) });
+				break;
+			case kIRJump:
+				emit("jb", { AsmOperand::Symbol(instr.fSymbol) });
+				break;
+			case kIRJumpTable:
+				// 'jrl' pops the address pushed right before, the stack is as it was.
+				emit("psh", { name(instr.fSrc) });
+				emit("jrl", {});
+				break;
+			case kIRPush:
+				emit("psh", { name(instr.fSrc) });
+				depth += kIRWordSize;
+				break;
+			case kIRDrop:
+				emit("add", { name(kAsmSpRegister), imm(instr.fImm) });
+				depth -= instr.fImm;
+				break;
+			case kIRCallBegin:
+			{
+				for (auto reg : fSaved[instr.fImm])
+				{
+					emit("psh", { name(reg) });
+					depth += kIRWordSize;
+				}
+
+				break;
+			}
+			case kIRCall:
+				emit("jlr", { instr.fSymbol.empty() ? name(instr.fSrc) : AsmOperand::Symbol(instr.fSymbol) });
+				break;
+			case kIRCallEnd:
+			{
+				auto& saved = fSaved[instr.fImm];
+
+				if (saved.empty())
+					break;
+
+				for (SizeType index = 0; index < saved.size(); ++index)
+					emit("ldw", { name(saved[index]), AsmOperand::Memory(kAsmSpRegister, (saved.size() - 1 - index) * kIRWordSize) });
+
+				emit("add", { name(kAsmSpRegister), imm(saved.size() * kIRWordSize) });
+				depth -= saved.size() * kIRWordSize;
+
+				break;
+			}
+			case kIRReturn:
+			case kIRTailCall:
+				for (SizeType index = 0; index < fCalleeSaved.size(); ++index)
+					emit("ldw", { name(fCalleeSaved[index]), stack(fSaveOffset + index * kIRWordSize) });
+
+				if (fFrameSize > 0)
+					emit("add", { name(kAsmSpRegister), imm(fFrameSize) });
+
+				if (instr.fOpcode == kIRTailCall)
+					emit("jb", { AsmOperand::Symbol(instr.fSymbol) });
+				else
+					emit("jrl", {});
+
+				break;
+			default:
+				break;
+			}
+
+			if (def >= kIRVirtualRegister &&
+				slot(def) >= 0)
+				emit("stw", { name(resolve(def)), stack(fLocalSize + slot(def) * kIRWordSize) });
+		}
+	}
+}
@@ -0,0 +1,191 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#pragma once
+
+#include <C++Kit/Defines.hpp>
+#include <C++Kit/AsmKit/Arch/NewCPU.hpp>
+#include <C++Kit/AsmKit/Object.hpp>
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// @brief NewCPU intermediate representation.
+// Front-ends emit code over an unlimited set of virtual registers, the
+// allocator then maps them on the machine registers and spills the rest.
+// @file AsmKit/IR.hpp
+
+#define kIRNoRegister      (-1)
+#define kIRFrameRegister   (-2) // base of the locals, sp once the frame is set up.
+#define kIRArgRegister     (-3) // base of the arguments, right above the return address.
+#define kIRVirtualRegister 64   // first virtual register, smaller numbers are machine registers.
+
+// @brief scratch registers, reserved to reload spilled values.
+#define kIRScratchRegister  15
+#define kIRScratchRegister2 16
+
+// @brief machine registers the allocator hands out to virtual ones.
+#define kIRFirstUsable 1
+#define kIRLastUsable  14
+
+#define kIRWordSize 8
+
+// @brief inlining, a function declared inline may be kIRInlineHint times as large as the limit,
+// and a caller grows by at most kIRInlineGrowth times the limit.
+#define kIRInlineHint   4
+#define kIRInlineGrowth 16
+
+namespace CxxKit
+{
+	enum
+	{
+		kIRNop,
+		kIRLabel,        // fSymbol:
+		kIRMove,         // mv fDst, fSrc
+		kIRConstant,     // ldw fDst, fImm
+		kIRAddress,      // lda fDst, fSymbol
+		kIRFrameAddress, // fDst = fSrc + fImm, fSrc being kIRFrameRegister or kIRArgRegister
+		kIRLoad,         // ldw/ldb fDst, [fSrc+fImm]
+		kIRStore,        // stw/stb fSrc, [fSrc2+fImm]
+		kIRArith,        // fDst = fSrc fMnemonic fSrc2
+		kIRArithImm,     // fDst = fSrc + fImm
+		kIRUnary,        // fDst = fMnemonic fSrc
+		kIRBranch,       // fMnemonic fSrc, fSrc2, fSymbol
+		kIRJump,         // jb fSymbol
+		kIRJumpTable,    // psh fSrc; jrl, fSrc being read from the table fSymbol of the labels fTargets
+		kIRPush,         // psh fSrc
+		kIRDrop,         // add sp, fImm
+		kIRCallBegin,    // start of a call sequence, live caller saved registers are saved here
+		kIRCall,         // jlr fSymbol, or jlr fSrc when fSymbol is empty
+		kIRCallEnd,      // end of a call sequence, saved registers come back here
+		kIRReturn,       // tear the frame down and jrl
+		kIRTailCall,     // tear the frame down and jb fSymbol, the arguments being in place
+	};
+
+	struct IRInstr final
+	{
+		Int32 fOpcode{ kIRNop };
+		std::string fMnemonic;
+		Int32 fDst{ kIRNoRegister };
+		Int32 fSrc{ kIRNoRegister };
+		Int32 fSrc2{ kIRNoRegister };
+		Int64 fImm{ 0 };
+		Int32 fWidth{ kIRWordSize };
+		std::string fSymbol;
+		std::vector<std::string> fTargets;
+	};
+
+	/// @brief where the allocator put a virtual register.
+	struct IRLocation final
+	{
+		Int32 fRegister{ kIRNoRegister };
+		Int64 fSlot{ -1 };
+	};
+
+	/// @brief code of a single function, over virtual registers.
+	class IRFunction final
+	{
+	public:
+		explicit IRFunction() = default;
+		~IRFunction() = default;
+
+		CXXKIT_COPY_DEFAULT(IRFunction);
+
+	public:
+		Int32 NewRegister() noexcept { return fNextRegister++; }
+
+		/// @brief registers below this one are in use.
+		Int32 RegisterLimit() const noexcept { return fNextRegister; }
+
+		void Label(const std::string& label);
+		void Move(Int32 dst, Int32 src);
+		void Constant(Int32 dst, Int64 value);
+		void Address(Int32 dst, const std::string& symbol);
+		void FrameAddress(Int32 dst, Int32 base, Int64 offset);
+		void Load(Int32 dst, Int32 base, Int64 offset, Int32 width);
+		void Store(Int32 src, Int32 base, Int64 offset, Int32 width);
+		void Arith(const std::string& mnemonic, Int32 dst, Int32 lhs, Int32 rhs);
+		void ArithImm(Int32 dst, Int32 src, Int64 value);
+		void Unary(const std::string& mnemonic, Int32 dst, Int32 src);
+		void Branch(const std::string& mnemonic, Int32 lhs, Int32 rhs, const std::string& label);
+		void Jump(const std::string& label);
+		void JumpTable(Int32 target, const std::string& table, std::vector<std::string> labels);
+		void Push(Int32 src);
+		void Drop(Int64 bytes);
+		void CallBegin();
+		void Call(const std::string& symbol, Int32 target = kIRNoRegister);
+		void CallEnd();
+		void Return();
+
+		/// @brief a local of size bytes at offset from kIRFrameRegister.
+		void Local(Int64 offset, SizeType size);
+
+		/// @brief instructions that lower to code, what inlining the function costs.
+		SizeType Cost() const;
+
+		/// @brief replace the call at index call, and its call sequence, with a copy of callee.
+		/// Calls passing arguments on the stack, and callees reading them there, are left alone.
+		/// The call sequence is left as kIRNop instructions, so that no other index moves back.
+		bool Inline(SizeType call, const IRFunction& callee);
+
+		/// @brief calls whose result is returned as is become kIRTailCall, returns how many did.
+		/// Functions taking the address of a local keep their calls, the callee may read it.
+		SizeType TailCalls();
+
+		/// @brief map virtual registers on [first, last], spilling what does not fit.
+		/// A function calling nothing also gets kAsmLeafFirst..kAsmLeafLast.
+		void Allocate(Int32 first, Int32 last);
+
+		/// @brief write the allocated function as MASM, one instruction per line.
+		void Lower(std::vector<AsmLine>& lines);
+
+	public:
+		std::string fName;
+		std::vector<IRInstr> fCode;
+
+		/// @brief bytes of locals the front-end addresses from kIRFrameRegister.
+		SizeType fLocalSize{ 0 };
+
+		/// @brief offset and size of each local, in fLocalSize.
+		std::vector<std::pair<Int64, SizeType>> fLocals;
+
+		/// @brief labels the optimizer makes start with this.
+		std::string fLabelPrefix;
+
+		/// @brief declared inline, the inliner takes larger copies of it.
+		bool fInline{ false };
+
+		/// @brief copies of a small inner loop's body run per trip at -O2, none below 2.
+		SizeType fUnroll{ 0 };
+
+	private:
+		friend class IRModule;
+
+		Int32 fNextRegister{ kIRVirtualRegister };
+		std::vector<IRLocation> fLocations;
+		std::vector<std::vector<Int32>> fSaved;
+		SizeType fInlineCount{ 0 };
+		std::vector<Int32> fCalleeSaved;
+		SizeType fSaveOffset{ 0 };
+		SizeType fFrameSize{ 0 };
+
+	};
+
+	/// @brief calls to bodies of up to limit instructions become copies of them, returns how many did.
+	/// Only bodies as generated are copied, so a call is expanded once at most,
+	/// and a function never into itself. functions maps a name on its body.
+	SizeType ir_inline_calls(IRFunction& code, const std::vector<IRFunction>& bodies,
+							 const std::unordered_map<std::string, SizeType>& functions, SizeType limit);
+
+	/// @brief registers an instruction reads, and the one it writes.
+	void ir_uses(const IRInstr& instr, std::vector<Int32>& uses);
+	Int32 ir_def(const IRInstr& instr);
+}
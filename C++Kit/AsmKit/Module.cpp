@@ -0,0 +1,310 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#include <AsmKit/Module.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+//! @file Module.cpp
+//! @brief IR modules, to and from the bytes of an AE record.
+
+namespace CxxKit
+{
+	/// @brief appends numbers and strings to the bytes of a module.
+	class IRModuleWriter final
+	{
+	public:
+		void Number(UInt64 value)
+		{
+			do
+			{
+				UInt8 byte = value & 0x7F;
+				value >>= 7;
+
+				fBytes.push_back(value ? byte | 0x80 : byte);
+			} while (value);
+		}
+
+		/// @brief small negative numbers stay small.
+		void Signed(Int64 value)
+		{
+			this->Number(((UInt64)value << 1) ^ (UInt64)(value >> 63));
+		}
+
+		/// @brief the index of the string, followed by the string the first time.
+		void String(const std::string& text)
+		{
+			auto [it, fresh] = fStrings.emplace(text, fStrings.size());
+
+			this->Number(it->second);
+
+			if (!fresh)
+				return;
+
+			this->Number(text.size());
+			fBytes += text;
+		}
+
+	public:
+		std::string fBytes;
+
+	private:
+		std::unordered_map<std::string, SizeType> fStrings;
+
+	};
+
+	/// @brief reads what IRModuleWriter wrote, fGood drops on the first byte missing.
+	class IRModuleReader final
+	{
+	public:
+		explicit IRModuleReader(const std::string& bytes)
+			: fBytes(bytes)
+		{
+		}
+
+		UInt64 Number()
+		{
+			UInt64 value = 0;
+
+			for (SizeType shift = 0; shift < 64; shift += 7)
+			{
+				if (fAt >= fBytes.size())
+				{
+					fGood = false;
+					return 0;
+				}
+
+				UInt8 byte = fBytes[fAt++];
+				value |= (UInt64)(byte & 0x7F) << shift;
+
+				if (!(byte & 0x80))
+					return value;
+			}
+
+			fGood = false;
+			return 0;
+		}
+
+		Int64 Signed()
+		{
+			auto value = this->Number();
+			return (Int64)(value >> 1) ^ -(Int64)(value & 1);
+		}
+
+		std::string String()
+		{
+			auto index = this->Number();
+
+			if (index < fStrings.size())
+				return fStrings[index];
+
+			auto size = this->Number();
+
+			if (index != fStrings.size() ||
+				size > fBytes.size() - std::min(fAt, fBytes.size()))
+			{
+				fGood = false;
+				return "";
+			}
+
+			fStrings.push_back(fBytes.substr(fAt, size));
+			fAt += size;
+
+			return fStrings.back();
+		}
+
+		/// @brief a count of things, each taking a byte at least.
+		SizeType Count()
+		{
+			auto count = this->Number();
+
+			if (count > fBytes.size())
+			{
+				fGood = false;
+				return 0;
+			}
+
+			return count;
+		}
+
+	public:
+		bool fGood{ true };
+
+	private:
+		const std::string& fBytes;
+		SizeType fAt{ 0 };
+		std::vector<std::string> fStrings;
+
+	};
+
+	std::string IRModule::Write() const
+	{
+		IRModuleWriter out;
+
+		out.fBytes = kIRModuleMagic;
+		out.Number(kIRModuleVersion);
+		out.Signed(fLevel);
+		out.Number(fInlineLimit);
+
+		out.Number(fFunctions.size());
+
+		for (auto& function : fFunctions)
+		{
+			out.String(function.fName);
+			out.String(function.fLabelPrefix);
+			out.Number(function.fInline);
+			out.Number(function.fUnroll);
+			out.Number(function.fLocalSize);
+			out.Number(function.fNextRegister);
+			out.Number(function.fSaved.size());
+			out.Number(function.fInlineCount);
+
+			out.Number(function.fLocals.size());
+
+			for (auto& [offset, size] : function.fLocals)
+			{
+				out.Signed(offset);
+				out.Number(size);
+			}
+
+			out.Number(function.fCode.size());
+
+			for (auto& instr : function.fCode)
+			{
+				out.Number(instr.fOpcode);
+				out.String(instr.fMnemonic);
+				out.Signed(instr.fDst);
+				out.Signed(instr.fSrc);
+				out.Signed(instr.fSrc2);
+				out.Signed(instr.fImm);
+				out.Number(instr.fWidth);
+				out.String(instr.fSymbol);
+
+				out.Number(instr.fTargets.size());
+
+				for (auto& target : instr.fTargets)
+					out.String(target);
+			}
+		}
+
+		out.Number(fData.size());
+
+		for (auto& line : fData)
+		{
+			out.Number(line.fKind);
+			out.String(line.fName);
+			out.Number(line.fOperands.size());
+
+			for (auto& operand : line.fOperands)
+			{
+				out.Number(operand.fKind);
+				out.Signed(operand.fRegister);
+				out.Number(operand.fValue);
+				out.Signed(operand.fOffset);
+				out.String(operand.fSymbol);
+			}
+		}
+
+		out.Number(fLocals.size());
+
+		for (auto& name : fLocals)
+			out.String(name);
+
+		return out.fBytes;
+	}
+
+	bool IRModule::Read(const std::string& bytes)
+	{
+		if (bytes.compare(0, strlen(kIRModuleMagic), kIRModuleMagic) != 0)
+			return false;
+
+		auto body = bytes.substr(strlen(kIRModuleMagic));
+		IRModuleReader in(body);
+
+		if (in.Number() != kIRModuleVersion)
+			return false;
+
+		fLevel = in.Signed();
+		fInlineLimit = in.Number();
+
+		fFunctions.resize(in.Count());
+
+		for (auto& function : fFunctions)
+		{
+			function.fName = in.String();
+			function.fLabelPrefix = in.String();
+			function.fInline = in.Number();
+			function.fUnroll = in.Number();
+			function.fLocalSize = in.Number();
+			function.fNextRegister = in.Number();
+			function.fSaved.resize(in.Count());
+			function.fInlineCount = in.Number();
+
+			function.fLocals.resize(in.Count());
+
+			for (auto& [offset, size] : function.fLocals)
+			{
+				offset = in.Signed();
+				size = in.Number();
+			}
+
+			function.fCode.resize(in.Count());
+
+			for (auto& instr : function.fCode)
+			{
+				instr.fOpcode = in.Number();
+				instr.fMnemonic = in.String();
+				instr.fDst = in.Signed();
+				instr.fSrc = in.Signed();
+				instr.fSrc2 = in.Signed();
+				instr.fImm = in.Signed();
+				instr.fWidth = in.Number();
+				instr.fSymbol = in.String();
+
+				instr.fTargets.resize(in.Count());
+
+				for (auto& target : instr.fTargets)
+					target = in.String();
+			}
+
+			if (!in.fGood)
+				return false;
+		}
+
+		fData.resize(in.Count());
+
+		for (auto& line : fData)
+		{
+			line.fKind = in.Number();
+			line.fName = in.String();
+			line.fOperands.resize(in.Count());
+
+			for (auto& operand : line.fOperands)
+			{
+				operand.fKind = in.Number();
+				operand.fRegister = in.Signed();
+				operand.fValue = in.Number();
+				operand.fOffset = in.Signed();
+				operand.fSymbol = in.String();
+			}
+
+			if (!in.fGood)
+				return false;
+		}
+
+		fLocals.resize(in.Count());
+
+		for (auto& name : fLocals)
+			name = in.String();
+
+		return in.fGood;
+	}
+}
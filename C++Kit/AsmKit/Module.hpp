@@ -0,0 +1,59 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#pragma once
+
+#include <C++Kit/Defines.hpp>
+#include <C++Kit/AsmKit/IR.hpp>
+
+#include <string>
+#include <vector>
+
+// @brief IR of a whole translation unit, as cc -flto leaves it in an AE object.
+// The functions are kept as generated, before any pass, with the data of the
+// unit as MASM statements, so that ld can inline across units, drop what no
+// one calls and lower what is left itself.
+// @file AsmKit/Module.hpp
+
+#define kIRModuleMagic   "IRM"
+#define kIRModuleVersion 2
+
+#define kIRModuleRecord "$.ir$" // an IR record is named kIRModuleRecord<unit>.
+
+namespace CxxKit
+{
+	class IRModule final
+	{
+	public:
+		explicit IRModule() = default;
+		~IRModule() = default;
+
+		CXXKIT_COPY_DEFAULT(IRModule);
+
+	public:
+		/// @brief the bytes of the IR record.
+		/// Numbers are LEB128, strings are written once and then referred to by index.
+		std::string Write() const;
+
+		/// @brief false if bytes are not a module of kIRModuleVersion.
+		bool Read(const std::string& bytes);
+
+	public:
+		/// @brief -O level and -finline-limit the unit was compiled with.
+		Int32 fLevel{ 0 };
+		SizeType fInlineLimit{ 0 };
+
+		std::vector<IRFunction> fFunctions;
+		std::vector<AsmLine> fData;
+
+		/// @brief functions and data of internal linkage, another unit may use the same names.
+		std::vector<std::string> fLocals;
+
+	};
+}
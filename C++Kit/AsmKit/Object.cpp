@@ -0,0 +1,324 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#include <AsmKit/Object.hpp>
+#include <StdKit/PEF.hpp>
+
+#include <algorithm>
+#include <limits>
+
+//! @file Object.cpp
+//! @brief MASM statements, their text and their AE encoding.
+
+namespace CxxKit
+{
+	AsmOperand AsmOperand::Register(Int32 reg)
+	{
+		return { .fKind = kAsmOperandRegister, .fRegister = reg };
+	}
+
+	AsmOperand AsmOperand::Immediate(UInt64 value)
+	{
+		return { .fKind = kAsmOperandImmediate, .fValue = value };
+	}
+
+	AsmOperand AsmOperand::Memory(Int32 base, Int64 offset)
+	{
+		return { .fKind = kAsmOperandMemory, .fRegister = base, .fOffset = offset };
+	}
+
+	AsmOperand AsmOperand::Symbol(const std::string& symbol)
+	{
+		return { .fKind = kAsmOperandSymbol, .fSymbol = symbol };
+	}
+
+	AsmLine AsmLine::Instr(const std::string& mnemonic, std::vector<AsmOperand> operands)
+	{
+		return { .fKind = kAsmLineInstr, .fName = mnemonic, .fOperands = std::move(operands) };
+	}
+
+	AsmLine AsmLine::Export(const std::string& section, const std::string& symbol)
+	{
+		return { .fKind = kAsmLineExport, .fName = section, .fOperands = { AsmOperand::Symbol(symbol) } };
+	}
+
+	AsmLine AsmLine::Data(const std::string& width)
+	{
+		return { .fKind = kAsmLineData, .fName = width };
+	}
+
+	AsmLine AsmLine::Begin()
+	{
+		return { .fKind = kAsmLineBegin };
+	}
+
+	AsmLine AsmLine::End()
+	{
+		return { .fKind = kAsmLineEnd };
+	}
+
+	AsmLine AsmLine::Blank()
+	{
+		return { .fKind = kAsmLineBlank };
+	}
+
+	std::string asm_format(const AsmOperand& operand)
+	{
+		switch (operand.fKind)
+		{
+		case kAsmOperandRegister:
+			return kAsmRegisterPrefix + std::to_string(operand.fRegister);
+		case kAsmOperandImmediate:
+			return std::to_string(operand.fValue);
+		case kAsmOperandMemory:
+			return "[" kAsmRegisterPrefix + std::to_string(operand.fRegister) + "+" + std::to_string(operand.fOffset) + "]";
+		default:
+			return operand.fSymbol;
+		}
+	}
+
+	std::string asm_format(const AsmLine& line)
+	{
+		std::string text;
+
+		switch (line.fKind)
+		{
+		case kAsmLineExport:
+			return "__export " + line.fName + " " + asm_format(line.fOperands[0]);
+		case kAsmLineBegin:
+			return "begin";
+		case kAsmLineEnd:
+			return "end";
+		case kAsmLineBlank:
+			return text;
+		default:
+			break;
+		}
+
+		text = "\t" + line.fName;
+
+		for (SizeType index = 0; index < line.fOperands.size(); ++index)
+		{
+			text += index == 0 ? " " : ", ";
+			text += asm_format(line.fOperands[index]);
+		}
+
+		return text;
+	}
+
+	/// @brief the symbol an operand imports, empty if it does not.
+	static std::string asm_import(const AsmOperand& operand)
+	{
+		const std::string prefix = kAsmImport " ";
+
+		if (operand.fKind != kAsmOperandSymbol ||
+			operand.fSymbol.rfind(prefix, 0) != 0)
+			return "";
+
+		return operand.fSymbol.substr(prefix.size());
+	}
+
+	AEObject::AEObject(CharType arch)
+		: fArch(arch), fKind(kPefCode)
+	{
+	}
+
+	void AEObject::Add(const AsmLine& line)
+	{
+		switch (line.fKind)
+		{
+		case kAsmLineExport:
+		{
+			auto& section = line.fName;
+
+			if (section == ".text")
+				fKind = kPefCode;
+			else if (section == ".data")
+				fKind = kPefData;
+			else if (section == ".page_zero")
+				fKind = kPefZero;
+
+			this->Record("$" + section + "$" + line.fOperands[0].fSymbol, fKind);
+			break;
+		}
+		case kAsmLineInstr:
+			this->Instr(line);
+			break;
+		case kAsmLineData:
+			this->Data(line);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void AEObject::Add(const std::string& name, SizeType kind, const std::string& bytes)
+	{
+		this->Record(name, kind);
+		fBytes.insert(fBytes.end(), bytes.begin(), bytes.end());
+	}
+
+	/// @brief start a record, the previous one is as long as the code so far.
+	void AEObject::Record(const std::string& name, SizeType kind)
+	{
+		if (!fRecords.empty())
+			fRecords.back().fSize = fBytes.size();
+
+		AERecordHeader record{};
+
+		memset(record.fPad, kAEInvalidOpcode, kAEPad);
+		memcpy(record.fName, name.c_str(), std::min<SizeType>(name.size(), kAESymbolLen - 1));
+
+		record.fKind = kind;
+
+		fRecords.push_back(record);
+	}
+
+	/// @brief | OPCODE | FUNCT3 | FUNCT7 | registers, lowest first | number or relocation | 0 |
+	/// Only the loads, stores, pushes and jumps carry their last operand.
+	void AEObject::Instr(const AsmLine& line)
+	{
+		// an imported symbol gets a :ld: record ld resolves.
+		for (auto& operand : line.fOperands)
+		{
+			if (auto symbol = asm_import(operand);
+				!symbol.empty())
+				this->Record(std::to_string(symbol.size() + 1) + ":ld:$" + symbol, fKind);
+		}
+
+		auto opcode = std::find_if(kOpcodesStd.begin(), kOpcodesStd.end(), [&](const NCOpcode& op) {
+			return line.fName == op.fName;
+		});
+
+		if (opcode == kOpcodesStd.end())
+			return;
+
+		fBytes.push_back(opcode->fOpcode);
+		fBytes.push_back(opcode->fFunct3);
+		fBytes.push_back(opcode->fFunct7);
+
+		if (opcode->fFunct7 == kAsmRegToReg ||
+			opcode->fFunct7 == kAsmImmediate)
+		{
+			std::vector<Int32> registers;
+
+			for (auto& operand : line.fOperands)
+			{
+				if (operand.fKind == kAsmOperandRegister ||
+					operand.fKind == kAsmOperandMemory)
+					registers.push_back(operand.fRegister);
+			}
+
+			std::sort(registers.begin(), registers.end());
+			registers.erase(std::unique(registers.begin(), registers.end()), registers.end());
+
+			for (auto reg : registers)
+				fBytes.push_back(reg);
+		}
+
+		static const std::vector<std::string> kCarried = { "psh", "jb", "stw", "ldw", "lda", "stb", "ldb" };
+
+		if (!line.fOperands.empty() &&
+			std::find(kCarried.begin(), kCarried.end(), line.fName) != kCarried.end())
+		{
+			auto& operand = line.fOperands.back();
+
+			// masm reads numbers as signed, and takes a zero for a label.
+			if (operand.fKind == kAsmOperandImmediate &&
+				operand.fValue != 0)
+			{
+				auto value = std::min<UInt64>(operand.fValue, std::numeric_limits<Int64>::max());
+
+				for (SizeType i = 0; i < sizeof(UInt64); ++i)
+					fBytes.push_back((value >> (i * 8)) & 0xFF);
+			}
+			else if (auto symbol = asm_import(operand);
+					 !symbol.empty())
+			{
+				this->Relocation(symbol);
+			}
+			else
+			{
+				this->Relocation(asm_format(operand));
+			}
+		}
+
+		fBytes.push_back(0);
+	}
+
+	void AEObject::Data(const AsmLine& line)
+	{
+		SizeType width = 0;
+
+		if (line.fName == "byte") width = 1;
+		if (line.fName == "hword") width = 2;
+		if (line.fName == "dword") width = 4;
+		if (line.fName == "qword") width = 8;
+
+		for (auto& operand : line.fOperands)
+		{
+			if (operand.fKind == kAsmOperandImmediate)
+			{
+				for (SizeType i = 0; i < width; ++i)
+					fBytes.push_back((operand.fValue >> (i * 8)) & 0xFF);
+
+				continue;
+			}
+
+			// only a qword holds an address.
+			if (width != sizeof(UInt64))
+				continue;
+
+			this->Relocation(operand.fSymbol);
+			fBytes.push_back(0);
+		}
+	}
+
+	/// @brief (length):mld_reloc:(symbol), ld patches the address in.
+	void AEObject::Relocation(const std::string& symbol)
+	{
+		auto reloc = std::to_string(symbol.size()) + ":mld_reloc:" + symbol;
+
+		fBytes.insert(fBytes.end(), reloc.begin(), reloc.end());
+	}
+
+	bool AEObject::Write(std::ostream& out)
+	{
+		if (fRecords.empty())
+			return false;
+
+		fRecords.back().fSize = fBytes.size();
+
+		AEHeader hdr{};
+
+		memset(hdr.fPad, kAEInvalidOpcode, kAEPad);
+
+		hdr.fMagic[0] = kAEMag0;
+		hdr.fMagic[1] = kAEMag1;
+		hdr.fSize = sizeof(AEHeader);
+		hdr.fArch = fArch;
+		hdr.fCount = fRecords.size();
+		hdr.fStartCode = sizeof(AEHeader) + fRecords.size() * sizeof(AERecordHeader);
+		hdr.fCodeSize = fBytes.size();
+
+		out.write(reinterpret_cast<const char*>(&hdr), sizeof(AEHeader));
+
+		for (SizeType index = 0; index < fRecords.size(); ++index)
+		{
+			fRecords[index].fFlags |= kKindRelocationAtRuntime;
+			fRecords[index].fOffset = index;
+
+			out.write(reinterpret_cast<const char*>(&fRecords[index]), sizeof(AERecordHeader));
+		}
+
+		out.write(fBytes.data(), fBytes.size());
+
+		return out.good();
+	}
+}
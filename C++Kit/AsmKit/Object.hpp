@@ -0,0 +1,112 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#pragma once
+
+#include <C++Kit/Defines.hpp>
+#include <C++Kit/AsmKit/Arch/NewCPU.hpp>
+#include <C++Kit/StdKit/AE.hpp>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+// @brief MASM statements as data, and the AE object they assemble to.
+// Code generators hand lines over as they are, the text is only made when
+// asked for, and AEObject encodes them in memory the way masm does, so
+// neither a .masm file nor a second process is needed to get an object.
+// @file AsmKit/Object.hpp
+
+#define kAsmImport "__import"
+
+namespace CxxKit
+{
+	enum
+	{
+		kAsmOperandRegister,  // rN
+		kAsmOperandImmediate, // N, no sign
+		kAsmOperandMemory,    // [rN+M]
+		kAsmOperandSymbol,    // label, or __import label
+	};
+
+	struct AsmOperand final
+	{
+		Int32 fKind{ kAsmOperandRegister };
+		Int32 fRegister{ kAsmZeroRegister };
+		UInt64 fValue{ 0 };
+		Int64 fOffset{ 0 };
+		std::string fSymbol;
+
+		static AsmOperand Register(Int32 reg);
+		static AsmOperand Immediate(UInt64 value);
+		static AsmOperand Memory(Int32 base, Int64 offset);
+		static AsmOperand Symbol(const std::string& symbol);
+	};
+
+	enum
+	{
+		kAsmLineInstr,  // fName fOperands...
+		kAsmLineExport, // __export fName fOperands[0], fName being .text, .data or .page_zero
+		kAsmLineData,   // fName fOperands..., fName being byte, hword, dword or qword
+		kAsmLineBegin,
+		kAsmLineEnd,
+		kAsmLineBlank,
+	};
+
+	struct AsmLine final
+	{
+		Int32 fKind{ kAsmLineBlank };
+		std::string fName;
+		std::vector<AsmOperand> fOperands;
+
+		static AsmLine Instr(const std::string& mnemonic, std::vector<AsmOperand> operands = {});
+		static AsmLine Export(const std::string& section, const std::string& symbol);
+		static AsmLine Data(const std::string& width);
+		static AsmLine Begin();
+		static AsmLine End();
+		static AsmLine Blank();
+	};
+
+	/// @brief MASM text of an operand, or of a line, without its line break.
+	std::string asm_format(const AsmOperand& operand);
+	std::string asm_format(const AsmLine& line);
+
+	/// @brief AE object, assembled line by line from MASM statements.
+	/// The bytes are the ones masm writes for the text of the same lines.
+	class AEObject final
+	{
+	public:
+		explicit AEObject(CharType arch);
+		~AEObject() = default;
+
+		CXXKIT_COPY_DEFAULT(AEObject);
+
+	public:
+		void Add(const AsmLine& line);
+
+		/// @brief a record of kind holding bytes as they are.
+		void Add(const std::string& name, SizeType kind, const std::string& bytes);
+
+		/// @brief write header, records and code, false if there is no record to write.
+		bool Write(std::ostream& out);
+
+	private:
+		void Record(const std::string& name, SizeType kind);
+		void Instr(const AsmLine& line);
+		void Data(const AsmLine& line);
+		void Relocation(const std::string& symbol);
+
+	private:
+		CharType fArch;
+		SizeType fKind;
+		std::vector<AERecordHeader> fRecords;
+		std::vector<CharType> fBytes;
+
+	};
+}
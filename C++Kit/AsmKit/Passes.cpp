@@ -0,0 +1,1396 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#include <AsmKit/SSA.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+//! @file Passes.cpp
+//! @brief Optimization passes over the SSA graph, and the pass manager.
+
+namespace CxxKit
+{
+	void IRPassManager::Add(const std::string& name, IRPass pass)
+	{
+		fPasses.emplace_back(name, pass);
+	}
+
+	void IRPassManager::Run(IRGraph& graph)
+	{
+		for (SizeType round = 0; round < kIRPassRounds; ++round)
+		{
+			bool changed = false;
+
+			for (auto& [name, pass] : fPasses)
+				changed |= pass(graph);
+
+			if (!changed)
+				break;
+		}
+	}
+
+	void ir_add_passes(IRPassManager& manager, Int32 level)
+	{
+		if (level < 1)
+			return;
+
+		manager.Add("fold-constants", ir_fold_constants);
+		manager.Add("propagate-copies", ir_propagate_copies);
+
+		if (level >= 2)
+		{
+			manager.Add("eliminate-common-subexpressions", ir_eliminate_common_subexpressions);
+			manager.Add("hoist-invariants", ir_hoist_invariants);
+			manager.Add("reduce-strength", ir_reduce_strength);
+			manager.Add("unroll-loops", ir_unroll_loops);
+		}
+
+		manager.Add("eliminate-dead-code", ir_eliminate_dead_code);
+	}
+
+	void ir_optimize(IRFunction& code, IRPassManager& passes)
+	{
+		IRGraph graph(code, true);
+
+		passes.Run(graph);
+		graph.Flatten();
+
+		code.TailCalls();
+	}
+
+	/// @brief result of 'lhs mnemonic rhs', when the machine agrees with C on it.
+	/// Signedness is gone by now, so division and right shifts of negative values stay.
+	static bool ir_fold_arith(const std::string& mnemonic, Int64 lhs, Int64 rhs, Int64& out)
+	{
+		auto x = (UInt64)lhs;
+		auto y = (UInt64)rhs;
+
+		if (mnemonic == "add")
+			out = (Int64)(x + y);
+		else if (mnemonic == "sub")
+			out = (Int64)(x - y);
+		else if (mnemonic == "mul")
+			out = (Int64)(x * y);
+		else if (mnemonic == "and")
+			out = (Int64)(x & y);
+		else if (mnemonic == "or")
+			out = (Int64)(x | y);
+		else if (mnemonic == "xor")
+			out = (Int64)(x ^ y);
+		else if (mnemonic == "shl" && rhs >= 0 && rhs < 64)
+			out = (Int64)(x << y);
+		else if (mnemonic == "shr" && lhs >= 0 && rhs >= 0 && rhs < 64)
+			out = lhs >> rhs;
+		else if (mnemonic == "div" && lhs >= 0 && rhs > 0)
+			out = lhs / rhs;
+		else if (mnemonic == "mod" && lhs >= 0 && rhs > 0)
+			out = lhs % rhs;
+		else
+			return false;
+
+		return true;
+	}
+
+	/// @brief whether a branch is taken, comparisons of negative values are left alone.
+	static bool ir_fold_branch(const std::string& mnemonic, Int64 lhs, Int64 rhs, bool& taken)
+	{
+		if (mnemonic == "beq")
+			taken = lhs == rhs;
+		else if (mnemonic == "bne")
+			taken = lhs != rhs;
+		else if (lhs < 0 || rhs < 0)
+			return false;
+		else if (mnemonic == "bl")
+			taken = lhs < rhs;
+		else if (mnemonic == "bg")
+			taken = lhs > rhs;
+		else if (mnemonic == "ble")
+			taken = lhs <= rhs;
+		else if (mnemonic == "bge")
+			taken = lhs >= rhs;
+		else
+			return false;
+
+		return true;
+	}
+
+	static bool ir_is_commutative(const std::string& mnemonic)
+	{
+		return mnemonic == "add" || mnemonic == "mul" || mnemonic == "and" ||
+			   mnemonic == "or" || mnemonic == "xor";
+	}
+
+	/// @brief instructions without side effects, which go away once unused.
+	static bool ir_is_pure(const IRInstr& instr)
+	{
+		switch (instr.fOpcode)
+		{
+		case kIRMove:
+		case kIRConstant:
+		case kIRAddress:
+		case kIRFrameAddress:
+		case kIRLoad:
+		case kIRArith:
+		case kIRArithImm:
+		case kIRUnary:
+			return instr.fDst >= kIRVirtualRegister;
+		default:
+			return false;
+		}
+	}
+
+	/// @brief every register an instruction reads, so that it may be rewritten.
+	template <typename Fn>
+	static void ir_for_each_use(IRInstr& instr, Fn fn)
+	{
+		switch (instr.fOpcode)
+		{
+		case kIRMove:
+		case kIRLoad:
+		case kIRPush:
+		case kIRCall:
+		case kIRJumpTable:
+		case kIRArithImm:
+		case kIRUnary:
+			fn(instr.fSrc);
+			break;
+		case kIRStore:
+		case kIRBranch:
+		case kIRArith:
+			fn(instr.fSrc);
+			fn(instr.fSrc2);
+			break;
+		default:
+			break;
+		}
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name ir_fold_constants
+	// @brief Computes what only depends on constants, simplifies identities
+	// and resolves branches whose outcome is known.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ir_fold_constants(IRGraph& graph)
+	{
+		std::vector<bool> known(graph.fFunction.RegisterLimit(), false);
+		std::vector<Int64> values(graph.fFunction.RegisterLimit(), 0);
+
+		auto constant = [&](Int32 reg, Int64& out) {
+			if (reg == kAsmZeroRegister)
+			{
+				out = 0;
+				return true;
+			}
+
+			if (reg < kIRVirtualRegister ||
+				reg >= (Int32)known.size() ||
+				!known[reg])
+				return false;
+
+			out = values[reg];
+			return true;
+		};
+
+		auto make_constant = [&](IRInstr& instr, Int64 value) {
+			instr = { .fOpcode = kIRConstant, .fDst = instr.fDst, .fImm = value };
+		};
+
+		auto make_move = [&](IRInstr& instr, Int32 src) {
+			instr = { .fOpcode = kIRMove, .fDst = instr.fDst, .fSrc = src };
+		};
+
+		bool changed = false;
+		bool pruned = false;
+
+		for (auto index : graph.Order())
+		{
+			auto& block = graph.fBlocks[index];
+
+			// phi nodes of a single constant.
+			for (auto phi = block.fPhis.begin(); phi != block.fPhis.end();)
+			{
+				Int64 value = 0, other = 0;
+				bool same = !phi->fArgs.empty() && constant(phi->fArgs[0], value);
+
+				for (auto arg : phi->fArgs)
+					same = same && constant(arg, other) && other == value;
+
+				if (!same)
+				{
+					++phi;
+					continue;
+				}
+
+				block.fCode.insert(block.fCode.begin(), { .fOpcode = kIRConstant, .fDst = phi->fDst, .fImm = value });
+				phi = block.fPhis.erase(phi);
+
+				changed = true;
+			}
+
+			for (auto& instr : block.fCode)
+			{
+				Int64 lhs = 0, rhs = 0, out = 0;
+
+				switch (instr.fOpcode)
+				{
+				case kIRMove:
+				{
+					// copies of registers are for ir_propagate_copies, only r0 is a constant here.
+					if (instr.fDst >= kIRVirtualRegister &&
+						instr.fSrc == kAsmZeroRegister)
+					{
+						make_constant(instr, 0);
+						changed = true;
+					}
+					else if (instr.fDst >= kIRVirtualRegister &&
+							 constant(instr.fSrc, lhs))
+					{
+						known[instr.fDst] = true;
+						values[instr.fDst] = lhs;
+					}
+
+					break;
+				}
+				case kIRArithImm:
+				{
+					if (constant(instr.fSrc, lhs))
+					{
+						make_constant(instr, (Int64)((UInt64)lhs + (UInt64)instr.fImm));
+						changed = true;
+					}
+					else if (instr.fImm == 0)
+					{
+						make_move(instr, instr.fSrc);
+						changed = true;
+					}
+
+					break;
+				}
+				case kIRUnary:
+				{
+					if (constant(instr.fSrc, lhs))
+					{
+						make_constant(instr, instr.fMnemonic == "neg" ? (Int64)(0ULL - (UInt64)lhs) : ~lhs);
+						changed = true;
+					}
+
+					break;
+				}
+				case kIRArith:
+				{
+					bool known_lhs = constant(instr.fSrc, lhs);
+					bool known_rhs = constant(instr.fSrc2, rhs);
+
+					if (known_lhs &&
+						known_rhs &&
+						ir_fold_arith(instr.fMnemonic, lhs, rhs, out))
+					{
+						make_constant(instr, out);
+						changed = true;
+
+						break;
+					}
+
+					// constants go on the right.
+					if (known_lhs &&
+						!known_rhs &&
+						ir_is_commutative(instr.fMnemonic))
+					{
+						std::swap(instr.fSrc, instr.fSrc2);
+						std::swap(lhs, rhs);
+						std::swap(known_lhs, known_rhs);
+
+						changed = true;
+					}
+
+					if (!known_rhs)
+						break;
+
+					auto& mnemonic = instr.fMnemonic;
+
+					if (rhs == 0 &&
+						(mnemonic == "add" || mnemonic == "sub" || mnemonic == "or" ||
+						 mnemonic == "xor" || mnemonic == "shl" || mnemonic == "shr"))
+						make_move(instr, instr.fSrc);
+					else if (rhs == 1 &&
+							 (mnemonic == "mul" || mnemonic == "div"))
+						make_move(instr, instr.fSrc);
+					else if (rhs == 0 &&
+							 (mnemonic == "mul" || mnemonic == "and"))
+						make_constant(instr, 0);
+					else if (rhs == -1 &&
+							 mnemonic == "mul")
+						instr = { .fOpcode = kIRUnary, .fMnemonic = "neg", .fDst = instr.fDst, .fSrc = instr.fSrc };
+					else if ((rhs & 0xFF) == 0xFF &&
+							 mnemonic == "and" &&
+							 graph.TypeOf(instr.fSrc) == kIRTypeByte)
+						make_move(instr, instr.fSrc);
+					else if (mnemonic == "add")
+						instr = { .fOpcode = kIRArithImm, .fMnemonic = "add", .fDst = instr.fDst, .fSrc = instr.fSrc, .fImm = rhs };
+					else if (mnemonic == "sub" &&
+							 rhs != INT64_MIN)
+						instr = { .fOpcode = kIRArithImm, .fMnemonic = "add", .fDst = instr.fDst, .fSrc = instr.fSrc, .fImm = -rhs };
+					else
+						break;
+
+					changed = true;
+					break;
+				}
+				case kIRBranch:
+				{
+					bool taken = false;
+
+					if (instr.fSrc == instr.fSrc2)
+						taken = instr.fMnemonic == "beq" || instr.fMnemonic == "ble" || instr.fMnemonic == "bge";
+					else if (!constant(instr.fSrc, lhs) ||
+							 !constant(instr.fSrc2, rhs) ||
+							 !ir_fold_branch(instr.fMnemonic, lhs, rhs, taken))
+						break;
+
+					if (taken)
+					{
+						graph.RemoveEdge(index, block.fSuccessors.back());
+						instr = { .fOpcode = kIRJump, .fSymbol = instr.fSymbol };
+					}
+					else
+					{
+						graph.RemoveEdge(index, block.fSuccessors.front());
+						instr = { .fOpcode = kIRNop };
+					}
+
+					changed = pruned = true;
+					break;
+				}
+				default:
+					break;
+				}
+
+				if (instr.fOpcode == kIRConstant &&
+					instr.fDst >= kIRVirtualRegister)
+				{
+					known[instr.fDst] = true;
+					values[instr.fDst] = instr.fImm;
+				}
+			}
+
+			block.fCode.erase(std::remove_if(block.fCode.begin(), block.fCode.end(), [](const IRInstr& instr) {
+				return instr.fOpcode == kIRNop;
+			}), block.fCode.end());
+		}
+
+		if (pruned)
+			graph.Prune();
+
+		return changed;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name ir_propagate_copies
+	// @brief Readers of a copy read its source instead, phi nodes merging a
+	// single value are copies too.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ir_propagate_copies(IRGraph& graph)
+	{
+		std::vector<Int32> copy_of(graph.fFunction.RegisterLimit(), kIRNoRegister);
+		bool changed = false;
+
+		for (auto& block : graph.fBlocks)
+		{
+			for (auto phi = block.fPhis.begin(); phi != block.fPhis.end();)
+			{
+				Int32 value = kIRNoRegister;
+				bool single = true;
+
+				for (auto arg : phi->fArgs)
+				{
+					if (arg == phi->fDst ||
+						arg == value)
+						continue;
+
+					single = value == kIRNoRegister;
+					value = arg;
+				}
+
+				if (!single ||
+					value == kIRNoRegister)
+				{
+					++phi;
+					continue;
+				}
+
+				copy_of[phi->fDst] = value;
+				phi = block.fPhis.erase(phi);
+
+				changed = true;
+			}
+
+			for (auto& instr : block.fCode)
+			{
+				// values of machine registers change behind our back, r31 after each call.
+				if (instr.fOpcode != kIRMove ||
+					instr.fDst < kIRVirtualRegister ||
+					instr.fSrc < kIRVirtualRegister)
+					continue;
+
+				copy_of[instr.fDst] = instr.fSrc;
+				instr.fOpcode = kIRNop;
+
+				changed = true;
+			}
+
+			block.fCode.erase(std::remove_if(block.fCode.begin(), block.fCode.end(), [](const IRInstr& instr) {
+				return instr.fOpcode == kIRNop;
+			}), block.fCode.end());
+		}
+
+		if (!changed)
+			return false;
+
+		auto resolve = [&](Int32 reg) {
+			auto root = reg;
+
+			while (root >= kIRVirtualRegister &&
+				   copy_of[root] != kIRNoRegister)
+				root = copy_of[root];
+
+			while (reg >= kIRVirtualRegister &&
+				   copy_of[reg] != kIRNoRegister)
+			{
+				auto next = copy_of[reg];
+				copy_of[reg] = root;
+				reg = next;
+			}
+
+			return root;
+		};
+
+		for (auto& block : graph.fBlocks)
+		{
+			for (auto& phi : block.fPhis)
+			{
+				for (auto& arg : phi.fArgs)
+					arg = resolve(arg);
+			}
+
+			for (auto& instr : block.fCode)
+				ir_for_each_use(instr, [&](Int32& reg) { reg = resolve(reg); });
+		}
+
+		return true;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name ir_eliminate_common_subexpressions
+	// @brief A pure computation dominated by the same one reuses its value.
+	// Loads are reused within a block, until something may write memory.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ir_eliminate_common_subexpressions(IRGraph& graph)
+	{
+		auto order = graph.Order();
+
+		std::vector<std::vector<SizeType>> children(graph.fBlocks.size());
+
+		for (SizeType index = 1; index < order.size(); ++index)
+			children[graph.fBlocks[order[index]].fDominator].push_back(order[index]);
+
+		auto key_of = [](const IRInstr& instr) {
+			auto lhs = instr.fSrc;
+			auto rhs = instr.fSrc2;
+
+			if (instr.fOpcode == kIRArith &&
+				ir_is_commutative(instr.fMnemonic) &&
+				lhs > rhs)
+				std::swap(lhs, rhs);
+
+			return std::to_string(instr.fOpcode) + ":" + instr.fMnemonic + ":" + std::to_string(lhs) + ":" +
+				   std::to_string(rhs) + ":" + std::to_string(instr.fImm) + ":" + std::to_string(instr.fWidth) + ":" +
+				   instr.fSymbol;
+		};
+
+		std::unordered_map<std::string, Int32> available;
+		std::vector<std::string> scope;
+
+		bool changed = false;
+
+		std::vector<std::pair<SizeType, SizeType>> walk{ { 0, SIZE_MAX } };
+
+		while (!walk.empty())
+		{
+			auto [index, mark] = walk.back();
+			walk.pop_back();
+
+			if (mark != SIZE_MAX)
+			{
+				while (scope.size() > mark)
+				{
+					available.erase(scope.back());
+					scope.pop_back();
+				}
+
+				continue;
+			}
+
+			walk.emplace_back(index, scope.size());
+
+			std::unordered_map<std::string, Int32> loads;
+
+			for (auto& instr : graph.fBlocks[index].fCode)
+			{
+				switch (instr.fOpcode)
+				{
+				case kIRConstant:
+				case kIRAddress:
+				case kIRFrameAddress:
+				case kIRArith:
+				case kIRArithImm:
+				case kIRUnary:
+				{
+					if (instr.fDst < kIRVirtualRegister)
+						break;
+
+					auto key = key_of(instr);
+					auto it = available.find(key);
+
+					if (it != available.end())
+					{
+						instr = { .fOpcode = kIRMove, .fDst = instr.fDst, .fSrc = it->second };
+						changed = true;
+
+						break;
+					}
+
+					available[key] = instr.fDst;
+					scope.push_back(key);
+
+					break;
+				}
+				case kIRLoad:
+				{
+					auto key = std::to_string(instr.fSrc) + ":" + std::to_string(instr.fImm) + ":" + std::to_string(instr.fWidth);
+					auto it = loads.find(key);
+
+					if (it != loads.end())
+					{
+						instr = { .fOpcode = kIRMove, .fDst = instr.fDst, .fSrc = it->second };
+						changed = true;
+
+						break;
+					}
+
+					if (instr.fDst >= kIRVirtualRegister)
+						loads[key] = instr.fDst;
+
+					break;
+				}
+				case kIRStore:
+				{
+					loads.clear();
+
+					// what was stored is what a load there would give, bytes are truncated though.
+					if (instr.fWidth == kIRWordSize &&
+						instr.fSrc >= kIRVirtualRegister)
+						loads[std::to_string(instr.fSrc2) + ":" + std::to_string(instr.fImm) + ":" + std::to_string(instr.fWidth)] = instr.fSrc;
+
+					break;
+				}
+				case kIRCall:
+				case kIRCallEnd:
+				{
+					loads.clear();
+					break;
+				}
+				default:
+					break;
+				}
+			}
+
+			for (auto it = children[index].rbegin(); it != children[index].rend(); ++it)
+				walk.emplace_back(*it, SIZE_MAX);
+		}
+
+		return changed;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name ir_eliminate_dead_code
+	// @brief Pure instructions and phi nodes whose value nobody reads go away.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ir_eliminate_dead_code(IRGraph& graph)
+	{
+		std::vector<SizeType> uses(graph.fFunction.RegisterLimit(), 0);
+
+		auto count = [&](Int32 reg) {
+			if (reg >= kIRVirtualRegister)
+				++uses[reg];
+		};
+
+		for (auto& block : graph.fBlocks)
+		{
+			for (auto& phi : block.fPhis)
+			{
+				for (auto arg : phi.fArgs)
+					count(arg);
+			}
+
+			for (auto& instr : block.fCode)
+				ir_for_each_use(instr, count);
+		}
+
+		auto release = [&](Int32& reg) {
+			if (reg >= kIRVirtualRegister)
+				--uses[reg];
+		};
+
+		bool changed = false;
+
+		for (bool again = true; again;)
+		{
+			again = false;
+
+			for (auto& block : graph.fBlocks)
+			{
+				for (auto phi = block.fPhis.begin(); phi != block.fPhis.end();)
+				{
+					// a phi node read only by itself is dead too.
+					auto self = (SizeType)std::count(phi->fArgs.begin(), phi->fArgs.end(), phi->fDst);
+
+					if (uses[phi->fDst] > self)
+					{
+						++phi;
+						continue;
+					}
+
+					for (auto& arg : phi->fArgs)
+						release(arg);
+
+					phi = block.fPhis.erase(phi);
+					again = changed = true;
+				}
+
+				for (auto it = block.fCode.rbegin(); it != block.fCode.rend(); ++it)
+				{
+					if (!ir_is_pure(*it) ||
+						uses[it->fDst] > 0)
+						continue;
+
+					ir_for_each_use(*it, release);
+
+					it->fOpcode = kIRNop;
+					it->fDst = kIRNoRegister;
+
+					again = changed = true;
+				}
+
+				block.fCode.erase(std::remove_if(block.fCode.begin(), block.fCode.end(), [](const IRInstr& instr) {
+					return instr.fOpcode == kIRNop;
+				}), block.fCode.end());
+			}
+		}
+
+		return changed;
+	}
+
+	/// @brief add instr to the end of block, before the jump or branch ending it.
+	static void ir_append(IRBlock& block, const IRInstr& instr)
+	{
+		auto at = block.fCode.end();
+
+		if (!block.fCode.empty() &&
+			(block.fCode.back().fOpcode == kIRBranch ||
+			 block.fCode.back().fOpcode == kIRJump ||
+			 block.fCode.back().fOpcode == kIRJumpTable ||
+			 block.fCode.back().fOpcode == kIRReturn))
+			--at;
+
+		block.fCode.insert(at, instr);
+	}
+
+	/// @brief registers defined in loop, by phi nodes or instructions.
+	static std::vector<bool> ir_loop_defs(IRGraph& graph, const IRLoop& loop)
+	{
+		std::vector<bool> defined(graph.fFunction.RegisterLimit(), false);
+
+		for (auto index : loop.fBlocks)
+		{
+			for (auto& phi : graph.fBlocks[index].fPhis)
+				defined[phi.fDst] = true;
+
+			for (auto& instr : graph.fBlocks[index].fCode)
+			{
+				if (auto dst = ir_def(instr);
+					dst >= kIRVirtualRegister)
+					defined[dst] = true;
+			}
+		}
+
+		return defined;
+	}
+
+	/// @brief instructions of loop computing the same value on every trip, block and
+	/// index of each, in an order they may run in. Loads stay, a store in the loop
+	/// or in a callee may change what they read, and so do divisions, which may trap
+	/// on a trip the loop would not make. Constants and addresses only come along
+	/// for the computations reading them, everywhere else they are rematerialized anyway.
+	static std::vector<std::pair<SizeType, SizeType>> ir_loop_invariants(IRGraph& graph, const IRLoop& loop)
+	{
+		auto variant = ir_loop_defs(graph, loop);
+		std::vector<std::pair<SizeType, SizeType>> found;
+
+		for (auto index : loop.fBlocks)
+		{
+			auto& code = graph.fBlocks[index].fCode;
+
+			for (SizeType at = 0; at < code.size(); ++at)
+			{
+				auto instr = code[at];
+
+				if (!ir_is_pure(instr) ||
+					instr.fOpcode == kIRLoad ||
+					instr.fMnemonic == "div" ||
+					instr.fMnemonic == "mod")
+					continue;
+
+				bool invariant = true;
+
+				ir_for_each_use(instr, [&](Int32& reg) {
+					if (reg != kAsmZeroRegister &&
+						(reg < kIRVirtualRegister || variant[reg]))
+						invariant = false;
+				});
+
+				if (!invariant)
+					continue;
+
+				variant[instr.fDst] = false;
+				found.emplace_back(index, at);
+			}
+		}
+
+		std::vector<bool> needed(graph.fFunction.RegisterLimit(), false);
+		std::vector<std::pair<SizeType, SizeType>> hoisted;
+
+		for (auto it = found.rbegin(); it != found.rend(); ++it)
+		{
+			auto instr = graph.fBlocks[it->first].fCode[it->second];
+
+			if ((instr.fOpcode == kIRConstant || instr.fOpcode == kIRAddress || instr.fOpcode == kIRFrameAddress) &&
+				!needed[instr.fDst])
+				continue;
+
+			ir_for_each_use(instr, [&](Int32& reg) {
+				if (reg >= kIRVirtualRegister)
+					needed[reg] = true;
+			});
+
+			hoisted.push_back(*it);
+		}
+
+		std::reverse(hoisted.begin(), hoisted.end());
+
+		return hoisted;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name ir_hoist_invariants
+	// @brief Loop invariant code motion, what computes the same value on every
+	// trip moves to the preheader of its loop. Outer loops go first, what stays
+	// in an inner loop is still invariant there goes to the inner preheader.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ir_hoist_invariants(IRGraph& graph)
+	{
+		bool changed = false;
+
+		for (;;)
+		{
+			auto loops = graph.Loops();
+			auto it = std::find_if(loops.begin(), loops.end(), [&](const IRLoop& loop) {
+				return !ir_loop_invariants(graph, loop).empty();
+			});
+
+			if (it == loops.end())
+				break;
+
+			// a new preheader moves blocks around, the loops are found again then.
+			auto blocks = graph.fBlocks.size();
+			auto pre = graph.Preheader(*it);
+
+			changed = true;
+
+			if (graph.fBlocks.size() != blocks)
+				continue;
+
+			for (auto [index, at] : ir_loop_invariants(graph, *it))
+			{
+				ir_append(graph.fBlocks[pre], graph.fBlocks[index].fCode[at]);
+				graph.fBlocks[index].fCode[at].fOpcode = kIRNop;
+			}
+
+			for (auto index : it->fBlocks)
+			{
+				auto& code = graph.fBlocks[index].fCode;
+
+				code.erase(std::remove_if(code.begin(), code.end(), [](const IRInstr& instr) {
+					return instr.fOpcode == kIRNop;
+				}), code.end());
+			}
+		}
+
+		return changed;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name ir_reduce_strength
+	// @brief Induction variable strength reduction.
+	// A header phi node stepping by a constant on the back edge is a basic
+	// induction variable, iv. iv * c, iv << c and iv + inv, inv being invariant,
+	// become induction variables of their own, set up in the preheader and
+	// stepped on the back edge, so the loop adds where it multiplied.
+	// An induction variable nothing but its step reads goes away then.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ir_reduce_strength(IRGraph& graph)
+	{
+		// registers any block may recompute, by their definition.
+		std::unordered_map<Int32, IRInstr> sources;
+
+		for (auto& block : graph.fBlocks)
+		{
+			for (auto& instr : block.fCode)
+			{
+				if ((instr.fOpcode == kIRConstant || instr.fOpcode == kIRAddress || instr.fOpcode == kIRFrameAddress) &&
+					instr.fDst >= kIRVirtualRegister)
+					sources[instr.fDst] = instr;
+			}
+		}
+
+		bool changed = false;
+
+		for (auto& loop : graph.Loops())
+		{
+			auto& header = graph.fBlocks[loop.fHeader];
+
+			if (loop.fLatches.size() != 1 ||
+				header.fPredecessors.size() != 2)
+				continue;
+
+			auto latch = loop.fLatches[0];
+			SizeType back = header.fPredecessors[0] == latch ? 0 : 1;
+			auto pre = header.fPredecessors[1 - back];
+
+			if (graph.fBlocks[pre].fSuccessors.size() != 1)
+				continue;
+
+			auto variant = ir_loop_defs(graph, loop);
+
+			std::unordered_map<Int32, const IRInstr*> defs;
+
+			for (auto index : loop.fBlocks)
+			{
+				for (auto& instr : graph.fBlocks[index].fCode)
+				{
+					if (ir_def(instr) >= kIRVirtualRegister)
+						defs[instr.fDst] = &instr;
+				}
+			}
+
+			// the step of each basic induction variable, and where it starts.
+			std::unordered_map<Int32, std::pair<Int64, Int32>> ivs;
+
+			for (auto& phi : header.fPhis)
+			{
+				auto it = defs.find(phi.fArgs[back]);
+
+				if (it != defs.end() &&
+					it->second->fOpcode == kIRArithImm &&
+					it->second->fSrc == phi.fDst)
+					ivs[phi.fDst] = { it->second->fImm, phi.fArgs[1 - back] };
+			}
+
+			if (ivs.empty())
+				continue;
+
+			// what an operand is in the preheader, kIRNoRegister if it is not there.
+			auto available = [&](Int32 reg) {
+				if (reg >= kIRVirtualRegister &&
+					!variant[reg])
+					return reg;
+
+				auto it = sources.find(reg);
+
+				if (it == sources.end())
+					return (Int32)kIRNoRegister;
+
+				auto copy = it->second;
+				copy.fDst = graph.NewRegister(graph.TypeOf(reg));
+
+				ir_append(graph.fBlocks[pre], copy);
+
+				return copy.fDst;
+			};
+
+			struct IRDerived final
+			{
+				SizeType fBlock{ 0 };
+				SizeType fAt{ 0 };
+				Int32 fBase{ kIRNoRegister };
+				Int32 fOperand{ kIRNoRegister };
+				Int64 fFactor{ 1 };
+			};
+
+			std::vector<IRDerived> derived;
+
+			for (auto index : loop.fBlocks)
+			{
+				auto& code = graph.fBlocks[index].fCode;
+
+				for (SizeType at = 0; at < code.size(); ++at)
+				{
+					auto& instr = code[at];
+
+					if (instr.fOpcode != kIRArith ||
+						instr.fDst < kIRVirtualRegister)
+						continue;
+
+					auto lhs = instr.fSrc;
+					auto rhs = instr.fSrc2;
+
+					if (!ivs.count(lhs) &&
+						ir_is_commutative(instr.fMnemonic))
+						std::swap(lhs, rhs);
+
+					if (!ivs.count(lhs))
+						continue;
+
+					auto constant = sources.find(rhs);
+
+					if (constant != sources.end() &&
+						constant->second.fOpcode != kIRConstant)
+						constant = sources.end();
+
+					if (instr.fMnemonic == "mul" &&
+						constant != sources.end())
+						derived.push_back({ .fBlock = index, .fAt = at, .fBase = lhs, .fFactor = constant->second.fImm });
+					else if (instr.fMnemonic == "shl" &&
+							 constant != sources.end() &&
+							 constant->second.fImm >= 0 &&
+							 constant->second.fImm < 63)
+						derived.push_back({ .fBlock = index, .fAt = at, .fBase = lhs, .fFactor = (Int64)1 << constant->second.fImm });
+					else if (instr.fMnemonic == "add" &&
+							 rhs != lhs &&
+							 (rhs == kAsmZeroRegister || (rhs >= kIRVirtualRegister && !variant[rhs]) || sources.count(rhs)))
+						derived.push_back({ .fBlock = index, .fAt = at, .fBase = lhs, .fOperand = rhs });
+				}
+			}
+
+			for (auto& use : derived)
+			{
+				auto [step, init] = ivs[use.fBase];
+				auto type = graph.TypeOf(graph.fBlocks[use.fBlock].fCode[use.fAt].fDst);
+
+				auto start = graph.NewRegister(type);
+
+				if (use.fOperand == kIRNoRegister)
+				{
+					auto factor = graph.NewRegister(kIRTypeWord);
+
+					ir_append(graph.fBlocks[pre], { .fOpcode = kIRConstant, .fDst = factor, .fImm = use.fFactor });
+					ir_append(graph.fBlocks[pre], { .fOpcode = kIRArith, .fMnemonic = "mul", .fDst = start, .fSrc = init, .fSrc2 = factor });
+
+					step = (Int64)((UInt64)step * (UInt64)use.fFactor);
+				}
+				else
+				{
+					auto operand = use.fOperand == kAsmZeroRegister ? kAsmZeroRegister : available(use.fOperand);
+					ir_append(graph.fBlocks[pre], { .fOpcode = kIRArith, .fMnemonic = "add", .fDst = start, .fSrc = init, .fSrc2 = operand });
+				}
+
+				auto value = graph.NewRegister(type);
+				auto next = graph.NewRegister(type);
+
+				ir_append(graph.fBlocks[latch], { .fOpcode = kIRArithImm, .fMnemonic = "add", .fDst = next, .fSrc = value, .fImm = step });
+
+				IRPhi phi{ .fDst = value, .fArgs = { start, start } };
+				phi.fArgs[back] = next;
+
+				header.fPhis.push_back(phi);
+
+				auto& instr = graph.fBlocks[use.fBlock].fCode[use.fAt];
+				instr = { .fOpcode = kIRMove, .fDst = instr.fDst, .fSrc = value };
+
+				changed = true;
+			}
+
+			if (derived.empty())
+				continue;
+
+			// basic induction variables read by their step alone.
+			std::vector<SizeType> uses(graph.fFunction.RegisterLimit(), 0);
+
+			for (auto& block : graph.fBlocks)
+			{
+				for (auto& other : block.fPhis)
+				{
+					for (auto arg : other.fArgs)
+					{
+						if (arg >= kIRVirtualRegister)
+							++uses[arg];
+					}
+				}
+
+				for (auto& instr : block.fCode)
+				{
+					ir_for_each_use(instr, [&](Int32& reg) {
+						if (reg >= kIRVirtualRegister)
+							++uses[reg];
+					});
+				}
+			}
+
+			for (auto phi = header.fPhis.begin(); phi != header.fPhis.end();)
+			{
+				if (!ivs.count(phi->fDst) ||
+					uses[phi->fDst] != 1 ||
+					uses[phi->fArgs[back]] != 1)
+				{
+					++phi;
+					continue;
+				}
+
+				for (auto index : loop.fBlocks)
+				{
+					auto& code = graph.fBlocks[index].fCode;
+
+					code.erase(std::remove_if(code.begin(), code.end(), [&](const IRInstr& instr) {
+						return instr.fOpcode == kIRArithImm &&
+							   instr.fDst == phi->fArgs[back];
+					}), code.end());
+				}
+
+				phi = header.fPhis.erase(phi);
+			}
+		}
+
+		return changed;
+	}
+
+	/// @brief an inner loop with a single back edge, left by a single edge to a block
+	/// nothing else leads to, small enough to be copied.
+	static bool ir_can_unroll(IRGraph& graph, const std::vector<IRLoop>& loops, const IRLoop& loop, std::pair<SizeType, SizeType>& exit)
+	{
+		auto inside = [&](SizeType block) {
+			return std::find(loop.fBlocks.begin(), loop.fBlocks.end(), block) != loop.fBlocks.end();
+		};
+
+		if (loop.fLatches.size() != 1 ||
+			graph.fBlocks[loop.fHeader].fLabel.empty())
+			return false;
+
+		for (auto& other : loops)
+		{
+			if (other.fHeader != loop.fHeader &&
+				inside(other.fHeader))
+				return false;
+		}
+
+		SizeType size = 0;
+		SizeType exits = 0;
+
+		for (auto index : loop.fBlocks)
+		{
+			auto& block = graph.fBlocks[index];
+
+			for (auto& instr : block.fCode)
+			{
+				if (instr.fOpcode == kIRJumpTable)
+					return false;
+			}
+
+			size += block.fCode.size();
+
+			for (auto succ : block.fSuccessors)
+			{
+				if (inside(succ))
+					continue;
+
+				exit = { index, succ };
+				++exits;
+			}
+		}
+
+		return size <= kIRUnrollSize &&
+			   exits == 1 &&
+			   graph.fBlocks[exit.second].fPredecessors.size() == 1;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name ir_unroll_loops
+	// @brief Lays fFunction.fUnroll copies of a small inner loop back to back.
+	// Each copy keeps its exit test, so nothing needs the trip count, but the
+	// copies fall into each other and only the last one jumps back to the header.
+	// In the copies the header's phi nodes become copies of what the previous
+	// copy computed, and the exit block gets phi nodes for what leaves the loop.
+	// Copies of a call share its save set. An unrolled loop has several exits,
+	// so it is never unrolled again.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ir_unroll_loops(IRGraph& graph)
+	{
+		const SizeType factor = graph.fFunction.fUnroll;
+
+		if (factor < 2)
+			return false;
+
+		bool changed = false;
+
+		for (;;)
+		{
+			auto loops = graph.Loops();
+			std::pair<SizeType, SizeType> exit;
+
+			auto it = std::find_if(loops.begin(), loops.end(), [&](const IRLoop& loop) {
+				return ir_can_unroll(graph, loops, loop, exit);
+			});
+
+			if (it == loops.end())
+				break;
+
+			auto& loop = *it;
+			auto header = loop.fHeader;
+			auto latch = loop.fLatches[0];
+			auto count = loop.fBlocks.size();
+			auto base = *std::max_element(loop.fBlocks.begin(), loop.fBlocks.end()) + 1;
+
+			graph.Insert(base, count * (factor - 1));
+
+			auto target = exit.second >= base ? exit.second + count * (factor - 1) : exit.second;
+
+			std::unordered_map<SizeType, SizeType> position;
+
+			for (SizeType at = 0; at < count; ++at)
+				position[loop.fBlocks[at]] = at;
+
+			// block and register of each copy, the 0th being the loop itself.
+			auto block_of = [&](SizeType copy, SizeType block) {
+				return copy == 0 ? block : base + (copy - 1) * count + position[block];
+			};
+
+			std::vector<std::unordered_map<Int32, Int32>> registers(factor);
+			std::vector<std::unordered_map<std::string, std::string>> labels(factor);
+
+			for (SizeType copy = 1; copy < factor; ++copy)
+			{
+				for (auto index : loop.fBlocks)
+				{
+					auto& block = graph.fBlocks[index];
+
+					for (auto& phi : block.fPhis)
+						registers[copy][phi.fDst] = graph.NewRegister(graph.TypeOf(phi.fDst));
+
+					for (auto& instr : block.fCode)
+					{
+						if (auto dst = ir_def(instr);
+							dst >= kIRVirtualRegister)
+							registers[copy][dst] = graph.NewRegister(graph.TypeOf(dst));
+					}
+
+					if (!block.fLabel.empty())
+						labels[copy][block.fLabel] = graph.NewLabel();
+				}
+			}
+
+			auto reg_of = [&](SizeType copy, Int32 reg) {
+				auto it = registers[copy].find(reg);
+				return it == registers[copy].end() ? reg : it->second;
+			};
+
+			// the back edge of each copy goes to the next one, the last one's to the header.
+			auto next_header = [&](SizeType copy) {
+				return copy + 1 < factor ? block_of(copy + 1, header) : header;
+			};
+
+			auto& entry = graph.fBlocks[header];
+			SizeType back = std::find(entry.fPredecessors.begin(), entry.fPredecessors.end(), latch) - entry.fPredecessors.begin();
+
+			auto leaving = std::find(graph.fBlocks[target].fPredecessors.begin(), graph.fBlocks[target].fPredecessors.end(), exit.first) -
+						   graph.fBlocks[target].fPredecessors.begin();
+
+			for (SizeType copy = 1; copy < factor; ++copy)
+			{
+				for (auto index : loop.fBlocks)
+				{
+					auto& block = graph.fBlocks[index];
+					auto& made = graph.fBlocks[block_of(copy, index)];
+
+					made.fLabel = block.fLabel.empty() ? "" : labels[copy][block.fLabel];
+
+					if (index == header)
+					{
+						for (auto& phi : block.fPhis)
+							made.fCode.push_back({ .fOpcode = kIRMove, .fDst = reg_of(copy, phi.fDst), .fSrc = reg_of(copy - 1, phi.fArgs[back]) });
+
+						made.fPredecessors.push_back(block_of(copy - 1, latch));
+					}
+					else
+					{
+						for (auto& phi : block.fPhis)
+						{
+							IRPhi same{ .fDst = reg_of(copy, phi.fDst) };
+
+							for (auto arg : phi.fArgs)
+								same.fArgs.push_back(reg_of(copy, arg));
+
+							made.fPhis.push_back(same);
+						}
+
+						for (auto pred : block.fPredecessors)
+							made.fPredecessors.push_back(block_of(copy, pred));
+					}
+
+					for (auto instr : block.fCode)
+					{
+						if (ir_def(instr) >= kIRVirtualRegister)
+							instr.fDst = reg_of(copy, instr.fDst);
+
+						ir_for_each_use(instr, [&](Int32& reg) { reg = reg_of(copy, reg); });
+
+						if (instr.fOpcode == kIRBranch ||
+							instr.fOpcode == kIRJump)
+						{
+							if (instr.fSymbol == entry.fLabel)
+								instr.fSymbol = copy + 1 < factor ? labels[copy + 1][entry.fLabel] : entry.fLabel;
+							else if (labels[copy].count(instr.fSymbol))
+								instr.fSymbol = labels[copy][instr.fSymbol];
+						}
+
+						made.fCode.push_back(instr);
+					}
+
+					for (auto succ : block.fSuccessors)
+					{
+						if (succ == header)
+						{
+							made.fSuccessors.push_back(next_header(copy));
+						}
+						else if (succ == target)
+						{
+							made.fSuccessors.push_back(target);
+							graph.fBlocks[target].fPredecessors.push_back(block_of(copy, index));
+
+							for (auto& phi : graph.fBlocks[target].fPhis)
+								phi.fArgs.push_back(reg_of(copy, phi.fArgs[leaving]));
+						}
+						else
+						{
+							made.fSuccessors.push_back(block_of(copy, succ));
+						}
+					}
+				}
+			}
+
+			// the loop itself goes on to the first copy, the header is entered from the last.
+			auto& last = graph.fBlocks[latch];
+
+			std::replace(last.fSuccessors.begin(), last.fSuccessors.end(), header, block_of(1, header));
+
+			if (!last.fCode.empty() &&
+				(last.fCode.back().fOpcode == kIRBranch || last.fCode.back().fOpcode == kIRJump) &&
+				last.fCode.back().fSymbol == entry.fLabel)
+				last.fCode.back().fSymbol = labels[1][entry.fLabel];
+
+			entry.fPredecessors[back] = block_of(factor - 1, latch);
+
+			for (auto& phi : entry.fPhis)
+				phi.fArgs[back] = reg_of(factor - 1, phi.fArgs[back]);
+
+			// what the loop computes and the code after it reads comes from whichever copy left.
+			std::vector<bool> copied(graph.fBlocks.size(), false);
+
+			for (auto index : loop.fBlocks)
+			{
+				for (SizeType copy = 0; copy < factor; ++copy)
+					copied[block_of(copy, index)] = true;
+			}
+
+			std::unordered_map<Int32, Int32> merged;
+
+			auto merge = [&](Int32& reg) {
+				if (!registers[1].count(reg))
+					return;
+
+				auto it = merged.find(reg);
+
+				if (it == merged.end())
+				{
+					IRPhi phi{ .fDst = graph.NewRegister(graph.TypeOf(reg)) };
+
+					for (auto pred : graph.fBlocks[target].fPredecessors)
+					{
+						SizeType copy = 0;
+
+						while (block_of(copy, exit.first) != pred)
+							++copy;
+
+						phi.fArgs.push_back(reg_of(copy, reg));
+					}
+
+					graph.fBlocks[target].fPhis.push_back(phi);
+					it = merged.emplace(reg, phi.fDst).first;
+				}
+
+				reg = it->second;
+			};
+
+			for (SizeType index = 0; index < graph.fBlocks.size(); ++index)
+			{
+				auto& block = graph.fBlocks[index];
+
+				if (copied[index] ||
+					!block.fLive)
+					continue;
+
+				// the exit block's phi nodes have an argument per copy already.
+				if (index != target)
+				{
+					for (auto& phi : block.fPhis)
+					{
+						for (auto& arg : phi.fArgs)
+							merge(arg);
+					}
+				}
+
+				for (auto& instr : block.fCode)
+					ir_for_each_use(instr, merge);
+			}
+
+			changed = true;
+		}
+
+		return changed;
+	}
+}
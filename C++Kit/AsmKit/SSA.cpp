@@ -0,0 +1,1322 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#include <AsmKit/SSA.hpp>
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+//! @file SSA.cpp
+//! @brief SSA construction and destruction.
+
+namespace CxxKit
+{
+	IRGraph::IRGraph(IRFunction& function, bool promote)
+		: fFunction(function)
+	{
+		auto& code = fFunction.fCode;
+
+		// basic blocks, they start at labels and right after jumps.
+		// The entry block never starts at a label, so that nothing jumps to it.
+		std::unordered_map<std::string, SizeType> labels;
+
+		fBlocks.emplace_back();
+
+		for (SizeType index = 0; index < code.size(); ++index)
+		{
+			auto& instr = code[index];
+
+			if (instr.fOpcode == kIRLabel)
+			{
+				fBlocks.emplace_back();
+				fBlocks.back().fLabel = instr.fSymbol;
+
+				labels[instr.fSymbol] = fBlocks.size() - 1;
+				continue;
+			}
+
+			fBlocks.back().fCode.push_back(instr);
+
+			if ((instr.fOpcode == kIRBranch ||
+				 instr.fOpcode == kIRJump ||
+				 instr.fOpcode == kIRJumpTable ||
+				 instr.fOpcode == kIRReturn) &&
+				index + 1 < code.size() &&
+				code[index + 1].fOpcode != kIRLabel)
+				fBlocks.emplace_back();
+		}
+
+		for (SizeType index = 0; index < fBlocks.size(); ++index)
+		{
+			auto& block = fBlocks[index];
+			auto next = index + 1 < fBlocks.size() ? index + 1 : SIZE_MAX;
+
+			if (!block.fCode.empty() &&
+				(block.fCode.back().fOpcode == kIRBranch ||
+				 block.fCode.back().fOpcode == kIRJump))
+			{
+				auto target = labels[block.fCode.back().fSymbol];
+
+				// a branch to the next block is no branch at all.
+				if (block.fCode.back().fOpcode == kIRBranch &&
+					target == next)
+					block.fCode.pop_back();
+				else
+					block.fSuccessors.push_back(target);
+			}
+
+			// a jump table goes to each of its blocks, once however many entries lead there.
+			if (!block.fCode.empty() &&
+				block.fCode.back().fOpcode == kIRJumpTable)
+			{
+				for (auto& label : block.fCode.back().fTargets)
+				{
+					if (std::find(block.fSuccessors.begin(), block.fSuccessors.end(), labels[label]) == block.fSuccessors.end())
+						block.fSuccessors.push_back(labels[label]);
+				}
+			}
+
+			if ((block.fCode.empty() ||
+				 (block.fCode.back().fOpcode != kIRJump &&
+				  block.fCode.back().fOpcode != kIRJumpTable &&
+				  block.fCode.back().fOpcode != kIRReturn)) &&
+				next != SIZE_MAX)
+				block.fSuccessors.push_back(next);
+
+			for (auto succ : block.fSuccessors)
+				fBlocks[succ].fPredecessors.push_back(index);
+		}
+
+		fTypes.assign(fFunction.RegisterLimit(), kIRTypeWord);
+
+		this->Prune();
+
+		if (promote)
+			this->Promote();
+
+		this->Rename();
+		this->Type();
+	}
+
+	Int32 IRGraph::NewRegister(Int32 type)
+	{
+		auto reg = fFunction.NewRegister();
+
+		fTypes.resize(fFunction.RegisterLimit(), kIRTypeWord);
+		fTypes[reg] = type;
+
+		return reg;
+	}
+
+	Int32 IRGraph::TypeOf(Int32 reg) const
+	{
+		if (reg < kIRVirtualRegister ||
+			reg >= (Int32)fTypes.size())
+			return kIRTypeWord;
+
+		return fTypes[reg];
+	}
+
+	std::string IRGraph::NewLabel()
+	{
+		return fFunction.fLabelPrefix + std::to_string(fLabelCount++);
+	}
+
+	void IRGraph::RemoveEdge(SizeType block, SizeType succ)
+	{
+		auto& preds = fBlocks[succ].fPredecessors;
+		auto at = std::find(preds.begin(), preds.end(), block);
+
+		if (at == preds.end())
+			return;
+
+		for (auto& phi : fBlocks[succ].fPhis)
+			phi.fArgs.erase(phi.fArgs.begin() + (at - preds.begin()));
+
+		preds.erase(at);
+
+		auto& succs = fBlocks[block].fSuccessors;
+		succs.erase(std::find(succs.begin(), succs.end(), succ));
+	}
+
+	bool IRGraph::Prune()
+	{
+		std::vector<bool> reached(fBlocks.size(), false);
+		std::vector<SizeType> work{ 0 };
+
+		reached[0] = true;
+
+		while (!work.empty())
+		{
+			auto block = work.back();
+			work.pop_back();
+
+			for (auto succ : fBlocks[block].fSuccessors)
+			{
+				if (!reached[succ])
+				{
+					reached[succ] = true;
+					work.push_back(succ);
+				}
+			}
+		}
+
+		bool changed = false;
+
+		for (SizeType index = 0; index < fBlocks.size(); ++index)
+		{
+			if (reached[index] ||
+				!fBlocks[index].fLive)
+				continue;
+
+			while (!fBlocks[index].fSuccessors.empty())
+				this->RemoveEdge(index, fBlocks[index].fSuccessors.back());
+
+			fBlocks[index].fLive = false;
+			fBlocks[index].fCode.clear();
+			fBlocks[index].fPhis.clear();
+
+			changed = true;
+		}
+
+		return changed;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Order
+	// @brief Dominators, after Cooper, Harvey and Kennedy.
+	// Live blocks are numbered in reverse post order, then each immediate
+	// dominator is the meet of its predecessors' until nothing changes.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	std::vector<SizeType> IRGraph::Order()
+	{
+		std::vector<SizeType> post;
+		std::vector<bool> seen(fBlocks.size(), false);
+		std::vector<std::pair<SizeType, SizeType>> stack{ { 0, 0 } };
+
+		seen[0] = true;
+
+		while (!stack.empty())
+		{
+			auto& [block, next] = stack.back();
+
+			if (next < fBlocks[block].fSuccessors.size())
+			{
+				auto succ = fBlocks[block].fSuccessors[next++];
+
+				if (!seen[succ])
+				{
+					seen[succ] = true;
+					stack.emplace_back(succ, 0);
+				}
+
+				continue;
+			}
+
+			post.push_back(block);
+			stack.pop_back();
+		}
+
+		std::vector<SizeType> order(post.rbegin(), post.rend());
+		std::vector<SizeType> number(fBlocks.size(), SIZE_MAX);
+
+		for (SizeType index = 0; index < order.size(); ++index)
+			number[order[index]] = index;
+
+		for (auto& block : fBlocks)
+			block.fDominator = SIZE_MAX;
+
+		fBlocks[0].fDominator = 0;
+
+		auto meet = [&](SizeType lhs, SizeType rhs) {
+			while (lhs != rhs)
+			{
+				while (number[lhs] > number[rhs])
+					lhs = fBlocks[lhs].fDominator;
+
+				while (number[rhs] > number[lhs])
+					rhs = fBlocks[rhs].fDominator;
+			}
+
+			return lhs;
+		};
+
+		for (bool changed = true; changed;)
+		{
+			changed = false;
+
+			for (SizeType index = 1; index < order.size(); ++index)
+			{
+				auto& block = fBlocks[order[index]];
+				auto dominator = SIZE_MAX;
+
+				for (auto pred : block.fPredecessors)
+				{
+					if (fBlocks[pred].fDominator == SIZE_MAX)
+						continue;
+
+					dominator = dominator == SIZE_MAX ? pred : meet(pred, dominator);
+				}
+
+				if (dominator != block.fDominator)
+				{
+					block.fDominator = dominator;
+					changed = true;
+				}
+			}
+		}
+
+		return order;
+	}
+
+	void IRGraph::Insert(SizeType at, SizeType count)
+	{
+		auto shift = [&](SizeType& index) {
+			if (index != SIZE_MAX &&
+				index >= at)
+				index += count;
+		};
+
+		for (auto& block : fBlocks)
+		{
+			for (auto& pred : block.fPredecessors)
+				shift(pred);
+
+			for (auto& succ : block.fSuccessors)
+				shift(succ);
+
+			shift(block.fDominator);
+		}
+
+		fBlocks.insert(fBlocks.begin() + at, count, IRBlock{});
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Loops
+	// @brief An edge to a block dominating its source is a back edge, the
+	// loop of a header is every block reaching one of its back edges backwards
+	// without going through the header. Back edges to the same header make one loop.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	std::vector<IRLoop> IRGraph::Loops()
+	{
+		auto order = this->Order();
+		std::vector<SizeType> number(fBlocks.size(), SIZE_MAX);
+
+		for (SizeType index = 0; index < order.size(); ++index)
+			number[order[index]] = index;
+
+		auto dominates = [&](SizeType lhs, SizeType rhs) {
+			while (rhs != lhs &&
+				   rhs != 0)
+				rhs = fBlocks[rhs].fDominator;
+
+			return rhs == lhs;
+		};
+
+		std::vector<IRLoop> loops;
+		std::vector<SizeType> loop_of(fBlocks.size(), SIZE_MAX);
+
+		for (auto index : order)
+		{
+			for (auto succ : fBlocks[index].fSuccessors)
+			{
+				if (!dominates(succ, index))
+					continue;
+
+				if (loop_of[succ] == SIZE_MAX)
+				{
+					loop_of[succ] = loops.size();
+					loops.push_back({ .fHeader = succ });
+				}
+
+				loops[loop_of[succ]].fLatches.push_back(index);
+			}
+		}
+
+		std::sort(loops.begin(), loops.end(), [&](const IRLoop& lhs, const IRLoop& rhs) {
+			return number[lhs.fHeader] < number[rhs.fHeader];
+		});
+
+		for (auto& loop : loops)
+		{
+			std::vector<bool> inside(fBlocks.size(), false);
+			std::vector<SizeType> work(loop.fLatches);
+
+			inside[loop.fHeader] = true;
+
+			while (!work.empty())
+			{
+				auto block = work.back();
+				work.pop_back();
+
+				if (inside[block])
+					continue;
+
+				inside[block] = true;
+
+				for (auto pred : fBlocks[block].fPredecessors)
+				{
+					if (!inside[pred] &&
+						number[pred] != SIZE_MAX)
+						work.push_back(pred);
+				}
+			}
+
+			for (auto index : order)
+			{
+				if (inside[index])
+					loop.fBlocks.push_back(index);
+			}
+		}
+
+		return loops;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Preheader
+	// @brief A loop entered from a single block, which goes nowhere else, has one.
+	// Otherwise an empty block is laid out right before the header, the edges
+	// from outside the loop go there, and so do the phi arguments they bring.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	SizeType IRGraph::Preheader(const IRLoop& loop)
+	{
+		auto is_latch = [&](SizeType block) {
+			return std::find(loop.fLatches.begin(), loop.fLatches.end(), block) != loop.fLatches.end();
+		};
+
+		std::vector<SizeType> outside;
+
+		for (auto pred : fBlocks[loop.fHeader].fPredecessors)
+		{
+			if (!is_latch(pred))
+				outside.push_back(pred);
+		}
+
+		if (outside.size() == 1 &&
+			fBlocks[outside[0]].fSuccessors.size() == 1)
+			return outside[0];
+
+		auto label = this->NewLabel();
+
+		this->Insert(loop.fHeader, 1);
+
+		auto pre = loop.fHeader;
+		auto header = pre + 1;
+
+		auto& block = fBlocks[header];
+
+		std::vector<SizeType> preds{ pre };
+		std::vector<SizeType> from_outside;
+
+		for (SizeType at = 0; at < block.fPredecessors.size(); ++at)
+		{
+			auto pred = block.fPredecessors[at];
+
+			if (is_latch(pred >= pre ? pred - 1 : pred))
+				preds.push_back(pred);
+			else
+				from_outside.push_back(at);
+		}
+
+		for (auto& phi : block.fPhis)
+		{
+			std::vector<Int32> entering;
+			std::vector<Int32> args;
+
+			for (auto at : from_outside)
+				entering.push_back(phi.fArgs[at]);
+
+			for (SizeType at = 0; at < block.fPredecessors.size(); ++at)
+			{
+				if (std::find(from_outside.begin(), from_outside.end(), at) == from_outside.end())
+					args.push_back(phi.fArgs[at]);
+			}
+
+			auto value = entering[0];
+
+			if (std::any_of(entering.begin(), entering.end(), [&](Int32 arg) { return arg != value; }))
+			{
+				value = this->NewRegister(this->TypeOf(phi.fDst));
+				fBlocks[pre].fPhis.push_back({ .fDst = value, .fArgs = entering });
+			}
+
+			args.insert(args.begin(), value);
+			phi.fArgs = std::move(args);
+		}
+
+		for (auto at : from_outside)
+		{
+			auto pred = block.fPredecessors[at];
+			auto& source = fBlocks[pred];
+
+			std::replace(source.fSuccessors.begin(), source.fSuccessors.end(), header, pre);
+			fBlocks[pre].fPredecessors.push_back(pred);
+
+			if (source.fCode.empty() ||
+				block.fLabel.empty())
+				continue;
+
+			auto& tail = source.fCode.back();
+
+			if ((tail.fOpcode == kIRBranch || tail.fOpcode == kIRJump) &&
+				tail.fSymbol == block.fLabel)
+				tail.fSymbol = label;
+
+			std::replace(tail.fTargets.begin(), tail.fTargets.end(), block.fLabel, label);
+		}
+
+		block.fPredecessors = std::move(preds);
+
+		fBlocks[pre].fLabel = label;
+		fBlocks[pre].fSuccessors.push_back(header);
+
+		return pre;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Promote
+	// @brief Locals and arguments only ever loaded and stored as a whole word,
+	// whose address is never taken, become virtual registers.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	void IRGraph::Promote()
+	{
+		// locals by offset, sized in whole words.
+		std::map<Int64, Int64> locals;
+
+		for (auto& [offset, size] : fFunction.fLocals)
+			locals[offset] = offset + std::max<Int64>((size + kIRWordSize - 1) / kIRWordSize * kIRWordSize, kIRWordSize);
+
+		auto local_of = [&](Int64 offset) -> Int64 {
+			auto it = locals.upper_bound(offset);
+
+			if (it == locals.begin() ||
+				offset >= (--it)->second)
+				return -1;
+
+			return it->first;
+		};
+
+		std::map<Int64, bool> frame, args;
+		bool args_escape = false;
+		bool stray = false;
+
+		for (auto& block : fBlocks)
+		{
+			for (auto& instr : block.fCode)
+			{
+				Int32 base = kIRNoRegister;
+
+				if (instr.fOpcode == kIRLoad)
+					base = instr.fSrc;
+				else if (instr.fOpcode == kIRStore)
+					base = instr.fSrc2;
+				else if (instr.fOpcode == kIRFrameAddress)
+					base = instr.fSrc;
+
+				if (base == kIRArgRegister)
+				{
+					if (instr.fOpcode == kIRFrameAddress)
+					{
+						args_escape = true;
+						continue;
+					}
+
+					auto offset = instr.fImm / kIRWordSize * kIRWordSize;
+					auto whole = instr.fImm % kIRWordSize == 0 && instr.fWidth == kIRWordSize;
+
+					args[offset] = (args.count(offset) ? args[offset] : true) && whole;
+				}
+				else if (base == kIRFrameRegister)
+				{
+					auto offset = local_of(instr.fImm);
+
+					// an address that is no local's, nothing is safe then.
+					if (offset < 0)
+					{
+						if (instr.fOpcode == kIRFrameAddress)
+							return;
+
+						stray = true;
+						continue;
+					}
+
+					auto whole = instr.fOpcode != kIRFrameAddress &&
+								 instr.fImm == offset &&
+								 instr.fWidth == kIRWordSize &&
+								 locals[offset] - offset == kIRWordSize;
+
+					frame[offset] = (frame.count(offset) ? frame[offset] : true) && whole;
+				}
+			}
+		}
+
+		std::map<Int64, Int32> frame_values, arg_values;
+		std::vector<IRInstr> entry;
+
+		for (auto& [offset, whole] : frame)
+		{
+			if (whole)
+				frame_values[offset] = this->NewRegister(kIRTypeWord);
+		}
+
+		for (auto& [offset, whole] : args)
+		{
+			if (!whole ||
+				args_escape)
+				continue;
+
+			arg_values[offset] = this->NewRegister(kIRTypeWord);
+			entry.push_back({ .fOpcode = kIRLoad, .fDst = arg_values[offset], .fSrc = kIRArgRegister, .fImm = offset });
+		}
+
+		for (auto& block : fBlocks)
+		{
+			for (auto& instr : block.fCode)
+			{
+				std::map<Int64, Int32>* values = nullptr;
+
+				if ((instr.fOpcode == kIRLoad && instr.fSrc == kIRFrameRegister) ||
+					(instr.fOpcode == kIRStore && instr.fSrc2 == kIRFrameRegister))
+					values = &frame_values;
+				else if ((instr.fOpcode == kIRLoad && instr.fSrc == kIRArgRegister) ||
+						 (instr.fOpcode == kIRStore && instr.fSrc2 == kIRArgRegister))
+					values = &arg_values;
+
+				if (!values ||
+					!values->count(instr.fImm))
+					continue;
+
+				auto value = (*values)[instr.fImm];
+
+				if (instr.fOpcode == kIRLoad)
+					instr = { .fOpcode = kIRMove, .fDst = instr.fDst, .fSrc = value };
+				else
+					instr = { .fOpcode = kIRMove, .fDst = value, .fSrc = instr.fSrc };
+			}
+		}
+
+		for (auto& [offset, value] : frame_values)
+			fVariables.push_back(value);
+
+		// the locals left in memory are packed together.
+		if (!stray &&
+			!frame_values.empty())
+		{
+			std::map<Int64, Int64> moved;
+			Int64 size = 0;
+
+			for (auto& [offset, end] : locals)
+			{
+				if (frame_values.count(offset))
+					continue;
+
+				moved[offset] = size;
+				size += end - offset;
+			}
+
+			for (auto& block : fBlocks)
+			{
+				for (auto& instr : block.fCode)
+				{
+					if (((instr.fOpcode == kIRLoad || instr.fOpcode == kIRFrameAddress) && instr.fSrc == kIRFrameRegister) ||
+						(instr.fOpcode == kIRStore && instr.fSrc2 == kIRFrameRegister))
+					{
+						auto offset = local_of(instr.fImm);
+						instr.fImm += moved[offset] - offset;
+					}
+				}
+			}
+
+			fFunction.fLocals.clear();
+
+			for (auto& [offset, end] : locals)
+			{
+				if (moved.count(offset))
+					fFunction.fLocals.emplace_back(moved[offset], end - offset);
+			}
+
+			fFunction.fLocalSize = size;
+		}
+
+		for (auto& [offset, value] : arg_values)
+			fVariables.push_back(value);
+
+		fBlocks[0].fCode.insert(fBlocks[0].fCode.begin(), entry.begin(), entry.end());
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Rename
+	// @brief Registers written more than once, promoted locals among them, get
+	// phi nodes on the iterated dominance frontier of their definitions, then a
+	// fresh register per definition, walking the dominator tree.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	void IRGraph::Rename()
+	{
+		const SizeType limit = fFunction.RegisterLimit();
+
+		std::vector<SizeType> defs(limit, 0);
+
+		for (auto& block : fBlocks)
+		{
+			for (auto& instr : block.fCode)
+			{
+				auto def = ir_def(instr);
+
+				if (def >= kIRVirtualRegister)
+					++defs[def];
+			}
+		}
+
+		std::vector<Int64> variable(limit, -1);
+
+		for (auto reg : fVariables)
+			variable[reg] = 0;
+
+		for (SizeType reg = kIRVirtualRegister; reg < limit; ++reg)
+		{
+			if (defs[reg] > 1)
+				variable[reg] = 0;
+		}
+
+		fVariables.clear();
+
+		for (SizeType reg = kIRVirtualRegister; reg < limit; ++reg)
+		{
+			if (variable[reg] == 0)
+			{
+				variable[reg] = fVariables.size();
+				fVariables.push_back(reg);
+			}
+		}
+
+		if (fVariables.empty())
+			return;
+
+		auto order = this->Order();
+
+		// dominance frontiers.
+		std::vector<std::vector<SizeType>> frontier(fBlocks.size());
+
+		for (auto index : order)
+		{
+			auto& block = fBlocks[index];
+
+			if (block.fPredecessors.size() < 2)
+				continue;
+
+			for (auto pred : block.fPredecessors)
+			{
+				for (auto runner = pred; runner != block.fDominator; runner = fBlocks[runner].fDominator)
+				{
+					if (frontier[runner].empty() ||
+						frontier[runner].back() != index)
+						frontier[runner].push_back(index);
+				}
+			}
+		}
+
+		// phi nodes, with the variable each one stands for.
+		std::vector<std::vector<SizeType>> phi_variables(fBlocks.size());
+		std::vector<std::vector<SizeType>> def_blocks(fVariables.size());
+
+		for (auto index : order)
+		{
+			for (auto& instr : fBlocks[index].fCode)
+			{
+				auto def = ir_def(instr);
+
+				if (def >= kIRVirtualRegister &&
+					variable[def] >= 0 &&
+					(def_blocks[variable[def]].empty() ||
+					 def_blocks[variable[def]].back() != index))
+					def_blocks[variable[def]].push_back(index);
+			}
+		}
+
+		std::vector<SizeType> has_phi(fBlocks.size(), SIZE_MAX);
+		std::vector<SizeType> queued(fBlocks.size(), SIZE_MAX);
+
+		for (SizeType var = 0; var < fVariables.size(); ++var)
+		{
+			auto work = def_blocks[var];
+
+			for (auto index : work)
+				queued[index] = var;
+
+			while (!work.empty())
+			{
+				auto index = work.back();
+				work.pop_back();
+
+				for (auto target : frontier[index])
+				{
+					if (has_phi[target] == var)
+						continue;
+
+					has_phi[target] = var;
+
+					fBlocks[target].fPhis.push_back({ .fDst = fVariables[var],
+													  .fArgs = std::vector<Int32>(fBlocks[target].fPredecessors.size(), kIRNoRegister) });
+					phi_variables[target].push_back(var);
+
+					if (queued[target] != var)
+					{
+						queued[target] = var;
+						work.push_back(target);
+					}
+				}
+			}
+		}
+
+		// walk the dominator tree.
+		std::vector<std::vector<SizeType>> children(fBlocks.size());
+
+		for (SizeType index = 1; index < order.size(); ++index)
+			children[fBlocks[order[index]].fDominator].push_back(order[index]);
+
+		std::vector<std::vector<Int32>> stacks(fVariables.size());
+		std::vector<SizeType> pushed;
+		Int32 undefined = kIRNoRegister;
+
+		// reading a local before it is written gives 0.
+		auto current = [&](SizeType var) {
+			if (!stacks[var].empty())
+				return stacks[var].back();
+
+			if (undefined == kIRNoRegister)
+				undefined = this->NewRegister(kIRTypeWord);
+
+			return undefined;
+		};
+
+		auto rename_use = [&](Int32& reg) {
+			if (reg >= kIRVirtualRegister &&
+				reg < (Int32)limit &&
+				variable[reg] >= 0)
+				reg = current(variable[reg]);
+		};
+
+		auto rename_def = [&](Int32& reg) {
+			auto var = variable[reg];
+
+			reg = this->NewRegister(kIRTypeWord);
+
+			stacks[var].push_back(reg);
+			pushed.push_back(var);
+		};
+
+		std::vector<std::pair<SizeType, SizeType>> walk{ { 0, SIZE_MAX } };
+
+		while (!walk.empty())
+		{
+			auto [index, mark] = walk.back();
+			walk.pop_back();
+
+			// leaving the block, its definitions go out of scope.
+			if (mark != SIZE_MAX)
+			{
+				while (pushed.size() > mark)
+				{
+					stacks[pushed.back()].pop_back();
+					pushed.pop_back();
+				}
+
+				continue;
+			}
+
+			walk.emplace_back(index, pushed.size());
+
+			auto& block = fBlocks[index];
+
+			for (SizeType phi = 0; phi < block.fPhis.size(); ++phi)
+			{
+				auto var = phi_variables[index][phi];
+
+				block.fPhis[phi].fDst = this->NewRegister(kIRTypeWord);
+
+				stacks[var].push_back(block.fPhis[phi].fDst);
+				pushed.push_back(var);
+			}
+
+			for (auto& instr : block.fCode)
+			{
+				switch (instr.fOpcode)
+				{
+				case kIRMove:
+				case kIRLoad:
+				case kIRPush:
+				case kIRCall:
+				case kIRJumpTable:
+				case kIRArithImm:
+				case kIRUnary:
+					rename_use(instr.fSrc);
+					break;
+				case kIRStore:
+				case kIRBranch:
+				case kIRArith:
+					rename_use(instr.fSrc);
+					rename_use(instr.fSrc2);
+					break;
+				default:
+					break;
+				}
+
+				auto def = ir_def(instr);
+
+				if (def >= kIRVirtualRegister &&
+					def < (Int32)limit &&
+					variable[def] >= 0)
+					rename_def(instr.fDst);
+			}
+
+			for (auto succ : block.fSuccessors)
+			{
+				auto& target = fBlocks[succ];
+				auto pred = std::find(target.fPredecessors.begin(), target.fPredecessors.end(), index) - target.fPredecessors.begin();
+
+				for (SizeType phi = 0; phi < target.fPhis.size(); ++phi)
+					target.fPhis[phi].fArgs[pred] = current(phi_variables[succ][phi]);
+			}
+
+			for (auto it = children[index].rbegin(); it != children[index].rend(); ++it)
+				walk.emplace_back(*it, SIZE_MAX);
+		}
+
+		if (undefined != kIRNoRegister)
+			fBlocks[0].fCode.insert(fBlocks[0].fCode.begin(), { .fOpcode = kIRConstant, .fDst = undefined, .fImm = 0 });
+
+		fVariables.clear();
+	}
+
+	/// @brief types flow from the definitions, in dominator order.
+	void IRGraph::Type()
+	{
+		fTypes.assign(fFunction.RegisterLimit(), kIRTypeWord);
+
+		for (auto index : this->Order())
+		{
+			auto& block = fBlocks[index];
+
+			for (auto& phi : block.fPhis)
+			{
+				auto type = this->TypeOf(phi.fArgs.empty() ? kIRNoRegister : phi.fArgs[0]);
+
+				for (auto arg : phi.fArgs)
+				{
+					if (this->TypeOf(arg) != type)
+						type = kIRTypeWord;
+				}
+
+				fTypes[phi.fDst] = type;
+			}
+
+			for (auto& instr : block.fCode)
+			{
+				auto def = ir_def(instr);
+
+				if (def < kIRVirtualRegister)
+					continue;
+
+				Int32 type = kIRTypeWord;
+
+				switch (instr.fOpcode)
+				{
+				case kIRAddress:
+				case kIRFrameAddress:
+					type = kIRTypePointer;
+					break;
+				case kIRLoad:
+					type = instr.fWidth == 1 ? kIRTypeByte : kIRTypeWord;
+					break;
+				case kIRMove:
+				case kIRArithImm:
+					type = this->TypeOf(instr.fSrc);
+					break;
+				case kIRArith:
+					if (instr.fMnemonic == "and" &&
+						(this->TypeOf(instr.fSrc) == kIRTypeByte ||
+						 this->TypeOf(instr.fSrc2) == kIRTypeByte))
+						type = kIRTypeByte;
+					else if ((instr.fMnemonic == "add" || instr.fMnemonic == "sub") &&
+							 this->TypeOf(instr.fSrc) == kIRTypePointer &&
+							 this->TypeOf(instr.fSrc2) != kIRTypePointer)
+						type = kIRTypePointer;
+					break;
+				default:
+					break;
+				}
+
+				fTypes[def] = type;
+			}
+		}
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Rematerialize
+	// @brief Each block loads the constants and addresses it reads again, and
+	// again after each call, rather than keeping them in a register all along.
+	// Returns the definition of each such register, kIRNop for the others.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	std::vector<IRInstr> IRGraph::Rematerialize()
+	{
+		std::vector<IRInstr> sources(fFunction.RegisterLimit());
+
+		for (auto& block : fBlocks)
+		{
+			for (auto& instr : block.fCode)
+			{
+				if ((instr.fOpcode == kIRConstant || instr.fOpcode == kIRAddress || instr.fOpcode == kIRFrameAddress) &&
+					instr.fDst >= kIRVirtualRegister)
+					sources[instr.fDst] = instr;
+			}
+		}
+
+		for (auto& block : fBlocks)
+		{
+			if (!block.fLive)
+				continue;
+
+			// registers holding a source in this block, since the last call.
+			std::unordered_map<Int32, Int32> local;
+			std::vector<IRInstr> code;
+
+			for (auto instr : block.fCode)
+			{
+				auto use = [&](Int32& reg) {
+					if (reg < kIRVirtualRegister ||
+						reg >= (Int32)sources.size() ||
+						sources[reg].fOpcode == kIRNop)
+						return;
+
+					auto it = local.find(reg);
+
+					if (it == local.end())
+					{
+						auto copy = sources[reg];
+						copy.fDst = this->NewRegister(this->TypeOf(reg));
+
+						code.push_back(copy);
+						it = local.emplace(reg, copy.fDst).first;
+					}
+
+					reg = it->second;
+				};
+
+				switch (instr.fOpcode)
+				{
+				case kIRMove:
+				case kIRLoad:
+				case kIRPush:
+				case kIRCall:
+				case kIRJumpTable:
+				case kIRArithImm:
+				case kIRUnary:
+					use(instr.fSrc);
+					break;
+				case kIRStore:
+				case kIRBranch:
+				case kIRArith:
+					use(instr.fSrc);
+					use(instr.fSrc2);
+					break;
+				default:
+					break;
+				}
+
+				if (instr.fOpcode == kIRCall)
+					local.clear();
+
+				code.push_back(instr);
+			}
+
+			block.fCode = std::move(code);
+		}
+
+		return sources;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @name Flatten
+	// @brief Back to a linear function.
+	// Phi nodes become copies at the end of each predecessor. A branch taken
+	// to a block with phi nodes goes through a block of its own, laid out
+	// right before its target, so that the copies only run on that edge, and
+	// so do the entries of a jump table.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	void IRGraph::Flatten()
+	{
+		auto sources = this->Rematerialize();
+		ir_eliminate_dead_code(*this);
+
+		std::vector<SizeType> layout;
+
+		for (SizeType index = 0; index < fBlocks.size(); ++index)
+		{
+			if (fBlocks[index].fLive)
+				layout.push_back(index);
+		}
+
+		auto label = [&](SizeType index) -> const std::string& {
+			if (fBlocks[index].fLabel.empty())
+				fBlocks[index].fLabel = this->NewLabel();
+
+			return fBlocks[index].fLabel;
+		};
+
+		// fallthrough target of each block, SIZE_MAX when it ends in a jump or return.
+		auto fallthrough = [&](SizeType index) {
+			auto& block = fBlocks[index];
+
+			if (block.fSuccessors.empty() ||
+				(!block.fCode.empty() && block.fCode.back().fOpcode == kIRJump) ||
+				(!block.fCode.empty() && block.fCode.back().fOpcode == kIRJumpTable))
+				return SIZE_MAX;
+
+			return block.fSuccessors.back();
+		};
+
+		// taken edges into phi nodes, each gets a block of its own.
+		struct IREdge final
+		{
+			std::string fLabel;
+			SizeType fPred{ 0 };
+		};
+
+		std::vector<std::vector<IREdge>> splits(fBlocks.size());
+
+		for (auto index : layout)
+		{
+			auto& block = fBlocks[index];
+
+			if (block.fPhis.empty())
+				continue;
+
+			for (SizeType pred = 0; pred < block.fPredecessors.size(); ++pred)
+			{
+				auto& tail = fBlocks[block.fPredecessors[pred]].fCode;
+
+				// every entry of a jump table leading here goes through the same block.
+				if (!tail.empty() &&
+					tail.back().fOpcode == kIRJumpTable)
+				{
+					splits[index].push_back({ .fLabel = this->NewLabel(), .fPred = pred });
+
+					for (auto& target : tail.back().fTargets)
+					{
+						if (target == block.fLabel)
+							target = splits[index].back().fLabel;
+					}
+
+					continue;
+				}
+
+				if (tail.empty() ||
+					tail.back().fOpcode != kIRBranch ||
+					fBlocks[block.fPredecessors[pred]].fSuccessors[0] != index)
+					continue;
+
+				splits[index].push_back({ .fLabel = this->NewLabel(), .fPred = pred });
+				tail.back().fSymbol = splits[index].back().fLabel;
+			}
+		}
+
+		for (SizeType at = 0; at < layout.size(); ++at)
+		{
+			auto next = at + 1 < layout.size() ? layout[at + 1] : SIZE_MAX;
+			auto target = fallthrough(layout[at]);
+
+			if (target != SIZE_MAX &&
+				(target != next || !splits[next].empty()))
+				label(target);
+
+			if (!splits[layout[at]].empty())
+				label(layout[at]);
+		}
+
+		// the copies of an edge happen in parallel: a copy goes once nothing
+		// else still reads its destination, cycles are broken with a fresh register.
+		// Constants are loaded last, straight into their destination.
+		std::vector<IRInstr> code;
+
+		auto copies = [&](SizeType index, SizeType pred) {
+			std::vector<std::pair<Int32, Int32>> pending;
+			std::vector<IRInstr> constants;
+
+			for (auto& phi : fBlocks[index].fPhis)
+			{
+				auto arg = phi.fArgs[pred];
+
+				if (arg == phi.fDst)
+					continue;
+
+				if (arg >= kIRVirtualRegister &&
+					arg < (Int32)sources.size() &&
+					sources[arg].fOpcode != kIRNop)
+				{
+					constants.push_back(sources[arg]);
+					constants.back().fDst = phi.fDst;
+
+					continue;
+				}
+
+				pending.emplace_back(phi.fDst, arg);
+			}
+
+			while (!pending.empty())
+			{
+				auto ready = std::find_if(pending.begin(), pending.end(), [&](auto& copy) {
+					return std::none_of(pending.begin(), pending.end(), [&](auto& other) { return other.second == copy.first; });
+				});
+
+				if (ready == pending.end())
+				{
+					auto temp = this->NewRegister(this->TypeOf(pending[0].first));
+					code.push_back({ .fOpcode = kIRMove, .fDst = temp, .fSrc = pending[0].first });
+
+					for (auto& copy : pending)
+					{
+						if (copy.second == pending[0].first)
+							copy.second = temp;
+					}
+
+					continue;
+				}
+
+				code.push_back({ .fOpcode = kIRMove, .fDst = ready->first, .fSrc = ready->second });
+				pending.erase(ready);
+			}
+
+			code.insert(code.end(), constants.begin(), constants.end());
+		};
+
+		auto edge = [&](SizeType pred, SizeType succ) {
+			auto& preds = fBlocks[succ].fPredecessors;
+			return (SizeType)(std::find(preds.begin(), preds.end(), pred) - preds.begin());
+		};
+
+		for (SizeType at = 0; at < layout.size(); ++at)
+		{
+			auto index = layout[at];
+			auto& block = fBlocks[index];
+
+			if (!splits[index].empty())
+			{
+				if (!code.empty() &&
+					code.back().fOpcode != kIRJump &&
+					code.back().fOpcode != kIRJumpTable &&
+					code.back().fOpcode != kIRReturn)
+					code.push_back({ .fOpcode = kIRJump, .fSymbol = block.fLabel });
+
+				for (SizeType split = 0; split < splits[index].size(); ++split)
+				{
+					code.push_back({ .fOpcode = kIRLabel, .fSymbol = splits[index][split].fLabel });
+					copies(index, splits[index][split].fPred);
+
+					if (split + 1 < splits[index].size())
+						code.push_back({ .fOpcode = kIRJump, .fSymbol = block.fLabel });
+				}
+			}
+
+			if (!block.fLabel.empty())
+				code.push_back({ .fOpcode = kIRLabel, .fSymbol = block.fLabel });
+
+			auto tail = block.fCode.empty() ? kIRNop : block.fCode.back().fOpcode;
+			auto body = block.fCode.size() - (tail == kIRJump ? 1 : 0);
+
+			code.insert(code.end(), block.fCode.begin(), block.fCode.begin() + body);
+
+			auto next = at + 1 < layout.size() ? layout[at + 1] : SIZE_MAX;
+			auto target = fallthrough(index);
+
+			if (tail == kIRJump)
+			{
+				auto succ = block.fSuccessors[0];
+
+				if (!fBlocks[succ].fPhis.empty())
+					copies(succ, edge(index, succ));
+
+				if (succ != next ||
+					!splits[next].empty())
+					code.push_back(block.fCode.back());
+			}
+			else if (target != SIZE_MAX)
+			{
+				if (!fBlocks[target].fPhis.empty())
+					copies(target, edge(index, target));
+
+				if (target != next ||
+					!splits[next].empty())
+					code.push_back({ .fOpcode = kIRJump, .fSymbol = fBlocks[target].fLabel });
+			}
+		}
+
+		// labels nothing jumps to go away.
+		std::unordered_map<std::string, bool> used;
+
+		for (auto& instr : code)
+		{
+			if (instr.fOpcode == kIRBranch ||
+				instr.fOpcode == kIRJump)
+				used[instr.fSymbol] = true;
+
+			for (auto& target : instr.fTargets)
+				used[target] = true;
+		}
+
+		// so do constants only phi nodes were reading.
+		std::vector<bool> read(fFunction.RegisterLimit(), false);
+		std::vector<Int32> uses;
+
+		for (auto& instr : code)
+		{
+			uses.clear();
+			ir_uses(instr, uses);
+
+			for (auto reg : uses)
+			{
+				if (reg >= 0 && reg < (Int32)read.size())
+					read[reg] = true;
+			}
+		}
+
+		code.erase(std::remove_if(code.begin(), code.end(), [&](const IRInstr& instr) {
+			if (instr.fOpcode == kIRConstant || instr.fOpcode == kIRAddress)
+				return instr.fDst >= kIRVirtualRegister &&
+					   instr.fDst < (Int32)read.size() &&
+					   !read[instr.fDst];
+
+			return instr.fOpcode == kIRLabel &&
+				   !used.count(instr.fSymbol);
+		}), code.end());
+
+		fFunction.fCode = std::move(code);
+	}
+}
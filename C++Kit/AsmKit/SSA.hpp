@@ -0,0 +1,159 @@
+/*
+ *	========================================================
+ *
+ *	C++Kit
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#pragma once
+
+#include <C++Kit/AsmKit/IR.hpp>
+
+// @brief SSA form of the intermediate representation.
+// An IRFunction is cut in basic blocks, its locals whose address is never
+// taken become values, and every virtual register gets a single definition,
+// phi nodes merging them where control flow joins. The passes rewrite the
+// graph, which then goes back to a linear IRFunction for the allocator.
+// @file AsmKit/SSA.hpp
+
+#define kIRPassRounds 8
+#define kIRUnrollSize 32 // largest loop body unrolled, in instructions.
+
+namespace CxxKit
+{
+	/// @brief type of a value.
+	enum
+	{
+		kIRTypeWord,    // 64-bit integer
+		kIRTypeByte,    // zero extended byte
+		kIRTypePointer, // address
+	};
+
+	/// @brief fDst takes fArgs[i] when coming from the i-th predecessor.
+	struct IRPhi final
+	{
+		Int32 fDst{ kIRNoRegister };
+		std::vector<Int32> fArgs;
+	};
+
+	struct IRBlock final
+	{
+		std::string fLabel;
+		std::vector<IRPhi> fPhis;
+
+		/// @brief instructions, a branch, jump or return comes last.
+		std::vector<IRInstr> fCode;
+
+		std::vector<SizeType> fPredecessors;
+
+		/// @brief the target of a jump or branch first, then the next block.
+		/// A jump table goes to its blocks alone, in the order of their first entry.
+		std::vector<SizeType> fSuccessors;
+
+		SizeType fDominator{ 0 };
+		bool fLive{ true };
+	};
+
+	/// @brief natural loop, the blocks reaching one of its back edges without
+	/// going through its header.
+	struct IRLoop final
+	{
+		SizeType fHeader{ 0 };
+
+		/// @brief blocks of the loop, header first, in reverse post order.
+		std::vector<SizeType> fBlocks;
+
+		/// @brief sources of the back edges.
+		std::vector<SizeType> fLatches;
+	};
+
+	class IRGraph final
+	{
+	public:
+		/// @brief build the graph of function, promote its locals when asked to.
+		explicit IRGraph(IRFunction& function, bool promote);
+		~IRGraph() = default;
+
+		CXXKIT_COPY_DELETE(IRGraph);
+
+	public:
+		/// @brief write the graph back to its function, phi nodes become copies.
+		void Flatten();
+
+		/// @brief drop unreachable blocks, returns true if any went away.
+		bool Prune();
+
+		/// @brief immediate dominators, live blocks in reverse post order.
+		std::vector<SizeType> Order();
+
+		/// @brief drop the edge from block to succ.
+		void RemoveEdge(SizeType block, SizeType succ);
+
+		/// @brief count empty blocks at index at, the blocks from there on move up.
+		void Insert(SizeType at, SizeType count);
+
+		/// @brief natural loops, outer loops before the loops they hold.
+		std::vector<IRLoop> Loops();
+
+		/// @brief the block every entry to loop goes through, made if there is none.
+		/// Making one moves the blocks after it, loop is stale then.
+		SizeType Preheader(const IRLoop& loop);
+
+		Int32 NewRegister(Int32 type);
+		Int32 TypeOf(Int32 reg) const;
+
+		std::string NewLabel();
+
+	public:
+		IRFunction& fFunction;
+		std::vector<IRBlock> fBlocks;
+		std::vector<Int32> fTypes;
+
+	private:
+		void Promote();
+		void Rename();
+		void Type();
+		std::vector<IRInstr> Rematerialize();
+
+	private:
+		std::vector<Int32> fVariables;
+		SizeType fLabelCount{ 0 };
+
+	};
+
+	using IRPass = bool (*)(IRGraph& graph);
+
+	/// @brief runs its passes in order, again until none changes the graph.
+	class IRPassManager final
+	{
+	public:
+		explicit IRPassManager() = default;
+		~IRPassManager() = default;
+
+		CXXKIT_COPY_DEFAULT(IRPassManager);
+
+	public:
+		void Add(const std::string& name, IRPass pass);
+		void Run(IRGraph& graph);
+
+	private:
+		std::vector<std::pair<std::string, IRPass>> fPasses;
+
+	};
+
+	/// @brief passes of each level, -O1 and up.
+	void ir_add_passes(IRPassManager& manager, Int32 level);
+
+	/// @brief run passes over code through its SSA graph, then turn its calls in tail position into jumps.
+	void ir_optimize(IRFunction& code, IRPassManager& passes);
+
+	bool ir_fold_constants(IRGraph& graph);
+	bool ir_propagate_copies(IRGraph& graph);
+	bool ir_eliminate_common_subexpressions(IRGraph& graph);
+	bool ir_eliminate_dead_code(IRGraph& graph);
+	bool ir_hoist_invariants(IRGraph& graph);
+	bool ir_reduce_strength(IRGraph& graph);
+	bool ir_unroll_loops(IRGraph& graph);
+}
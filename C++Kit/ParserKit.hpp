@@ -10,6 +10,7 @@
 #pragma once
 
 #include <C++Kit/AsmKit/AsmKit.hpp>
+#include <vector>
 
 namespace ParserKit
 {
@@ -64,24 +65,27 @@ namespace ParserKit
     /// \return if we found it or not.
     inline bool find_word(const std::string& haystack,const std::string& needle) noexcept
     {
-        auto index = haystack.find(needle);
-
-        // check for needle validity.
-        if (index == std::string::npos)
-            return false;
-
         // declare lambda
-        auto not_part_of_word = [&](int index){
-            if (std::isspace(haystack[index]) || std::ispunct(haystack[index]))
+        auto not_part_of_word = [&](long index){
+            if (index < 0 || index >= (long)haystack.size())
                 return true;
 
-            if (index < 0 || index >= haystack.size())
+            if (std::isspace(haystack[index]) || std::ispunct(haystack[index]))
                 return true;
 
             return false;
         };
 
-        return not_part_of_word(index - 1) &&
-                not_part_of_word(index + needle.size());
+        // the needle may first show up inside a longer word, such as r1 in r15.
+        for (auto index = haystack.find(needle);
+             index != std::string::npos;
+             index = haystack.find(needle, index + 1))
+        {
+            if (not_part_of_word((long)index - 1) &&
+                not_part_of_word(index + needle.size()))
+                return true;
+        }
+
+        return false;
     }
 }
\ No newline at end of file
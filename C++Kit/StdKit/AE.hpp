@@ -19,6 +19,10 @@
 #define kAEMagLen 2
 #define kAEInvalidOpcode 0x00
 
+// constant pool records are named after their bytes, kAEPoolPrefix<size>_<FNV-1a hash>,
+// ld keeps the first record of a name and merges the others into it.
+#define kAEPoolPrefix "__pool_"
+
 // Advanced Executable File Format for MetroLink.
 // Reloctable by offset is the default strategy.
 // You can also relocate at runtime but that's up to the operating system loader.
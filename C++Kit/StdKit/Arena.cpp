@@ -0,0 +1,86 @@
+/*
+ *	========================================================
+ *
+ *	NewOS
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#include "Arena.hpp"
+#include <algorithm>
+
+namespace CxxKit
+{
+    Arena::Arena(SizeType chunkSize)
+        : m_ChunkSize(chunkSize)
+    {
+    }
+
+    Arena::~Arena()
+    {
+        this->Reset();
+    }
+
+    VoidPtr Arena::Allocate(SizeType size, SizeType align)
+    {
+        auto cursor = reinterpret_cast<char*>((reinterpret_cast<UIntPtr>(m_Cursor) + align - 1) & ~(UIntPtr)(align - 1));
+
+        if (m_Cursor == nullptr ||
+            cursor + size > m_End)
+        {
+            // a large request gets a chunk of its own size.
+            auto chunk_size = std::max(m_ChunkSize, size + align);
+
+            m_Chunks.push_back(std::make_unique<char[]>(chunk_size));
+
+            m_Cursor = m_Chunks.back().get();
+            m_End = m_Cursor + chunk_size;
+
+            m_Reserved += chunk_size;
+            m_Peak = std::max(m_Peak, m_Reserved);
+
+            cursor = reinterpret_cast<char*>((reinterpret_cast<UIntPtr>(m_Cursor) + align - 1) & ~(UIntPtr)(align - 1));
+        }
+
+        m_Cursor = cursor + size;
+        m_Used += size;
+
+        return cursor;
+    }
+
+    std::string_view Arena::Copy(std::string_view text)
+    {
+        auto data = static_cast<char*>(this->Allocate(text.size() + 1, 1));
+
+        rt_copy_memory(data, text.data(), text.size());
+        data[text.size()] = 0;
+
+        return { data, text.size() };
+    }
+
+    void Arena::Reset()
+    {
+        for (auto it = m_Destructors.rbegin(); it != m_Destructors.rend(); ++it)
+            it->fDestroy(it->fObject);
+
+        m_Destructors.clear();
+
+        if (m_Chunks.size() > 1)
+            m_Chunks.erase(m_Chunks.begin() + 1, m_Chunks.end());
+
+        // the first chunk is at least m_ChunkSize bytes long.
+        m_Cursor = m_Chunks.empty() ? nullptr : m_Chunks[0].get();
+        m_End = m_Chunks.empty() ? nullptr : m_Cursor + m_ChunkSize;
+        m_Reserved = m_Chunks.empty() ? 0 : m_ChunkSize;
+        m_Used = 0;
+    }
+
+    std::string_view InternPool::Intern(std::string_view text)
+    {
+        if (auto it = m_Strings.find(text); it != m_Strings.end())
+            return *it;
+
+        return *m_Strings.insert(m_Arena.Copy(text)).first;
+    }
+} // namespace CxxKit
@@ -0,0 +1,107 @@
+/*
+ *	========================================================
+ *
+ *	NewOS
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#pragma once
+
+#include <C++Kit/Defines.hpp>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#define kArenaChunkSize (64 * 1024)
+
+namespace CxxKit
+{
+    // @author Amlal El Mahrouss
+    // @brief Bump allocator, everything it hands out goes away at once.
+    // Objects made with New are destroyed by Reset, in reverse order.
+    class Arena final
+    {
+    public:
+        explicit Arena(SizeType chunkSize = kArenaChunkSize);
+        ~Arena();
+
+        CXXKIT_COPY_DELETE(Arena);
+
+    public:
+        VoidPtr Allocate(SizeType size, SizeType align = alignof(std::max_align_t));
+
+        template <typename T, typename... Args>
+        T* New(Args&&... args)
+        {
+            auto object = new (this->Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+            if constexpr (!std::is_trivially_destructible_v<T>)
+                m_Destructors.push_back({ [](VoidPtr ptr) { static_cast<T*>(ptr)->~T(); }, object });
+
+            return object;
+        }
+
+        /// @brief copy of text, NUL terminated.
+        std::string_view Copy(std::string_view text);
+
+        /// @brief destroy every object, keep the first chunk for the next round.
+        void Reset();
+
+        /// @brief bytes handed out since the last reset.
+        SizeType Used() const noexcept { return m_Used; }
+
+        /// @brief bytes held in chunks.
+        SizeType Reserved() const noexcept { return m_Reserved; }
+
+        /// @brief highest Reserved since the arena was made.
+        SizeType Peak() const noexcept { return m_Peak; }
+
+    private:
+        struct Destructor final
+        {
+            void (*fDestroy)(VoidPtr);
+            VoidPtr fObject;
+        };
+
+        std::vector<std::unique_ptr<char[]>> m_Chunks;
+        std::vector<Destructor> m_Destructors;
+        char* m_Cursor{ nullptr };
+        char* m_End{ nullptr };
+        SizeType m_ChunkSize{ kArenaChunkSize };
+        SizeType m_Used{ 0 };
+        SizeType m_Reserved{ 0 };
+        SizeType m_Peak{ 0 };
+
+    };
+
+    // @author Amlal El Mahrouss
+    // @brief Identifier pool, equal strings share a single copy in the arena,
+    // so interned strings compare by address.
+    class InternPool final
+    {
+    public:
+        explicit InternPool(Arena& arena) : m_Arena(arena) {}
+        ~InternPool() = default;
+
+        CXXKIT_COPY_DELETE(InternPool);
+
+    public:
+        std::string_view Intern(std::string_view text);
+
+        /// @brief forget every string, to be called along with Arena::Reset.
+        void Reset() { m_Strings.clear(); }
+
+        SizeType Size() const noexcept { return m_Strings.size(); }
+
+    private:
+        Arena& m_Arena;
+        std::unordered_set<std::string_view> m_Strings;
+
+    };
+} // namespace CxxKit
@@ -77,6 +77,7 @@ namespace CxxKit
         kPefCode = 0xC,
         kPefData = 0xD,
         kPefZero = 0xE,
+        kPefIR = 0xF, /* IR of a unit built with -flto, ld lowers it. */
 	    kPefLinkerID = 0x1,
     };
 }
@@ -0,0 +1,177 @@
+/*
+ *	========================================================
+ *
+ *	NewOS
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#include "Report.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <sys/resource.h>
+
+namespace CxxKit
+{
+    void CompileReport::Reset(const std::string& file)
+    {
+        m_File = file;
+        m_Times.clear();
+        m_Counts.clear();
+        m_Memory.clear();
+    }
+
+    void CompileReport::Time(const std::string& phase, double milliseconds)
+    {
+        auto it = std::find_if(m_Times.begin(), m_Times.end(), [&](auto& entry) { return entry.first == phase; });
+
+        if (it == m_Times.end())
+            m_Times.emplace_back(phase, milliseconds);
+        else
+            it->second += milliseconds;
+    }
+
+    void CompileReport::Count(const std::string& name, SizeType value)
+    {
+        m_Counts.emplace_back(name, value);
+    }
+
+    void CompileReport::Memory(const std::string& name, SizeType bytes)
+    {
+        m_Memory.emplace_back(name, bytes);
+    }
+
+    /// @brief file names are the only strings that may need escaping.
+    static std::string report_quote(const std::string& text)
+    {
+        std::string quoted = "\"";
+
+        for (auto ch : text)
+        {
+            if (ch == '"' || ch == '\\')
+                quoted += '\\';
+
+            if ((unsigned char)ch < 0x20)
+            {
+                char escape[8];
+                snprintf(escape, sizeof(escape), "\\u%04x", ch);
+
+                quoted += escape;
+                continue;
+            }
+
+            quoted += ch;
+        }
+
+        return quoted + "\"";
+    }
+
+    /// @brief names are words, keys are joined with underscores.
+    static std::string report_key(std::string name)
+    {
+        std::replace(name.begin(), name.end(), ' ', '_');
+        return report_quote(name);
+    }
+
+    void CompileReport::Print(std::ostream& out, bool times, bool memory, bool json) const
+    {
+        double total = 0;
+
+        for (auto& entry : m_Times)
+            total += entry.second;
+
+        char number[32];
+
+        auto milliseconds = [&](double value) {
+            snprintf(number, sizeof(number), "%.3f", value);
+            return std::string(number);
+        };
+
+        if (json)
+        {
+            out << "{\"file\": " << report_quote(m_File);
+
+            if (times)
+            {
+                out << ", \"time_ms\": {";
+
+                for (SizeType index = 0; index < m_Times.size(); ++index)
+                    out << (index ? ", " : "") << report_key(m_Times[index].first) << ": " << milliseconds(m_Times[index].second);
+
+                out << "}, \"total_ms\": " << milliseconds(total);
+            }
+
+            for (auto& entry : m_Counts)
+                out << ", " << report_key(entry.first) << ": " << entry.second;
+
+            if (memory)
+            {
+                for (auto& entry : m_Memory)
+                    out << ", " << report_key(entry.first + " bytes") << ": " << entry.second;
+            }
+
+            out << "}\n";
+
+            return;
+        }
+
+        auto label = [](const std::string& name) {
+            return "  " + name + std::string(name.size() < 24 ? 24 - name.size() : 1, ' ');
+        };
+
+        out << "report for " << m_File << "\n";
+
+        if (times)
+        {
+            for (auto& entry : m_Times)
+            {
+                char share[16];
+                snprintf(share, sizeof(share), "%5.1f%%", total > 0 ? entry.second * 100 / total : 0.0);
+
+                out << label(entry.first) << milliseconds(entry.second) << " ms  " << share << "\n";
+            }
+
+            out << label("total") << milliseconds(total) << " ms\n";
+        }
+
+        for (auto& entry : m_Counts)
+            out << label(entry.first) << entry.second << "\n";
+
+        if (memory)
+        {
+            for (auto& entry : m_Memory)
+                out << label(entry.first) << entry.second / 1024 << " KiB\n";
+        }
+    }
+
+    SizeType CompileReport::PeakResident()
+    {
+        struct rusage usage{};
+
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+
+#ifdef __APPLE__
+        return usage.ru_maxrss;
+#else
+        return usage.ru_maxrss * 1024UL;
+#endif // __APPLE__
+    }
+
+    PhaseTimer::PhaseTimer(CompileReport* report, const char* phase)
+        : m_Report(report), m_Phase(phase)
+    {
+        if (m_Report)
+            m_Start = std::chrono::steady_clock::now();
+    }
+
+    PhaseTimer::~PhaseTimer()
+    {
+        if (!m_Report)
+            return;
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_Start;
+        m_Report->Time(m_Phase, elapsed.count());
+    }
+} // namespace CxxKit
@@ -0,0 +1,70 @@
+/*
+ *	========================================================
+ *
+ *	NewOS
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+#pragma once
+
+#include <C++Kit/Defines.hpp>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CxxKit
+{
+    // @author Amlal El Mahrouss
+    // @brief Statistics of one source file, for -ftime-report and -fmem-report.
+    // Phases keep the order they were first timed in, a phase timed twice adds up.
+    class CompileReport final
+    {
+    public:
+        explicit CompileReport() = default;
+        ~CompileReport() = default;
+
+        CXXKIT_COPY_DELETE(CompileReport);
+
+    public:
+        /// @brief forget everything, the next report is about file.
+        void Reset(const std::string& file);
+
+        void Time(const std::string& phase, double milliseconds);
+        void Count(const std::string& name, SizeType value);
+        void Memory(const std::string& name, SizeType bytes);
+
+        /// @brief as text, or as a single line JSON object.
+        void Print(std::ostream& out, bool times, bool memory, bool json) const;
+
+        /// @brief highest resident set size of the process so far, in bytes.
+        static SizeType PeakResident();
+
+    private:
+        std::string m_File;
+        std::vector<std::pair<std::string, double>> m_Times;
+        std::vector<std::pair<std::string, SizeType>> m_Counts;
+        std::vector<std::pair<std::string, SizeType>> m_Memory;
+
+    };
+
+    // @author Amlal El Mahrouss
+    // @brief Adds the wall time of its scope to a phase, does nothing without a report.
+    class PhaseTimer final
+    {
+    public:
+        explicit PhaseTimer(CompileReport* report, const char* phase);
+        ~PhaseTimer();
+
+        CXXKIT_COPY_DELETE(PhaseTimer);
+
+    private:
+        CompileReport* m_Report;
+        const char* m_Phase;
+        std::chrono::steady_clock::time_point m_Start;
+
+    };
+} // namespace CxxKit
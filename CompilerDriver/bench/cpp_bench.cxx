@@ -0,0 +1,550 @@
+/*
+ *	========================================================
+ *
+ *	cpp_bench
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+/// @file cpp_bench.cxx
+/// @brief Preprocessor benchmark and conformance harness.
+/// Generates the corpus, runs cpp on every case, checks the output against
+/// the golden .pp files and reports lines/s and peak RSS.
+
+#include <C++Kit/Defines.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define kBenchVersion "MP-UX Preprocessor Benchmark v1.0, (c) Amlal El Mahrouss"
+
+/// @brief a case is slower than the baseline when below this fraction of its lines/s.
+#define kBenchTolerance 0.80
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Benchmark internal types.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace details
+{
+	struct bench_case final
+	{
+		std::string fName;
+		std::string fSource;
+		SizeType fLines{ 0 };
+		bool fExpectFail{ false }; // the golden file is right, cpp is not yet.
+	};
+
+	struct bench_result final
+	{
+		double fBestMs{ 0 };
+		long fPeakRssKb{ 0 };
+		bool fRan{ false };
+		bool fMatches{ false };
+	};
+}
+
+static std::string kCppPath = "bin/cpp";
+static std::string kGoldenDir = "bench/golden";
+static std::string kWorkDir = "bin/bench";
+static std::string kBaselinePath;
+static std::string kSaveBaselinePath;
+static Int32 kRuns = 3;
+static bool kUpdateGolden = false;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name bench_emit
+// @brief write a corpus file into the work directory, counts its lines.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_emit(details::bench_case& bench, const std::string& name, const std::string& contents)
+{
+	std::ofstream(name, std::ios::binary) << contents;
+	bench.fLines += std::count(contents.cbegin(), contents.cend(), '\n');
+}
+
+static std::string bench_number(SizeType n, Int32 width = 5)
+{
+	char buf[32] = { 0 };
+	snprintf(buf, sizeof(buf), "%0*zu", width, n);
+
+	return buf;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Corpus generators, every case is deterministic so that the golden
+// files stay valid across runs.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief 10k object-like macros in one header, a sample of them used afterwards.
+static details::bench_case bench_gen_macros()
+{
+	details::bench_case bench{ "macros_10k", "macros_10k.c" };
+	std::stringstream hdr, src;
+
+	hdr << "#ifndef __BENCH_MACROS_H__\n#define __BENCH_MACROS_H__\n";
+
+	for (SizeType i = 0; i < 10000; ++i)
+		hdr << "#define kBenchMacro" << bench_number(i) << " " << i * 3 << "\n";
+
+	hdr << "#endif\n";
+
+	src << "#include \"macros_10k.h\"\n";
+
+	for (SizeType i = 0; i < 10000; i += 25)
+		src << "int use" << bench_number(i) << " = kBenchMacro" << bench_number(i) << ";\n";
+
+	bench_emit(bench, "macros_10k.h", hdr.str());
+	bench_emit(bench, bench.fSource, src.str());
+
+	return bench;
+}
+
+/// @brief a chain of 128 guarded headers, each including the next one.
+static details::bench_case bench_gen_include_chain()
+{
+	details::bench_case bench{ "include_chain", "include_chain.c" };
+	const SizeType depth = 128;
+
+	for (SizeType i = 0; i < depth; ++i)
+	{
+		std::stringstream hdr;
+		std::string guard = "__BENCH_CHAIN_" + bench_number(i, 3) + "_H__";
+
+		hdr << "#ifndef " << guard << "\n#define " << guard << "\n";
+
+		if (i + 1 < depth)
+			hdr << "#include \"chain_" << bench_number(i + 1, 3) << ".h\"\n";
+
+		for (SizeType field = 0; field < 4; ++field)
+			hdr << "int chain" << bench_number(i, 3) << "_" << field << ";\n";
+
+		hdr << "#endif\n";
+
+		bench_emit(bench, "chain_" + bench_number(i, 3) + ".h", hdr.str());
+	}
+
+	bench_emit(bench, bench.fSource,
+		"#include \"chain_000.h\"\n"
+		"#include \"chain_000.h\"\n"
+		"int main_chain;\n");
+
+	return bench;
+}
+
+/// @brief blocks of nested conditionals, most of the input is inactive.
+static details::bench_case bench_gen_conditionals()
+{
+	details::bench_case bench{ "nested_conditionals", "nested_conditionals.c" };
+	std::stringstream src;
+
+	src << "#define kBenchOn 1\n";
+
+	for (SizeType block = 0; block < 500; ++block)
+	{
+		std::string id = bench_number(block, 3);
+
+		src << "#ifdef kBenchOn\n";
+		src << "int on" << id << ";\n";
+		src << "#if 0\n";
+
+		for (SizeType depth = 0; depth < 8; ++depth)
+		{
+			src << (depth % 2 ? "#ifdef kBenchOn\n" : "#if 1\n");
+
+			for (SizeType line = 0; line < 4; ++line)
+				src << "int dead" << id << "_" << depth << "_" << line << ";\n";
+		}
+
+		for (SizeType depth = 0; depth < 8; ++depth)
+			src << "#endif\n";
+
+		src << "#else\n";
+		src << "int else" << id << ";\n";
+		src << "#endif\n";
+		src << "#ifndef kBenchOn\n";
+		src << "int off" << id << ";\n";
+		src << "#endif\n";
+		src << "#endif\n";
+	}
+
+	bench_emit(bench, bench.fSource, src.str());
+
+	return bench;
+}
+
+/// @brief false conditionals holding block comments, with directives inside the comments.
+static details::bench_case bench_gen_comment_conditionals()
+{
+	details::bench_case bench{ "comment_conditionals", "comment_conditionals.c" };
+	std::stringstream src;
+
+	for (SizeType block = 0; block < 500; ++block)
+	{
+		std::string id = bench_number(block, 3);
+
+		src << "#if 0\n";
+		src << "/*\n";
+		src << "#endif\n";
+		src << "*/\n";
+		src << "int hidden" << id << ";\n";
+		src << "#endif\n";
+		src << "int visible" << id << ";\n";
+	}
+
+	bench_emit(bench, bench.fSource, src.str());
+
+	return bench;
+}
+
+/// @brief function-like macros used on every line.
+/// cpp leaves the replacement list followed by the arguments, expected to fail until it expands them.
+static details::bench_case bench_gen_function_macros()
+{
+	details::bench_case bench{ "function_macros", "function_macros.c" };
+	std::stringstream src;
+
+	bench.fExpectFail = true;
+
+	src << "#define kBenchAdd(a, b) (a + b)\n";
+	src << "#define kBenchMul(a, b) (a * b)\n";
+	src << "#define kBenchSel(c, a, b) (c ? a : b)\n";
+
+	for (SizeType i = 0; i < 2000; ++i)
+	{
+		std::string id = bench_number(i, 4);
+
+		switch (i % 3)
+		{
+		case 0:
+			src << "int add" << id << " = kBenchAdd(x" << id << ", " << i << ");\n";
+			break;
+		case 1:
+			src << "int mul" << id << " = kBenchMul(y" << id << ", " << i << ");\n";
+			break;
+		default:
+			src << "int sel" << id << " = kBenchSel(z" << id << ", " << i << ", 0);\n";
+			break;
+		}
+	}
+
+	bench_emit(bench, bench.fSource, src.str());
+
+	return bench;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name bench_run
+// @brief run cpp once on a case.
+// @return exit status of cpp, wall time and peak RSS through ms and rss_kb.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static int bench_run(const details::bench_case& bench, double& ms, long& rss_kb)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	pid_t pid = fork();
+
+	if (pid < 0)
+		return -1;
+
+	if (pid == 0)
+	{
+		const char* argv[] = { kCppPath.c_str(), "--working-dir", "./",
+			bench.fSource.c_str(), nullptr };
+
+		execv(kCppPath.c_str(), const_cast<char* const*>(argv));
+		_exit(127);
+	}
+
+	int status = 0;
+	struct rusage usage;
+
+	if (wait4(pid, &status, 0, &usage) < 0)
+		return -1;
+
+	ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	rss_kb = usage.ru_maxrss;
+
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static bool bench_read(const std::string& path, std::string& contents)
+{
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file.is_open())
+		return false;
+
+	std::stringstream ss;
+	ss << file.rdbuf();
+	contents = ss.str();
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name bench_check
+// @brief compare the output of a case with its golden file, or replace it.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool bench_check(const details::bench_case& bench)
+{
+	std::string output, golden;
+	std::string golden_path = kGoldenDir + "/" + bench.fName + ".pp";
+
+	if (!bench_read(bench.fSource + ".pp", output))
+		return false;
+
+	// the golden file of an expected failure is written by hand.
+	if (kUpdateGolden &&
+		!bench.fExpectFail)
+	{
+		std::ofstream(golden_path, std::ios::binary) << output;
+		return true;
+	}
+
+	if (!bench_read(golden_path, golden))
+	{
+		std::cerr << "cpp_bench: missing golden file: " << golden_path << "\n";
+		return false;
+	}
+
+	if (output == golden)
+		return true;
+
+	// report the first line which differs.
+	std::stringstream out_ss(output), gold_ss(golden);
+	std::string out_line, gold_line;
+	SizeType line = 0;
+
+	while (true)
+	{
+		bool has_out = (bool)std::getline(out_ss, out_line);
+		bool has_gold = (bool)std::getline(gold_ss, gold_line);
+
+		++line;
+
+		if (!has_out && !has_gold)
+			break;
+
+		if (has_out != has_gold ||
+			out_line != gold_line)
+		{
+			std::cerr << "cpp_bench: " << bench.fName << ", line " << line << "\n";
+			std::cerr << "  expected: " << (has_gold ? gold_line : "<eof>") << "\n";
+			std::cerr << "  got:      " << (has_out ? out_line : "<eof>") << "\n";
+			break;
+		}
+	}
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Baseline files hold one '<case> <lines/s>' entry per line.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::map<std::string, double> bench_load_baseline(const std::string& path)
+{
+	std::map<std::string, double> baseline;
+	std::ifstream file(path);
+
+	std::string name;
+	double lines_per_sec = 0;
+
+	while (file >> name >> lines_per_sec)
+		baseline[name] = lines_per_sec;
+
+	return baseline;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name main
+// @brief benchmark entrypoint.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+	for (auto index = 1; index < argc; ++index)
+	{
+		if (strcmp(argv[index], "-v") == 0 ||
+			strcmp(argv[index], "--version") == 0)
+		{
+			printf("%s\n", kBenchVersion);
+			return 0;
+		}
+
+		if (strcmp(argv[index], "-h") == 0 ||
+			strcmp(argv[index], "--help") == 0)
+		{
+			printf("%s\n", kBenchVersion);
+			printf("%s\n", "--cpp: preprocessor to benchmark.");
+			printf("%s\n", "--golden: directory of the golden .pp files.");
+			printf("%s\n", "--work: directory where the corpus is generated.");
+			printf("%s\n", "--runs: number of runs per case, the best one is kept.");
+			printf("%s\n", "--baseline: fail when a case is slower than this baseline.");
+			printf("%s\n", "--save-baseline: write the measured lines/s as a baseline.");
+			printf("%s\n", "--update: replace the golden files with the current output.");
+
+			return 0;
+		}
+
+		if (strcmp(argv[index], "--update") == 0)
+		{
+			kUpdateGolden = true;
+			continue;
+		}
+
+		if (index + 1 >= argc)
+		{
+			std::cerr << "cpp_bench: missing argument for " << argv[index] << "\n";
+			return 1;
+		}
+
+		if (strcmp(argv[index], "--cpp") == 0)
+			kCppPath = argv[++index];
+		else if (strcmp(argv[index], "--golden") == 0)
+			kGoldenDir = argv[++index];
+		else if (strcmp(argv[index], "--work") == 0)
+			kWorkDir = argv[++index];
+		else if (strcmp(argv[index], "--runs") == 0)
+			kRuns = std::max(1, atoi(argv[++index]));
+		else if (strcmp(argv[index], "--baseline") == 0)
+			kBaselinePath = std::filesystem::absolute(argv[++index]).string();
+		else if (strcmp(argv[index], "--save-baseline") == 0)
+			kSaveBaselinePath = std::filesystem::absolute(argv[++index]).string();
+		else
+		{
+			std::cerr << "cpp_bench: unknown option " << argv[index] << "\n";
+			return 1;
+		}
+	}
+
+	// cases are run from the work directory, so that line markers use relative paths.
+	kCppPath = std::filesystem::absolute(kCppPath).string();
+	kGoldenDir = std::filesystem::absolute(kGoldenDir).string();
+
+	std::filesystem::create_directories(kWorkDir);
+	std::filesystem::current_path(kWorkDir);
+
+	std::vector<details::bench_case> cases;
+
+	cases.push_back(bench_gen_macros());
+	cases.push_back(bench_gen_include_chain());
+	cases.push_back(bench_gen_conditionals());
+	cases.push_back(bench_gen_comment_conditionals());
+	cases.push_back(bench_gen_function_macros());
+
+	std::map<std::string, double> baseline;
+
+	if (!kBaselinePath.empty())
+		baseline = bench_load_baseline(kBaselinePath);
+
+	std::ofstream save_baseline;
+
+	if (!kSaveBaselinePath.empty())
+		save_baseline.open(kSaveBaselinePath);
+
+	Int32 failures = 0;
+
+	printf("%-22s %10s %10s %14s %12s  %s\n", "case", "lines", "best ms", "lines/s", "peak KiB", "status");
+
+	for (auto& bench : cases)
+	{
+		details::bench_result result;
+
+		for (Int32 run = 0; run < kRuns; ++run)
+		{
+			double ms = 0;
+			long rss_kb = 0;
+
+			if (bench_run(bench, ms, rss_kb) != 0)
+			{
+				result.fRan = false;
+				break;
+			}
+
+			if (!result.fRan ||
+				ms < result.fBestMs)
+				result.fBestMs = ms;
+
+			result.fPeakRssKb = std::max(result.fPeakRssKb, rss_kb);
+			result.fRan = true;
+		}
+
+		std::string status = "ok";
+		double lines_per_sec = 0;
+
+		if (!result.fRan)
+		{
+			status = "FAIL (cpp exited with an error)";
+		}
+		else
+		{
+			lines_per_sec = bench.fLines / (std::max(result.fBestMs, 0.001) / 1000.0);
+			result.fMatches = bench_check(bench);
+
+			if (bench.fExpectFail)
+			{
+				status = result.fMatches ? "FAIL (passes, no longer an expected failure)" : "expected failure";
+				result.fMatches = !result.fMatches;
+			}
+			else if (!result.fMatches)
+			{
+				status = "FAIL (output differs from golden)";
+			}
+			else if (kUpdateGolden)
+			{
+				status = "updated";
+			}
+
+			if (baseline.count(bench.fName) &&
+				lines_per_sec < baseline[bench.fName] * kBenchTolerance)
+			{
+				result.fMatches = false;
+				status = "FAIL (slower than baseline)";
+			}
+
+			if (save_baseline.is_open())
+				save_baseline << bench.fName << " " << lines_per_sec << "\n";
+		}
+
+		if (!result.fRan ||
+			!result.fMatches)
+			++failures;
+
+		printf("%-22s %10zu %10.2f %14.0f %12ld  %s\n", bench.fName.c_str(), bench.fLines,
+			result.fBestMs, lines_per_sec, result.fPeakRssKb, status.c_str());
+	}
+
+	return failures == 0 ? 0 : 1;
+}
+
+// Last rev 18-10-26
@@ -0,0 +1,3495 @@
+# 7 "comment_conditionals.c"
+int visible000;
+
+
+
+
+
+
+int visible001;
+
+
+
+
+
+
+int visible002;
+
+
+
+
+
+
+int visible003;
+
+
+
+
+
+
+int visible004;
+
+
+
+
+
+
+int visible005;
+
+
+
+
+
+
+int visible006;
+
+
+
+
+
+
+int visible007;
+
+
+
+
+
+
+int visible008;
+
+
+
+
+
+
+int visible009;
+
+
+
+
+
+
+int visible010;
+
+
+
+
+
+
+int visible011;
+
+
+
+
+
+
+int visible012;
+
+
+
+
+
+
+int visible013;
+
+
+
+
+
+
+int visible014;
+
+
+
+
+
+
+int visible015;
+
+
+
+
+
+
+int visible016;
+
+
+
+
+
+
+int visible017;
+
+
+
+
+
+
+int visible018;
+
+
+
+
+
+
+int visible019;
+
+
+
+
+
+
+int visible020;
+
+
+
+
+
+
+int visible021;
+
+
+
+
+
+
+int visible022;
+
+
+
+
+
+
+int visible023;
+
+
+
+
+
+
+int visible024;
+
+
+
+
+
+
+int visible025;
+
+
+
+
+
+
+int visible026;
+
+
+
+
+
+
+int visible027;
+
+
+
+
+
+
+int visible028;
+
+
+
+
+
+
+int visible029;
+
+
+
+
+
+
+int visible030;
+
+
+
+
+
+
+int visible031;
+
+
+
+
+
+
+int visible032;
+
+
+
+
+
+
+int visible033;
+
+
+
+
+
+
+int visible034;
+
+
+
+
+
+
+int visible035;
+
+
+
+
+
+
+int visible036;
+
+
+
+
+
+
+int visible037;
+
+
+
+
+
+
+int visible038;
+
+
+
+
+
+
+int visible039;
+
+
+
+
+
+
+int visible040;
+
+
+
+
+
+
+int visible041;
+
+
+
+
+
+
+int visible042;
+
+
+
+
+
+
+int visible043;
+
+
+
+
+
+
+int visible044;
+
+
+
+
+
+
+int visible045;
+
+
+
+
+
+
+int visible046;
+
+
+
+
+
+
+int visible047;
+
+
+
+
+
+
+int visible048;
+
+
+
+
+
+
+int visible049;
+
+
+
+
+
+
+int visible050;
+
+
+
+
+
+
+int visible051;
+
+
+
+
+
+
+int visible052;
+
+
+
+
+
+
+int visible053;
+
+
+
+
+
+
+int visible054;
+
+
+
+
+
+
+int visible055;
+
+
+
+
+
+
+int visible056;
+
+
+
+
+
+
+int visible057;
+
+
+
+
+
+
+int visible058;
+
+
+
+
+
+
+int visible059;
+
+
+
+
+
+
+int visible060;
+
+
+
+
+
+
+int visible061;
+
+
+
+
+
+
+int visible062;
+
+
+
+
+
+
+int visible063;
+
+
+
+
+
+
+int visible064;
+
+
+
+
+
+
+int visible065;
+
+
+
+
+
+
+int visible066;
+
+
+
+
+
+
+int visible067;
+
+
+
+
+
+
+int visible068;
+
+
+
+
+
+
+int visible069;
+
+
+
+
+
+
+int visible070;
+
+
+
+
+
+
+int visible071;
+
+
+
+
+
+
+int visible072;
+
+
+
+
+
+
+int visible073;
+
+
+
+
+
+
+int visible074;
+
+
+
+
+
+
+int visible075;
+
+
+
+
+
+
+int visible076;
+
+
+
+
+
+
+int visible077;
+
+
+
+
+
+
+int visible078;
+
+
+
+
+
+
+int visible079;
+
+
+
+
+
+
+int visible080;
+
+
+
+
+
+
+int visible081;
+
+
+
+
+
+
+int visible082;
+
+
+
+
+
+
+int visible083;
+
+
+
+
+
+
+int visible084;
+
+
+
+
+
+
+int visible085;
+
+
+
+
+
+
+int visible086;
+
+
+
+
+
+
+int visible087;
+
+
+
+
+
+
+int visible088;
+
+
+
+
+
+
+int visible089;
+
+
+
+
+
+
+int visible090;
+
+
+
+
+
+
+int visible091;
+
+
+
+
+
+
+int visible092;
+
+
+
+
+
+
+int visible093;
+
+
+
+
+
+
+int visible094;
+
+
+
+
+
+
+int visible095;
+
+
+
+
+
+
+int visible096;
+
+
+
+
+
+
+int visible097;
+
+
+
+
+
+
+int visible098;
+
+
+
+
+
+
+int visible099;
+
+
+
+
+
+
+int visible100;
+
+
+
+
+
+
+int visible101;
+
+
+
+
+
+
+int visible102;
+
+
+
+
+
+
+int visible103;
+
+
+
+
+
+
+int visible104;
+
+
+
+
+
+
+int visible105;
+
+
+
+
+
+
+int visible106;
+
+
+
+
+
+
+int visible107;
+
+
+
+
+
+
+int visible108;
+
+
+
+
+
+
+int visible109;
+
+
+
+
+
+
+int visible110;
+
+
+
+
+
+
+int visible111;
+
+
+
+
+
+
+int visible112;
+
+
+
+
+
+
+int visible113;
+
+
+
+
+
+
+int visible114;
+
+
+
+
+
+
+int visible115;
+
+
+
+
+
+
+int visible116;
+
+
+
+
+
+
+int visible117;
+
+
+
+
+
+
+int visible118;
+
+
+
+
+
+
+int visible119;
+
+
+
+
+
+
+int visible120;
+
+
+
+
+
+
+int visible121;
+
+
+
+
+
+
+int visible122;
+
+
+
+
+
+
+int visible123;
+
+
+
+
+
+
+int visible124;
+
+
+
+
+
+
+int visible125;
+
+
+
+
+
+
+int visible126;
+
+
+
+
+
+
+int visible127;
+
+
+
+
+
+
+int visible128;
+
+
+
+
+
+
+int visible129;
+
+
+
+
+
+
+int visible130;
+
+
+
+
+
+
+int visible131;
+
+
+
+
+
+
+int visible132;
+
+
+
+
+
+
+int visible133;
+
+
+
+
+
+
+int visible134;
+
+
+
+
+
+
+int visible135;
+
+
+
+
+
+
+int visible136;
+
+
+
+
+
+
+int visible137;
+
+
+
+
+
+
+int visible138;
+
+
+
+
+
+
+int visible139;
+
+
+
+
+
+
+int visible140;
+
+
+
+
+
+
+int visible141;
+
+
+
+
+
+
+int visible142;
+
+
+
+
+
+
+int visible143;
+
+
+
+
+
+
+int visible144;
+
+
+
+
+
+
+int visible145;
+
+
+
+
+
+
+int visible146;
+
+
+
+
+
+
+int visible147;
+
+
+
+
+
+
+int visible148;
+
+
+
+
+
+
+int visible149;
+
+
+
+
+
+
+int visible150;
+
+
+
+
+
+
+int visible151;
+
+
+
+
+
+
+int visible152;
+
+
+
+
+
+
+int visible153;
+
+
+
+
+
+
+int visible154;
+
+
+
+
+
+
+int visible155;
+
+
+
+
+
+
+int visible156;
+
+
+
+
+
+
+int visible157;
+
+
+
+
+
+
+int visible158;
+
+
+
+
+
+
+int visible159;
+
+
+
+
+
+
+int visible160;
+
+
+
+
+
+
+int visible161;
+
+
+
+
+
+
+int visible162;
+
+
+
+
+
+
+int visible163;
+
+
+
+
+
+
+int visible164;
+
+
+
+
+
+
+int visible165;
+
+
+
+
+
+
+int visible166;
+
+
+
+
+
+
+int visible167;
+
+
+
+
+
+
+int visible168;
+
+
+
+
+
+
+int visible169;
+
+
+
+
+
+
+int visible170;
+
+
+
+
+
+
+int visible171;
+
+
+
+
+
+
+int visible172;
+
+
+
+
+
+
+int visible173;
+
+
+
+
+
+
+int visible174;
+
+
+
+
+
+
+int visible175;
+
+
+
+
+
+
+int visible176;
+
+
+
+
+
+
+int visible177;
+
+
+
+
+
+
+int visible178;
+
+
+
+
+
+
+int visible179;
+
+
+
+
+
+
+int visible180;
+
+
+
+
+
+
+int visible181;
+
+
+
+
+
+
+int visible182;
+
+
+
+
+
+
+int visible183;
+
+
+
+
+
+
+int visible184;
+
+
+
+
+
+
+int visible185;
+
+
+
+
+
+
+int visible186;
+
+
+
+
+
+
+int visible187;
+
+
+
+
+
+
+int visible188;
+
+
+
+
+
+
+int visible189;
+
+
+
+
+
+
+int visible190;
+
+
+
+
+
+
+int visible191;
+
+
+
+
+
+
+int visible192;
+
+
+
+
+
+
+int visible193;
+
+
+
+
+
+
+int visible194;
+
+
+
+
+
+
+int visible195;
+
+
+
+
+
+
+int visible196;
+
+
+
+
+
+
+int visible197;
+
+
+
+
+
+
+int visible198;
+
+
+
+
+
+
+int visible199;
+
+
+
+
+
+
+int visible200;
+
+
+
+
+
+
+int visible201;
+
+
+
+
+
+
+int visible202;
+
+
+
+
+
+
+int visible203;
+
+
+
+
+
+
+int visible204;
+
+
+
+
+
+
+int visible205;
+
+
+
+
+
+
+int visible206;
+
+
+
+
+
+
+int visible207;
+
+
+
+
+
+
+int visible208;
+
+
+
+
+
+
+int visible209;
+
+
+
+
+
+
+int visible210;
+
+
+
+
+
+
+int visible211;
+
+
+
+
+
+
+int visible212;
+
+
+
+
+
+
+int visible213;
+
+
+
+
+
+
+int visible214;
+
+
+
+
+
+
+int visible215;
+
+
+
+
+
+
+int visible216;
+
+
+
+
+
+
+int visible217;
+
+
+
+
+
+
+int visible218;
+
+
+
+
+
+
+int visible219;
+
+
+
+
+
+
+int visible220;
+
+
+
+
+
+
+int visible221;
+
+
+
+
+
+
+int visible222;
+
+
+
+
+
+
+int visible223;
+
+
+
+
+
+
+int visible224;
+
+
+
+
+
+
+int visible225;
+
+
+
+
+
+
+int visible226;
+
+
+
+
+
+
+int visible227;
+
+
+
+
+
+
+int visible228;
+
+
+
+
+
+
+int visible229;
+
+
+
+
+
+
+int visible230;
+
+
+
+
+
+
+int visible231;
+
+
+
+
+
+
+int visible232;
+
+
+
+
+
+
+int visible233;
+
+
+
+
+
+
+int visible234;
+
+
+
+
+
+
+int visible235;
+
+
+
+
+
+
+int visible236;
+
+
+
+
+
+
+int visible237;
+
+
+
+
+
+
+int visible238;
+
+
+
+
+
+
+int visible239;
+
+
+
+
+
+
+int visible240;
+
+
+
+
+
+
+int visible241;
+
+
+
+
+
+
+int visible242;
+
+
+
+
+
+
+int visible243;
+
+
+
+
+
+
+int visible244;
+
+
+
+
+
+
+int visible245;
+
+
+
+
+
+
+int visible246;
+
+
+
+
+
+
+int visible247;
+
+
+
+
+
+
+int visible248;
+
+
+
+
+
+
+int visible249;
+
+
+
+
+
+
+int visible250;
+
+
+
+
+
+
+int visible251;
+
+
+
+
+
+
+int visible252;
+
+
+
+
+
+
+int visible253;
+
+
+
+
+
+
+int visible254;
+
+
+
+
+
+
+int visible255;
+
+
+
+
+
+
+int visible256;
+
+
+
+
+
+
+int visible257;
+
+
+
+
+
+
+int visible258;
+
+
+
+
+
+
+int visible259;
+
+
+
+
+
+
+int visible260;
+
+
+
+
+
+
+int visible261;
+
+
+
+
+
+
+int visible262;
+
+
+
+
+
+
+int visible263;
+
+
+
+
+
+
+int visible264;
+
+
+
+
+
+
+int visible265;
+
+
+
+
+
+
+int visible266;
+
+
+
+
+
+
+int visible267;
+
+
+
+
+
+
+int visible268;
+
+
+
+
+
+
+int visible269;
+
+
+
+
+
+
+int visible270;
+
+
+
+
+
+
+int visible271;
+
+
+
+
+
+
+int visible272;
+
+
+
+
+
+
+int visible273;
+
+
+
+
+
+
+int visible274;
+
+
+
+
+
+
+int visible275;
+
+
+
+
+
+
+int visible276;
+
+
+
+
+
+
+int visible277;
+
+
+
+
+
+
+int visible278;
+
+
+
+
+
+
+int visible279;
+
+
+
+
+
+
+int visible280;
+
+
+
+
+
+
+int visible281;
+
+
+
+
+
+
+int visible282;
+
+
+
+
+
+
+int visible283;
+
+
+
+
+
+
+int visible284;
+
+
+
+
+
+
+int visible285;
+
+
+
+
+
+
+int visible286;
+
+
+
+
+
+
+int visible287;
+
+
+
+
+
+
+int visible288;
+
+
+
+
+
+
+int visible289;
+
+
+
+
+
+
+int visible290;
+
+
+
+
+
+
+int visible291;
+
+
+
+
+
+
+int visible292;
+
+
+
+
+
+
+int visible293;
+
+
+
+
+
+
+int visible294;
+
+
+
+
+
+
+int visible295;
+
+
+
+
+
+
+int visible296;
+
+
+
+
+
+
+int visible297;
+
+
+
+
+
+
+int visible298;
+
+
+
+
+
+
+int visible299;
+
+
+
+
+
+
+int visible300;
+
+
+
+
+
+
+int visible301;
+
+
+
+
+
+
+int visible302;
+
+
+
+
+
+
+int visible303;
+
+
+
+
+
+
+int visible304;
+
+
+
+
+
+
+int visible305;
+
+
+
+
+
+
+int visible306;
+
+
+
+
+
+
+int visible307;
+
+
+
+
+
+
+int visible308;
+
+
+
+
+
+
+int visible309;
+
+
+
+
+
+
+int visible310;
+
+
+
+
+
+
+int visible311;
+
+
+
+
+
+
+int visible312;
+
+
+
+
+
+
+int visible313;
+
+
+
+
+
+
+int visible314;
+
+
+
+
+
+
+int visible315;
+
+
+
+
+
+
+int visible316;
+
+
+
+
+
+
+int visible317;
+
+
+
+
+
+
+int visible318;
+
+
+
+
+
+
+int visible319;
+
+
+
+
+
+
+int visible320;
+
+
+
+
+
+
+int visible321;
+
+
+
+
+
+
+int visible322;
+
+
+
+
+
+
+int visible323;
+
+
+
+
+
+
+int visible324;
+
+
+
+
+
+
+int visible325;
+
+
+
+
+
+
+int visible326;
+
+
+
+
+
+
+int visible327;
+
+
+
+
+
+
+int visible328;
+
+
+
+
+
+
+int visible329;
+
+
+
+
+
+
+int visible330;
+
+
+
+
+
+
+int visible331;
+
+
+
+
+
+
+int visible332;
+
+
+
+
+
+
+int visible333;
+
+
+
+
+
+
+int visible334;
+
+
+
+
+
+
+int visible335;
+
+
+
+
+
+
+int visible336;
+
+
+
+
+
+
+int visible337;
+
+
+
+
+
+
+int visible338;
+
+
+
+
+
+
+int visible339;
+
+
+
+
+
+
+int visible340;
+
+
+
+
+
+
+int visible341;
+
+
+
+
+
+
+int visible342;
+
+
+
+
+
+
+int visible343;
+
+
+
+
+
+
+int visible344;
+
+
+
+
+
+
+int visible345;
+
+
+
+
+
+
+int visible346;
+
+
+
+
+
+
+int visible347;
+
+
+
+
+
+
+int visible348;
+
+
+
+
+
+
+int visible349;
+
+
+
+
+
+
+int visible350;
+
+
+
+
+
+
+int visible351;
+
+
+
+
+
+
+int visible352;
+
+
+
+
+
+
+int visible353;
+
+
+
+
+
+
+int visible354;
+
+
+
+
+
+
+int visible355;
+
+
+
+
+
+
+int visible356;
+
+
+
+
+
+
+int visible357;
+
+
+
+
+
+
+int visible358;
+
+
+
+
+
+
+int visible359;
+
+
+
+
+
+
+int visible360;
+
+
+
+
+
+
+int visible361;
+
+
+
+
+
+
+int visible362;
+
+
+
+
+
+
+int visible363;
+
+
+
+
+
+
+int visible364;
+
+
+
+
+
+
+int visible365;
+
+
+
+
+
+
+int visible366;
+
+
+
+
+
+
+int visible367;
+
+
+
+
+
+
+int visible368;
+
+
+
+
+
+
+int visible369;
+
+
+
+
+
+
+int visible370;
+
+
+
+
+
+
+int visible371;
+
+
+
+
+
+
+int visible372;
+
+
+
+
+
+
+int visible373;
+
+
+
+
+
+
+int visible374;
+
+
+
+
+
+
+int visible375;
+
+
+
+
+
+
+int visible376;
+
+
+
+
+
+
+int visible377;
+
+
+
+
+
+
+int visible378;
+
+
+
+
+
+
+int visible379;
+
+
+
+
+
+
+int visible380;
+
+
+
+
+
+
+int visible381;
+
+
+
+
+
+
+int visible382;
+
+
+
+
+
+
+int visible383;
+
+
+
+
+
+
+int visible384;
+
+
+
+
+
+
+int visible385;
+
+
+
+
+
+
+int visible386;
+
+
+
+
+
+
+int visible387;
+
+
+
+
+
+
+int visible388;
+
+
+
+
+
+
+int visible389;
+
+
+
+
+
+
+int visible390;
+
+
+
+
+
+
+int visible391;
+
+
+
+
+
+
+int visible392;
+
+
+
+
+
+
+int visible393;
+
+
+
+
+
+
+int visible394;
+
+
+
+
+
+
+int visible395;
+
+
+
+
+
+
+int visible396;
+
+
+
+
+
+
+int visible397;
+
+
+
+
+
+
+int visible398;
+
+
+
+
+
+
+int visible399;
+
+
+
+
+
+
+int visible400;
+
+
+
+
+
+
+int visible401;
+
+
+
+
+
+
+int visible402;
+
+
+
+
+
+
+int visible403;
+
+
+
+
+
+
+int visible404;
+
+
+
+
+
+
+int visible405;
+
+
+
+
+
+
+int visible406;
+
+
+
+
+
+
+int visible407;
+
+
+
+
+
+
+int visible408;
+
+
+
+
+
+
+int visible409;
+
+
+
+
+
+
+int visible410;
+
+
+
+
+
+
+int visible411;
+
+
+
+
+
+
+int visible412;
+
+
+
+
+
+
+int visible413;
+
+
+
+
+
+
+int visible414;
+
+
+
+
+
+
+int visible415;
+
+
+
+
+
+
+int visible416;
+
+
+
+
+
+
+int visible417;
+
+
+
+
+
+
+int visible418;
+
+
+
+
+
+
+int visible419;
+
+
+
+
+
+
+int visible420;
+
+
+
+
+
+
+int visible421;
+
+
+
+
+
+
+int visible422;
+
+
+
+
+
+
+int visible423;
+
+
+
+
+
+
+int visible424;
+
+
+
+
+
+
+int visible425;
+
+
+
+
+
+
+int visible426;
+
+
+
+
+
+
+int visible427;
+
+
+
+
+
+
+int visible428;
+
+
+
+
+
+
+int visible429;
+
+
+
+
+
+
+int visible430;
+
+
+
+
+
+
+int visible431;
+
+
+
+
+
+
+int visible432;
+
+
+
+
+
+
+int visible433;
+
+
+
+
+
+
+int visible434;
+
+
+
+
+
+
+int visible435;
+
+
+
+
+
+
+int visible436;
+
+
+
+
+
+
+int visible437;
+
+
+
+
+
+
+int visible438;
+
+
+
+
+
+
+int visible439;
+
+
+
+
+
+
+int visible440;
+
+
+
+
+
+
+int visible441;
+
+
+
+
+
+
+int visible442;
+
+
+
+
+
+
+int visible443;
+
+
+
+
+
+
+int visible444;
+
+
+
+
+
+
+int visible445;
+
+
+
+
+
+
+int visible446;
+
+
+
+
+
+
+int visible447;
+
+
+
+
+
+
+int visible448;
+
+
+
+
+
+
+int visible449;
+
+
+
+
+
+
+int visible450;
+
+
+
+
+
+
+int visible451;
+
+
+
+
+
+
+int visible452;
+
+
+
+
+
+
+int visible453;
+
+
+
+
+
+
+int visible454;
+
+
+
+
+
+
+int visible455;
+
+
+
+
+
+
+int visible456;
+
+
+
+
+
+
+int visible457;
+
+
+
+
+
+
+int visible458;
+
+
+
+
+
+
+int visible459;
+
+
+
+
+
+
+int visible460;
+
+
+
+
+
+
+int visible461;
+
+
+
+
+
+
+int visible462;
+
+
+
+
+
+
+int visible463;
+
+
+
+
+
+
+int visible464;
+
+
+
+
+
+
+int visible465;
+
+
+
+
+
+
+int visible466;
+
+
+
+
+
+
+int visible467;
+
+
+
+
+
+
+int visible468;
+
+
+
+
+
+
+int visible469;
+
+
+
+
+
+
+int visible470;
+
+
+
+
+
+
+int visible471;
+
+
+
+
+
+
+int visible472;
+
+
+
+
+
+
+int visible473;
+
+
+
+
+
+
+int visible474;
+
+
+
+
+
+
+int visible475;
+
+
+
+
+
+
+int visible476;
+
+
+
+
+
+
+int visible477;
+
+
+
+
+
+
+int visible478;
+
+
+
+
+
+
+int visible479;
+
+
+
+
+
+
+int visible480;
+
+
+
+
+
+
+int visible481;
+
+
+
+
+
+
+int visible482;
+
+
+
+
+
+
+int visible483;
+
+
+
+
+
+
+int visible484;
+
+
+
+
+
+
+int visible485;
+
+
+
+
+
+
+int visible486;
+
+
+
+
+
+
+int visible487;
+
+
+
+
+
+
+int visible488;
+
+
+
+
+
+
+int visible489;
+
+
+
+
+
+
+int visible490;
+
+
+
+
+
+
+int visible491;
+
+
+
+
+
+
+int visible492;
+
+
+
+
+
+
+int visible493;
+
+
+
+
+
+
+int visible494;
+
+
+
+
+
+
+int visible495;
+
+
+
+
+
+
+int visible496;
+
+
+
+
+
+
+int visible497;
+
+
+
+
+
+
+int visible498;
+
+
+
+
+
+
+int visible499;
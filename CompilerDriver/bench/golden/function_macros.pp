@@ -0,0 +1,2001 @@
+# 4 "function_macros.c"
+int add0000 = (x0000 + 0);
+int mul0001 = (y0001 * 1);
+int sel0002 = (z0002 ? 2 : 0);
+int add0003 = (x0003 + 3);
+int mul0004 = (y0004 * 4);
+int sel0005 = (z0005 ? 5 : 0);
+int add0006 = (x0006 + 6);
+int mul0007 = (y0007 * 7);
+int sel0008 = (z0008 ? 8 : 0);
+int add0009 = (x0009 + 9);
+int mul0010 = (y0010 * 10);
+int sel0011 = (z0011 ? 11 : 0);
+int add0012 = (x0012 + 12);
+int mul0013 = (y0013 * 13);
+int sel0014 = (z0014 ? 14 : 0);
+int add0015 = (x0015 + 15);
+int mul0016 = (y0016 * 16);
+int sel0017 = (z0017 ? 17 : 0);
+int add0018 = (x0018 + 18);
+int mul0019 = (y0019 * 19);
+int sel0020 = (z0020 ? 20 : 0);
+int add0021 = (x0021 + 21);
+int mul0022 = (y0022 * 22);
+int sel0023 = (z0023 ? 23 : 0);
+int add0024 = (x0024 + 24);
+int mul0025 = (y0025 * 25);
+int sel0026 = (z0026 ? 26 : 0);
+int add0027 = (x0027 + 27);
+int mul0028 = (y0028 * 28);
+int sel0029 = (z0029 ? 29 : 0);
+int add0030 = (x0030 + 30);
+int mul0031 = (y0031 * 31);
+int sel0032 = (z0032 ? 32 : 0);
+int add0033 = (x0033 + 33);
+int mul0034 = (y0034 * 34);
+int sel0035 = (z0035 ? 35 : 0);
+int add0036 = (x0036 + 36);
+int mul0037 = (y0037 * 37);
+int sel0038 = (z0038 ? 38 : 0);
+int add0039 = (x0039 + 39);
+int mul0040 = (y0040 * 40);
+int sel0041 = (z0041 ? 41 : 0);
+int add0042 = (x0042 + 42);
+int mul0043 = (y0043 * 43);
+int sel0044 = (z0044 ? 44 : 0);
+int add0045 = (x0045 + 45);
+int mul0046 = (y0046 * 46);
+int sel0047 = (z0047 ? 47 : 0);
+int add0048 = (x0048 + 48);
+int mul0049 = (y0049 * 49);
+int sel0050 = (z0050 ? 50 : 0);
+int add0051 = (x0051 + 51);
+int mul0052 = (y0052 * 52);
+int sel0053 = (z0053 ? 53 : 0);
+int add0054 = (x0054 + 54);
+int mul0055 = (y0055 * 55);
+int sel0056 = (z0056 ? 56 : 0);
+int add0057 = (x0057 + 57);
+int mul0058 = (y0058 * 58);
+int sel0059 = (z0059 ? 59 : 0);
+int add0060 = (x0060 + 60);
+int mul0061 = (y0061 * 61);
+int sel0062 = (z0062 ? 62 : 0);
+int add0063 = (x0063 + 63);
+int mul0064 = (y0064 * 64);
+int sel0065 = (z0065 ? 65 : 0);
+int add0066 = (x0066 + 66);
+int mul0067 = (y0067 * 67);
+int sel0068 = (z0068 ? 68 : 0);
+int add0069 = (x0069 + 69);
+int mul0070 = (y0070 * 70);
+int sel0071 = (z0071 ? 71 : 0);
+int add0072 = (x0072 + 72);
+int mul0073 = (y0073 * 73);
+int sel0074 = (z0074 ? 74 : 0);
+int add0075 = (x0075 + 75);
+int mul0076 = (y0076 * 76);
+int sel0077 = (z0077 ? 77 : 0);
+int add0078 = (x0078 + 78);
+int mul0079 = (y0079 * 79);
+int sel0080 = (z0080 ? 80 : 0);
+int add0081 = (x0081 + 81);
+int mul0082 = (y0082 * 82);
+int sel0083 = (z0083 ? 83 : 0);
+int add0084 = (x0084 + 84);
+int mul0085 = (y0085 * 85);
+int sel0086 = (z0086 ? 86 : 0);
+int add0087 = (x0087 + 87);
+int mul0088 = (y0088 * 88);
+int sel0089 = (z0089 ? 89 : 0);
+int add0090 = (x0090 + 90);
+int mul0091 = (y0091 * 91);
+int sel0092 = (z0092 ? 92 : 0);
+int add0093 = (x0093 + 93);
+int mul0094 = (y0094 * 94);
+int sel0095 = (z0095 ? 95 : 0);
+int add0096 = (x0096 + 96);
+int mul0097 = (y0097 * 97);
+int sel0098 = (z0098 ? 98 : 0);
+int add0099 = (x0099 + 99);
+int mul0100 = (y0100 * 100);
+int sel0101 = (z0101 ? 101 : 0);
+int add0102 = (x0102 + 102);
+int mul0103 = (y0103 * 103);
+int sel0104 = (z0104 ? 104 : 0);
+int add0105 = (x0105 + 105);
+int mul0106 = (y0106 * 106);
+int sel0107 = (z0107 ? 107 : 0);
+int add0108 = (x0108 + 108);
+int mul0109 = (y0109 * 109);
+int sel0110 = (z0110 ? 110 : 0);
+int add0111 = (x0111 + 111);
+int mul0112 = (y0112 * 112);
+int sel0113 = (z0113 ? 113 : 0);
+int add0114 = (x0114 + 114);
+int mul0115 = (y0115 * 115);
+int sel0116 = (z0116 ? 116 : 0);
+int add0117 = (x0117 + 117);
+int mul0118 = (y0118 * 118);
+int sel0119 = (z0119 ? 119 : 0);
+int add0120 = (x0120 + 120);
+int mul0121 = (y0121 * 121);
+int sel0122 = (z0122 ? 122 : 0);
+int add0123 = (x0123 + 123);
+int mul0124 = (y0124 * 124);
+int sel0125 = (z0125 ? 125 : 0);
+int add0126 = (x0126 + 126);
+int mul0127 = (y0127 * 127);
+int sel0128 = (z0128 ? 128 : 0);
+int add0129 = (x0129 + 129);
+int mul0130 = (y0130 * 130);
+int sel0131 = (z0131 ? 131 : 0);
+int add0132 = (x0132 + 132);
+int mul0133 = (y0133 * 133);
+int sel0134 = (z0134 ? 134 : 0);
+int add0135 = (x0135 + 135);
+int mul0136 = (y0136 * 136);
+int sel0137 = (z0137 ? 137 : 0);
+int add0138 = (x0138 + 138);
+int mul0139 = (y0139 * 139);
+int sel0140 = (z0140 ? 140 : 0);
+int add0141 = (x0141 + 141);
+int mul0142 = (y0142 * 142);
+int sel0143 = (z0143 ? 143 : 0);
+int add0144 = (x0144 + 144);
+int mul0145 = (y0145 * 145);
+int sel0146 = (z0146 ? 146 : 0);
+int add0147 = (x0147 + 147);
+int mul0148 = (y0148 * 148);
+int sel0149 = (z0149 ? 149 : 0);
+int add0150 = (x0150 + 150);
+int mul0151 = (y0151 * 151);
+int sel0152 = (z0152 ? 152 : 0);
+int add0153 = (x0153 + 153);
+int mul0154 = (y0154 * 154);
+int sel0155 = (z0155 ? 155 : 0);
+int add0156 = (x0156 + 156);
+int mul0157 = (y0157 * 157);
+int sel0158 = (z0158 ? 158 : 0);
+int add0159 = (x0159 + 159);
+int mul0160 = (y0160 * 160);
+int sel0161 = (z0161 ? 161 : 0);
+int add0162 = (x0162 + 162);
+int mul0163 = (y0163 * 163);
+int sel0164 = (z0164 ? 164 : 0);
+int add0165 = (x0165 + 165);
+int mul0166 = (y0166 * 166);
+int sel0167 = (z0167 ? 167 : 0);
+int add0168 = (x0168 + 168);
+int mul0169 = (y0169 * 169);
+int sel0170 = (z0170 ? 170 : 0);
+int add0171 = (x0171 + 171);
+int mul0172 = (y0172 * 172);
+int sel0173 = (z0173 ? 173 : 0);
+int add0174 = (x0174 + 174);
+int mul0175 = (y0175 * 175);
+int sel0176 = (z0176 ? 176 : 0);
+int add0177 = (x0177 + 177);
+int mul0178 = (y0178 * 178);
+int sel0179 = (z0179 ? 179 : 0);
+int add0180 = (x0180 + 180);
+int mul0181 = (y0181 * 181);
+int sel0182 = (z0182 ? 182 : 0);
+int add0183 = (x0183 + 183);
+int mul0184 = (y0184 * 184);
+int sel0185 = (z0185 ? 185 : 0);
+int add0186 = (x0186 + 186);
+int mul0187 = (y0187 * 187);
+int sel0188 = (z0188 ? 188 : 0);
+int add0189 = (x0189 + 189);
+int mul0190 = (y0190 * 190);
+int sel0191 = (z0191 ? 191 : 0);
+int add0192 = (x0192 + 192);
+int mul0193 = (y0193 * 193);
+int sel0194 = (z0194 ? 194 : 0);
+int add0195 = (x0195 + 195);
+int mul0196 = (y0196 * 196);
+int sel0197 = (z0197 ? 197 : 0);
+int add0198 = (x0198 + 198);
+int mul0199 = (y0199 * 199);
+int sel0200 = (z0200 ? 200 : 0);
+int add0201 = (x0201 + 201);
+int mul0202 = (y0202 * 202);
+int sel0203 = (z0203 ? 203 : 0);
+int add0204 = (x0204 + 204);
+int mul0205 = (y0205 * 205);
+int sel0206 = (z0206 ? 206 : 0);
+int add0207 = (x0207 + 207);
+int mul0208 = (y0208 * 208);
+int sel0209 = (z0209 ? 209 : 0);
+int add0210 = (x0210 + 210);
+int mul0211 = (y0211 * 211);
+int sel0212 = (z0212 ? 212 : 0);
+int add0213 = (x0213 + 213);
+int mul0214 = (y0214 * 214);
+int sel0215 = (z0215 ? 215 : 0);
+int add0216 = (x0216 + 216);
+int mul0217 = (y0217 * 217);
+int sel0218 = (z0218 ? 218 : 0);
+int add0219 = (x0219 + 219);
+int mul0220 = (y0220 * 220);
+int sel0221 = (z0221 ? 221 : 0);
+int add0222 = (x0222 + 222);
+int mul0223 = (y0223 * 223);
+int sel0224 = (z0224 ? 224 : 0);
+int add0225 = (x0225 + 225);
+int mul0226 = (y0226 * 226);
+int sel0227 = (z0227 ? 227 : 0);
+int add0228 = (x0228 + 228);
+int mul0229 = (y0229 * 229);
+int sel0230 = (z0230 ? 230 : 0);
+int add0231 = (x0231 + 231);
+int mul0232 = (y0232 * 232);
+int sel0233 = (z0233 ? 233 : 0);
+int add0234 = (x0234 + 234);
+int mul0235 = (y0235 * 235);
+int sel0236 = (z0236 ? 236 : 0);
+int add0237 = (x0237 + 237);
+int mul0238 = (y0238 * 238);
+int sel0239 = (z0239 ? 239 : 0);
+int add0240 = (x0240 + 240);
+int mul0241 = (y0241 * 241);
+int sel0242 = (z0242 ? 242 : 0);
+int add0243 = (x0243 + 243);
+int mul0244 = (y0244 * 244);
+int sel0245 = (z0245 ? 245 : 0);
+int add0246 = (x0246 + 246);
+int mul0247 = (y0247 * 247);
+int sel0248 = (z0248 ? 248 : 0);
+int add0249 = (x0249 + 249);
+int mul0250 = (y0250 * 250);
+int sel0251 = (z0251 ? 251 : 0);
+int add0252 = (x0252 + 252);
+int mul0253 = (y0253 * 253);
+int sel0254 = (z0254 ? 254 : 0);
+int add0255 = (x0255 + 255);
+int mul0256 = (y0256 * 256);
+int sel0257 = (z0257 ? 257 : 0);
+int add0258 = (x0258 + 258);
+int mul0259 = (y0259 * 259);
+int sel0260 = (z0260 ? 260 : 0);
+int add0261 = (x0261 + 261);
+int mul0262 = (y0262 * 262);
+int sel0263 = (z0263 ? 263 : 0);
+int add0264 = (x0264 + 264);
+int mul0265 = (y0265 * 265);
+int sel0266 = (z0266 ? 266 : 0);
+int add0267 = (x0267 + 267);
+int mul0268 = (y0268 * 268);
+int sel0269 = (z0269 ? 269 : 0);
+int add0270 = (x0270 + 270);
+int mul0271 = (y0271 * 271);
+int sel0272 = (z0272 ? 272 : 0);
+int add0273 = (x0273 + 273);
+int mul0274 = (y0274 * 274);
+int sel0275 = (z0275 ? 275 : 0);
+int add0276 = (x0276 + 276);
+int mul0277 = (y0277 * 277);
+int sel0278 = (z0278 ? 278 : 0);
+int add0279 = (x0279 + 279);
+int mul0280 = (y0280 * 280);
+int sel0281 = (z0281 ? 281 : 0);
+int add0282 = (x0282 + 282);
+int mul0283 = (y0283 * 283);
+int sel0284 = (z0284 ? 284 : 0);
+int add0285 = (x0285 + 285);
+int mul0286 = (y0286 * 286);
+int sel0287 = (z0287 ? 287 : 0);
+int add0288 = (x0288 + 288);
+int mul0289 = (y0289 * 289);
+int sel0290 = (z0290 ? 290 : 0);
+int add0291 = (x0291 + 291);
+int mul0292 = (y0292 * 292);
+int sel0293 = (z0293 ? 293 : 0);
+int add0294 = (x0294 + 294);
+int mul0295 = (y0295 * 295);
+int sel0296 = (z0296 ? 296 : 0);
+int add0297 = (x0297 + 297);
+int mul0298 = (y0298 * 298);
+int sel0299 = (z0299 ? 299 : 0);
+int add0300 = (x0300 + 300);
+int mul0301 = (y0301 * 301);
+int sel0302 = (z0302 ? 302 : 0);
+int add0303 = (x0303 + 303);
+int mul0304 = (y0304 * 304);
+int sel0305 = (z0305 ? 305 : 0);
+int add0306 = (x0306 + 306);
+int mul0307 = (y0307 * 307);
+int sel0308 = (z0308 ? 308 : 0);
+int add0309 = (x0309 + 309);
+int mul0310 = (y0310 * 310);
+int sel0311 = (z0311 ? 311 : 0);
+int add0312 = (x0312 + 312);
+int mul0313 = (y0313 * 313);
+int sel0314 = (z0314 ? 314 : 0);
+int add0315 = (x0315 + 315);
+int mul0316 = (y0316 * 316);
+int sel0317 = (z0317 ? 317 : 0);
+int add0318 = (x0318 + 318);
+int mul0319 = (y0319 * 319);
+int sel0320 = (z0320 ? 320 : 0);
+int add0321 = (x0321 + 321);
+int mul0322 = (y0322 * 322);
+int sel0323 = (z0323 ? 323 : 0);
+int add0324 = (x0324 + 324);
+int mul0325 = (y0325 * 325);
+int sel0326 = (z0326 ? 326 : 0);
+int add0327 = (x0327 + 327);
+int mul0328 = (y0328 * 328);
+int sel0329 = (z0329 ? 329 : 0);
+int add0330 = (x0330 + 330);
+int mul0331 = (y0331 * 331);
+int sel0332 = (z0332 ? 332 : 0);
+int add0333 = (x0333 + 333);
+int mul0334 = (y0334 * 334);
+int sel0335 = (z0335 ? 335 : 0);
+int add0336 = (x0336 + 336);
+int mul0337 = (y0337 * 337);
+int sel0338 = (z0338 ? 338 : 0);
+int add0339 = (x0339 + 339);
+int mul0340 = (y0340 * 340);
+int sel0341 = (z0341 ? 341 : 0);
+int add0342 = (x0342 + 342);
+int mul0343 = (y0343 * 343);
+int sel0344 = (z0344 ? 344 : 0);
+int add0345 = (x0345 + 345);
+int mul0346 = (y0346 * 346);
+int sel0347 = (z0347 ? 347 : 0);
+int add0348 = (x0348 + 348);
+int mul0349 = (y0349 * 349);
+int sel0350 = (z0350 ? 350 : 0);
+int add0351 = (x0351 + 351);
+int mul0352 = (y0352 * 352);
+int sel0353 = (z0353 ? 353 : 0);
+int add0354 = (x0354 + 354);
+int mul0355 = (y0355 * 355);
+int sel0356 = (z0356 ? 356 : 0);
+int add0357 = (x0357 + 357);
+int mul0358 = (y0358 * 358);
+int sel0359 = (z0359 ? 359 : 0);
+int add0360 = (x0360 + 360);
+int mul0361 = (y0361 * 361);
+int sel0362 = (z0362 ? 362 : 0);
+int add0363 = (x0363 + 363);
+int mul0364 = (y0364 * 364);
+int sel0365 = (z0365 ? 365 : 0);
+int add0366 = (x0366 + 366);
+int mul0367 = (y0367 * 367);
+int sel0368 = (z0368 ? 368 : 0);
+int add0369 = (x0369 + 369);
+int mul0370 = (y0370 * 370);
+int sel0371 = (z0371 ? 371 : 0);
+int add0372 = (x0372 + 372);
+int mul0373 = (y0373 * 373);
+int sel0374 = (z0374 ? 374 : 0);
+int add0375 = (x0375 + 375);
+int mul0376 = (y0376 * 376);
+int sel0377 = (z0377 ? 377 : 0);
+int add0378 = (x0378 + 378);
+int mul0379 = (y0379 * 379);
+int sel0380 = (z0380 ? 380 : 0);
+int add0381 = (x0381 + 381);
+int mul0382 = (y0382 * 382);
+int sel0383 = (z0383 ? 383 : 0);
+int add0384 = (x0384 + 384);
+int mul0385 = (y0385 * 385);
+int sel0386 = (z0386 ? 386 : 0);
+int add0387 = (x0387 + 387);
+int mul0388 = (y0388 * 388);
+int sel0389 = (z0389 ? 389 : 0);
+int add0390 = (x0390 + 390);
+int mul0391 = (y0391 * 391);
+int sel0392 = (z0392 ? 392 : 0);
+int add0393 = (x0393 + 393);
+int mul0394 = (y0394 * 394);
+int sel0395 = (z0395 ? 395 : 0);
+int add0396 = (x0396 + 396);
+int mul0397 = (y0397 * 397);
+int sel0398 = (z0398 ? 398 : 0);
+int add0399 = (x0399 + 399);
+int mul0400 = (y0400 * 400);
+int sel0401 = (z0401 ? 401 : 0);
+int add0402 = (x0402 + 402);
+int mul0403 = (y0403 * 403);
+int sel0404 = (z0404 ? 404 : 0);
+int add0405 = (x0405 + 405);
+int mul0406 = (y0406 * 406);
+int sel0407 = (z0407 ? 407 : 0);
+int add0408 = (x0408 + 408);
+int mul0409 = (y0409 * 409);
+int sel0410 = (z0410 ? 410 : 0);
+int add0411 = (x0411 + 411);
+int mul0412 = (y0412 * 412);
+int sel0413 = (z0413 ? 413 : 0);
+int add0414 = (x0414 + 414);
+int mul0415 = (y0415 * 415);
+int sel0416 = (z0416 ? 416 : 0);
+int add0417 = (x0417 + 417);
+int mul0418 = (y0418 * 418);
+int sel0419 = (z0419 ? 419 : 0);
+int add0420 = (x0420 + 420);
+int mul0421 = (y0421 * 421);
+int sel0422 = (z0422 ? 422 : 0);
+int add0423 = (x0423 + 423);
+int mul0424 = (y0424 * 424);
+int sel0425 = (z0425 ? 425 : 0);
+int add0426 = (x0426 + 426);
+int mul0427 = (y0427 * 427);
+int sel0428 = (z0428 ? 428 : 0);
+int add0429 = (x0429 + 429);
+int mul0430 = (y0430 * 430);
+int sel0431 = (z0431 ? 431 : 0);
+int add0432 = (x0432 + 432);
+int mul0433 = (y0433 * 433);
+int sel0434 = (z0434 ? 434 : 0);
+int add0435 = (x0435 + 435);
+int mul0436 = (y0436 * 436);
+int sel0437 = (z0437 ? 437 : 0);
+int add0438 = (x0438 + 438);
+int mul0439 = (y0439 * 439);
+int sel0440 = (z0440 ? 440 : 0);
+int add0441 = (x0441 + 441);
+int mul0442 = (y0442 * 442);
+int sel0443 = (z0443 ? 443 : 0);
+int add0444 = (x0444 + 444);
+int mul0445 = (y0445 * 445);
+int sel0446 = (z0446 ? 446 : 0);
+int add0447 = (x0447 + 447);
+int mul0448 = (y0448 * 448);
+int sel0449 = (z0449 ? 449 : 0);
+int add0450 = (x0450 + 450);
+int mul0451 = (y0451 * 451);
+int sel0452 = (z0452 ? 452 : 0);
+int add0453 = (x0453 + 453);
+int mul0454 = (y0454 * 454);
+int sel0455 = (z0455 ? 455 : 0);
+int add0456 = (x0456 + 456);
+int mul0457 = (y0457 * 457);
+int sel0458 = (z0458 ? 458 : 0);
+int add0459 = (x0459 + 459);
+int mul0460 = (y0460 * 460);
+int sel0461 = (z0461 ? 461 : 0);
+int add0462 = (x0462 + 462);
+int mul0463 = (y0463 * 463);
+int sel0464 = (z0464 ? 464 : 0);
+int add0465 = (x0465 + 465);
+int mul0466 = (y0466 * 466);
+int sel0467 = (z0467 ? 467 : 0);
+int add0468 = (x0468 + 468);
+int mul0469 = (y0469 * 469);
+int sel0470 = (z0470 ? 470 : 0);
+int add0471 = (x0471 + 471);
+int mul0472 = (y0472 * 472);
+int sel0473 = (z0473 ? 473 : 0);
+int add0474 = (x0474 + 474);
+int mul0475 = (y0475 * 475);
+int sel0476 = (z0476 ? 476 : 0);
+int add0477 = (x0477 + 477);
+int mul0478 = (y0478 * 478);
+int sel0479 = (z0479 ? 479 : 0);
+int add0480 = (x0480 + 480);
+int mul0481 = (y0481 * 481);
+int sel0482 = (z0482 ? 482 : 0);
+int add0483 = (x0483 + 483);
+int mul0484 = (y0484 * 484);
+int sel0485 = (z0485 ? 485 : 0);
+int add0486 = (x0486 + 486);
+int mul0487 = (y0487 * 487);
+int sel0488 = (z0488 ? 488 : 0);
+int add0489 = (x0489 + 489);
+int mul0490 = (y0490 * 490);
+int sel0491 = (z0491 ? 491 : 0);
+int add0492 = (x0492 + 492);
+int mul0493 = (y0493 * 493);
+int sel0494 = (z0494 ? 494 : 0);
+int add0495 = (x0495 + 495);
+int mul0496 = (y0496 * 496);
+int sel0497 = (z0497 ? 497 : 0);
+int add0498 = (x0498 + 498);
+int mul0499 = (y0499 * 499);
+int sel0500 = (z0500 ? 500 : 0);
+int add0501 = (x0501 + 501);
+int mul0502 = (y0502 * 502);
+int sel0503 = (z0503 ? 503 : 0);
+int add0504 = (x0504 + 504);
+int mul0505 = (y0505 * 505);
+int sel0506 = (z0506 ? 506 : 0);
+int add0507 = (x0507 + 507);
+int mul0508 = (y0508 * 508);
+int sel0509 = (z0509 ? 509 : 0);
+int add0510 = (x0510 + 510);
+int mul0511 = (y0511 * 511);
+int sel0512 = (z0512 ? 512 : 0);
+int add0513 = (x0513 + 513);
+int mul0514 = (y0514 * 514);
+int sel0515 = (z0515 ? 515 : 0);
+int add0516 = (x0516 + 516);
+int mul0517 = (y0517 * 517);
+int sel0518 = (z0518 ? 518 : 0);
+int add0519 = (x0519 + 519);
+int mul0520 = (y0520 * 520);
+int sel0521 = (z0521 ? 521 : 0);
+int add0522 = (x0522 + 522);
+int mul0523 = (y0523 * 523);
+int sel0524 = (z0524 ? 524 : 0);
+int add0525 = (x0525 + 525);
+int mul0526 = (y0526 * 526);
+int sel0527 = (z0527 ? 527 : 0);
+int add0528 = (x0528 + 528);
+int mul0529 = (y0529 * 529);
+int sel0530 = (z0530 ? 530 : 0);
+int add0531 = (x0531 + 531);
+int mul0532 = (y0532 * 532);
+int sel0533 = (z0533 ? 533 : 0);
+int add0534 = (x0534 + 534);
+int mul0535 = (y0535 * 535);
+int sel0536 = (z0536 ? 536 : 0);
+int add0537 = (x0537 + 537);
+int mul0538 = (y0538 * 538);
+int sel0539 = (z0539 ? 539 : 0);
+int add0540 = (x0540 + 540);
+int mul0541 = (y0541 * 541);
+int sel0542 = (z0542 ? 542 : 0);
+int add0543 = (x0543 + 543);
+int mul0544 = (y0544 * 544);
+int sel0545 = (z0545 ? 545 : 0);
+int add0546 = (x0546 + 546);
+int mul0547 = (y0547 * 547);
+int sel0548 = (z0548 ? 548 : 0);
+int add0549 = (x0549 + 549);
+int mul0550 = (y0550 * 550);
+int sel0551 = (z0551 ? 551 : 0);
+int add0552 = (x0552 + 552);
+int mul0553 = (y0553 * 553);
+int sel0554 = (z0554 ? 554 : 0);
+int add0555 = (x0555 + 555);
+int mul0556 = (y0556 * 556);
+int sel0557 = (z0557 ? 557 : 0);
+int add0558 = (x0558 + 558);
+int mul0559 = (y0559 * 559);
+int sel0560 = (z0560 ? 560 : 0);
+int add0561 = (x0561 + 561);
+int mul0562 = (y0562 * 562);
+int sel0563 = (z0563 ? 563 : 0);
+int add0564 = (x0564 + 564);
+int mul0565 = (y0565 * 565);
+int sel0566 = (z0566 ? 566 : 0);
+int add0567 = (x0567 + 567);
+int mul0568 = (y0568 * 568);
+int sel0569 = (z0569 ? 569 : 0);
+int add0570 = (x0570 + 570);
+int mul0571 = (y0571 * 571);
+int sel0572 = (z0572 ? 572 : 0);
+int add0573 = (x0573 + 573);
+int mul0574 = (y0574 * 574);
+int sel0575 = (z0575 ? 575 : 0);
+int add0576 = (x0576 + 576);
+int mul0577 = (y0577 * 577);
+int sel0578 = (z0578 ? 578 : 0);
+int add0579 = (x0579 + 579);
+int mul0580 = (y0580 * 580);
+int sel0581 = (z0581 ? 581 : 0);
+int add0582 = (x0582 + 582);
+int mul0583 = (y0583 * 583);
+int sel0584 = (z0584 ? 584 : 0);
+int add0585 = (x0585 + 585);
+int mul0586 = (y0586 * 586);
+int sel0587 = (z0587 ? 587 : 0);
+int add0588 = (x0588 + 588);
+int mul0589 = (y0589 * 589);
+int sel0590 = (z0590 ? 590 : 0);
+int add0591 = (x0591 + 591);
+int mul0592 = (y0592 * 592);
+int sel0593 = (z0593 ? 593 : 0);
+int add0594 = (x0594 + 594);
+int mul0595 = (y0595 * 595);
+int sel0596 = (z0596 ? 596 : 0);
+int add0597 = (x0597 + 597);
+int mul0598 = (y0598 * 598);
+int sel0599 = (z0599 ? 599 : 0);
+int add0600 = (x0600 + 600);
+int mul0601 = (y0601 * 601);
+int sel0602 = (z0602 ? 602 : 0);
+int add0603 = (x0603 + 603);
+int mul0604 = (y0604 * 604);
+int sel0605 = (z0605 ? 605 : 0);
+int add0606 = (x0606 + 606);
+int mul0607 = (y0607 * 607);
+int sel0608 = (z0608 ? 608 : 0);
+int add0609 = (x0609 + 609);
+int mul0610 = (y0610 * 610);
+int sel0611 = (z0611 ? 611 : 0);
+int add0612 = (x0612 + 612);
+int mul0613 = (y0613 * 613);
+int sel0614 = (z0614 ? 614 : 0);
+int add0615 = (x0615 + 615);
+int mul0616 = (y0616 * 616);
+int sel0617 = (z0617 ? 617 : 0);
+int add0618 = (x0618 + 618);
+int mul0619 = (y0619 * 619);
+int sel0620 = (z0620 ? 620 : 0);
+int add0621 = (x0621 + 621);
+int mul0622 = (y0622 * 622);
+int sel0623 = (z0623 ? 623 : 0);
+int add0624 = (x0624 + 624);
+int mul0625 = (y0625 * 625);
+int sel0626 = (z0626 ? 626 : 0);
+int add0627 = (x0627 + 627);
+int mul0628 = (y0628 * 628);
+int sel0629 = (z0629 ? 629 : 0);
+int add0630 = (x0630 + 630);
+int mul0631 = (y0631 * 631);
+int sel0632 = (z0632 ? 632 : 0);
+int add0633 = (x0633 + 633);
+int mul0634 = (y0634 * 634);
+int sel0635 = (z0635 ? 635 : 0);
+int add0636 = (x0636 + 636);
+int mul0637 = (y0637 * 637);
+int sel0638 = (z0638 ? 638 : 0);
+int add0639 = (x0639 + 639);
+int mul0640 = (y0640 * 640);
+int sel0641 = (z0641 ? 641 : 0);
+int add0642 = (x0642 + 642);
+int mul0643 = (y0643 * 643);
+int sel0644 = (z0644 ? 644 : 0);
+int add0645 = (x0645 + 645);
+int mul0646 = (y0646 * 646);
+int sel0647 = (z0647 ? 647 : 0);
+int add0648 = (x0648 + 648);
+int mul0649 = (y0649 * 649);
+int sel0650 = (z0650 ? 650 : 0);
+int add0651 = (x0651 + 651);
+int mul0652 = (y0652 * 652);
+int sel0653 = (z0653 ? 653 : 0);
+int add0654 = (x0654 + 654);
+int mul0655 = (y0655 * 655);
+int sel0656 = (z0656 ? 656 : 0);
+int add0657 = (x0657 + 657);
+int mul0658 = (y0658 * 658);
+int sel0659 = (z0659 ? 659 : 0);
+int add0660 = (x0660 + 660);
+int mul0661 = (y0661 * 661);
+int sel0662 = (z0662 ? 662 : 0);
+int add0663 = (x0663 + 663);
+int mul0664 = (y0664 * 664);
+int sel0665 = (z0665 ? 665 : 0);
+int add0666 = (x0666 + 666);
+int mul0667 = (y0667 * 667);
+int sel0668 = (z0668 ? 668 : 0);
+int add0669 = (x0669 + 669);
+int mul0670 = (y0670 * 670);
+int sel0671 = (z0671 ? 671 : 0);
+int add0672 = (x0672 + 672);
+int mul0673 = (y0673 * 673);
+int sel0674 = (z0674 ? 674 : 0);
+int add0675 = (x0675 + 675);
+int mul0676 = (y0676 * 676);
+int sel0677 = (z0677 ? 677 : 0);
+int add0678 = (x0678 + 678);
+int mul0679 = (y0679 * 679);
+int sel0680 = (z0680 ? 680 : 0);
+int add0681 = (x0681 + 681);
+int mul0682 = (y0682 * 682);
+int sel0683 = (z0683 ? 683 : 0);
+int add0684 = (x0684 + 684);
+int mul0685 = (y0685 * 685);
+int sel0686 = (z0686 ? 686 : 0);
+int add0687 = (x0687 + 687);
+int mul0688 = (y0688 * 688);
+int sel0689 = (z0689 ? 689 : 0);
+int add0690 = (x0690 + 690);
+int mul0691 = (y0691 * 691);
+int sel0692 = (z0692 ? 692 : 0);
+int add0693 = (x0693 + 693);
+int mul0694 = (y0694 * 694);
+int sel0695 = (z0695 ? 695 : 0);
+int add0696 = (x0696 + 696);
+int mul0697 = (y0697 * 697);
+int sel0698 = (z0698 ? 698 : 0);
+int add0699 = (x0699 + 699);
+int mul0700 = (y0700 * 700);
+int sel0701 = (z0701 ? 701 : 0);
+int add0702 = (x0702 + 702);
+int mul0703 = (y0703 * 703);
+int sel0704 = (z0704 ? 704 : 0);
+int add0705 = (x0705 + 705);
+int mul0706 = (y0706 * 706);
+int sel0707 = (z0707 ? 707 : 0);
+int add0708 = (x0708 + 708);
+int mul0709 = (y0709 * 709);
+int sel0710 = (z0710 ? 710 : 0);
+int add0711 = (x0711 + 711);
+int mul0712 = (y0712 * 712);
+int sel0713 = (z0713 ? 713 : 0);
+int add0714 = (x0714 + 714);
+int mul0715 = (y0715 * 715);
+int sel0716 = (z0716 ? 716 : 0);
+int add0717 = (x0717 + 717);
+int mul0718 = (y0718 * 718);
+int sel0719 = (z0719 ? 719 : 0);
+int add0720 = (x0720 + 720);
+int mul0721 = (y0721 * 721);
+int sel0722 = (z0722 ? 722 : 0);
+int add0723 = (x0723 + 723);
+int mul0724 = (y0724 * 724);
+int sel0725 = (z0725 ? 725 : 0);
+int add0726 = (x0726 + 726);
+int mul0727 = (y0727 * 727);
+int sel0728 = (z0728 ? 728 : 0);
+int add0729 = (x0729 + 729);
+int mul0730 = (y0730 * 730);
+int sel0731 = (z0731 ? 731 : 0);
+int add0732 = (x0732 + 732);
+int mul0733 = (y0733 * 733);
+int sel0734 = (z0734 ? 734 : 0);
+int add0735 = (x0735 + 735);
+int mul0736 = (y0736 * 736);
+int sel0737 = (z0737 ? 737 : 0);
+int add0738 = (x0738 + 738);
+int mul0739 = (y0739 * 739);
+int sel0740 = (z0740 ? 740 : 0);
+int add0741 = (x0741 + 741);
+int mul0742 = (y0742 * 742);
+int sel0743 = (z0743 ? 743 : 0);
+int add0744 = (x0744 + 744);
+int mul0745 = (y0745 * 745);
+int sel0746 = (z0746 ? 746 : 0);
+int add0747 = (x0747 + 747);
+int mul0748 = (y0748 * 748);
+int sel0749 = (z0749 ? 749 : 0);
+int add0750 = (x0750 + 750);
+int mul0751 = (y0751 * 751);
+int sel0752 = (z0752 ? 752 : 0);
+int add0753 = (x0753 + 753);
+int mul0754 = (y0754 * 754);
+int sel0755 = (z0755 ? 755 : 0);
+int add0756 = (x0756 + 756);
+int mul0757 = (y0757 * 757);
+int sel0758 = (z0758 ? 758 : 0);
+int add0759 = (x0759 + 759);
+int mul0760 = (y0760 * 760);
+int sel0761 = (z0761 ? 761 : 0);
+int add0762 = (x0762 + 762);
+int mul0763 = (y0763 * 763);
+int sel0764 = (z0764 ? 764 : 0);
+int add0765 = (x0765 + 765);
+int mul0766 = (y0766 * 766);
+int sel0767 = (z0767 ? 767 : 0);
+int add0768 = (x0768 + 768);
+int mul0769 = (y0769 * 769);
+int sel0770 = (z0770 ? 770 : 0);
+int add0771 = (x0771 + 771);
+int mul0772 = (y0772 * 772);
+int sel0773 = (z0773 ? 773 : 0);
+int add0774 = (x0774 + 774);
+int mul0775 = (y0775 * 775);
+int sel0776 = (z0776 ? 776 : 0);
+int add0777 = (x0777 + 777);
+int mul0778 = (y0778 * 778);
+int sel0779 = (z0779 ? 779 : 0);
+int add0780 = (x0780 + 780);
+int mul0781 = (y0781 * 781);
+int sel0782 = (z0782 ? 782 : 0);
+int add0783 = (x0783 + 783);
+int mul0784 = (y0784 * 784);
+int sel0785 = (z0785 ? 785 : 0);
+int add0786 = (x0786 + 786);
+int mul0787 = (y0787 * 787);
+int sel0788 = (z0788 ? 788 : 0);
+int add0789 = (x0789 + 789);
+int mul0790 = (y0790 * 790);
+int sel0791 = (z0791 ? 791 : 0);
+int add0792 = (x0792 + 792);
+int mul0793 = (y0793 * 793);
+int sel0794 = (z0794 ? 794 : 0);
+int add0795 = (x0795 + 795);
+int mul0796 = (y0796 * 796);
+int sel0797 = (z0797 ? 797 : 0);
+int add0798 = (x0798 + 798);
+int mul0799 = (y0799 * 799);
+int sel0800 = (z0800 ? 800 : 0);
+int add0801 = (x0801 + 801);
+int mul0802 = (y0802 * 802);
+int sel0803 = (z0803 ? 803 : 0);
+int add0804 = (x0804 + 804);
+int mul0805 = (y0805 * 805);
+int sel0806 = (z0806 ? 806 : 0);
+int add0807 = (x0807 + 807);
+int mul0808 = (y0808 * 808);
+int sel0809 = (z0809 ? 809 : 0);
+int add0810 = (x0810 + 810);
+int mul0811 = (y0811 * 811);
+int sel0812 = (z0812 ? 812 : 0);
+int add0813 = (x0813 + 813);
+int mul0814 = (y0814 * 814);
+int sel0815 = (z0815 ? 815 : 0);
+int add0816 = (x0816 + 816);
+int mul0817 = (y0817 * 817);
+int sel0818 = (z0818 ? 818 : 0);
+int add0819 = (x0819 + 819);
+int mul0820 = (y0820 * 820);
+int sel0821 = (z0821 ? 821 : 0);
+int add0822 = (x0822 + 822);
+int mul0823 = (y0823 * 823);
+int sel0824 = (z0824 ? 824 : 0);
+int add0825 = (x0825 + 825);
+int mul0826 = (y0826 * 826);
+int sel0827 = (z0827 ? 827 : 0);
+int add0828 = (x0828 + 828);
+int mul0829 = (y0829 * 829);
+int sel0830 = (z0830 ? 830 : 0);
+int add0831 = (x0831 + 831);
+int mul0832 = (y0832 * 832);
+int sel0833 = (z0833 ? 833 : 0);
+int add0834 = (x0834 + 834);
+int mul0835 = (y0835 * 835);
+int sel0836 = (z0836 ? 836 : 0);
+int add0837 = (x0837 + 837);
+int mul0838 = (y0838 * 838);
+int sel0839 = (z0839 ? 839 : 0);
+int add0840 = (x0840 + 840);
+int mul0841 = (y0841 * 841);
+int sel0842 = (z0842 ? 842 : 0);
+int add0843 = (x0843 + 843);
+int mul0844 = (y0844 * 844);
+int sel0845 = (z0845 ? 845 : 0);
+int add0846 = (x0846 + 846);
+int mul0847 = (y0847 * 847);
+int sel0848 = (z0848 ? 848 : 0);
+int add0849 = (x0849 + 849);
+int mul0850 = (y0850 * 850);
+int sel0851 = (z0851 ? 851 : 0);
+int add0852 = (x0852 + 852);
+int mul0853 = (y0853 * 853);
+int sel0854 = (z0854 ? 854 : 0);
+int add0855 = (x0855 + 855);
+int mul0856 = (y0856 * 856);
+int sel0857 = (z0857 ? 857 : 0);
+int add0858 = (x0858 + 858);
+int mul0859 = (y0859 * 859);
+int sel0860 = (z0860 ? 860 : 0);
+int add0861 = (x0861 + 861);
+int mul0862 = (y0862 * 862);
+int sel0863 = (z0863 ? 863 : 0);
+int add0864 = (x0864 + 864);
+int mul0865 = (y0865 * 865);
+int sel0866 = (z0866 ? 866 : 0);
+int add0867 = (x0867 + 867);
+int mul0868 = (y0868 * 868);
+int sel0869 = (z0869 ? 869 : 0);
+int add0870 = (x0870 + 870);
+int mul0871 = (y0871 * 871);
+int sel0872 = (z0872 ? 872 : 0);
+int add0873 = (x0873 + 873);
+int mul0874 = (y0874 * 874);
+int sel0875 = (z0875 ? 875 : 0);
+int add0876 = (x0876 + 876);
+int mul0877 = (y0877 * 877);
+int sel0878 = (z0878 ? 878 : 0);
+int add0879 = (x0879 + 879);
+int mul0880 = (y0880 * 880);
+int sel0881 = (z0881 ? 881 : 0);
+int add0882 = (x0882 + 882);
+int mul0883 = (y0883 * 883);
+int sel0884 = (z0884 ? 884 : 0);
+int add0885 = (x0885 + 885);
+int mul0886 = (y0886 * 886);
+int sel0887 = (z0887 ? 887 : 0);
+int add0888 = (x0888 + 888);
+int mul0889 = (y0889 * 889);
+int sel0890 = (z0890 ? 890 : 0);
+int add0891 = (x0891 + 891);
+int mul0892 = (y0892 * 892);
+int sel0893 = (z0893 ? 893 : 0);
+int add0894 = (x0894 + 894);
+int mul0895 = (y0895 * 895);
+int sel0896 = (z0896 ? 896 : 0);
+int add0897 = (x0897 + 897);
+int mul0898 = (y0898 * 898);
+int sel0899 = (z0899 ? 899 : 0);
+int add0900 = (x0900 + 900);
+int mul0901 = (y0901 * 901);
+int sel0902 = (z0902 ? 902 : 0);
+int add0903 = (x0903 + 903);
+int mul0904 = (y0904 * 904);
+int sel0905 = (z0905 ? 905 : 0);
+int add0906 = (x0906 + 906);
+int mul0907 = (y0907 * 907);
+int sel0908 = (z0908 ? 908 : 0);
+int add0909 = (x0909 + 909);
+int mul0910 = (y0910 * 910);
+int sel0911 = (z0911 ? 911 : 0);
+int add0912 = (x0912 + 912);
+int mul0913 = (y0913 * 913);
+int sel0914 = (z0914 ? 914 : 0);
+int add0915 = (x0915 + 915);
+int mul0916 = (y0916 * 916);
+int sel0917 = (z0917 ? 917 : 0);
+int add0918 = (x0918 + 918);
+int mul0919 = (y0919 * 919);
+int sel0920 = (z0920 ? 920 : 0);
+int add0921 = (x0921 + 921);
+int mul0922 = (y0922 * 922);
+int sel0923 = (z0923 ? 923 : 0);
+int add0924 = (x0924 + 924);
+int mul0925 = (y0925 * 925);
+int sel0926 = (z0926 ? 926 : 0);
+int add0927 = (x0927 + 927);
+int mul0928 = (y0928 * 928);
+int sel0929 = (z0929 ? 929 : 0);
+int add0930 = (x0930 + 930);
+int mul0931 = (y0931 * 931);
+int sel0932 = (z0932 ? 932 : 0);
+int add0933 = (x0933 + 933);
+int mul0934 = (y0934 * 934);
+int sel0935 = (z0935 ? 935 : 0);
+int add0936 = (x0936 + 936);
+int mul0937 = (y0937 * 937);
+int sel0938 = (z0938 ? 938 : 0);
+int add0939 = (x0939 + 939);
+int mul0940 = (y0940 * 940);
+int sel0941 = (z0941 ? 941 : 0);
+int add0942 = (x0942 + 942);
+int mul0943 = (y0943 * 943);
+int sel0944 = (z0944 ? 944 : 0);
+int add0945 = (x0945 + 945);
+int mul0946 = (y0946 * 946);
+int sel0947 = (z0947 ? 947 : 0);
+int add0948 = (x0948 + 948);
+int mul0949 = (y0949 * 949);
+int sel0950 = (z0950 ? 950 : 0);
+int add0951 = (x0951 + 951);
+int mul0952 = (y0952 * 952);
+int sel0953 = (z0953 ? 953 : 0);
+int add0954 = (x0954 + 954);
+int mul0955 = (y0955 * 955);
+int sel0956 = (z0956 ? 956 : 0);
+int add0957 = (x0957 + 957);
+int mul0958 = (y0958 * 958);
+int sel0959 = (z0959 ? 959 : 0);
+int add0960 = (x0960 + 960);
+int mul0961 = (y0961 * 961);
+int sel0962 = (z0962 ? 962 : 0);
+int add0963 = (x0963 + 963);
+int mul0964 = (y0964 * 964);
+int sel0965 = (z0965 ? 965 : 0);
+int add0966 = (x0966 + 966);
+int mul0967 = (y0967 * 967);
+int sel0968 = (z0968 ? 968 : 0);
+int add0969 = (x0969 + 969);
+int mul0970 = (y0970 * 970);
+int sel0971 = (z0971 ? 971 : 0);
+int add0972 = (x0972 + 972);
+int mul0973 = (y0973 * 973);
+int sel0974 = (z0974 ? 974 : 0);
+int add0975 = (x0975 + 975);
+int mul0976 = (y0976 * 976);
+int sel0977 = (z0977 ? 977 : 0);
+int add0978 = (x0978 + 978);
+int mul0979 = (y0979 * 979);
+int sel0980 = (z0980 ? 980 : 0);
+int add0981 = (x0981 + 981);
+int mul0982 = (y0982 * 982);
+int sel0983 = (z0983 ? 983 : 0);
+int add0984 = (x0984 + 984);
+int mul0985 = (y0985 * 985);
+int sel0986 = (z0986 ? 986 : 0);
+int add0987 = (x0987 + 987);
+int mul0988 = (y0988 * 988);
+int sel0989 = (z0989 ? 989 : 0);
+int add0990 = (x0990 + 990);
+int mul0991 = (y0991 * 991);
+int sel0992 = (z0992 ? 992 : 0);
+int add0993 = (x0993 + 993);
+int mul0994 = (y0994 * 994);
+int sel0995 = (z0995 ? 995 : 0);
+int add0996 = (x0996 + 996);
+int mul0997 = (y0997 * 997);
+int sel0998 = (z0998 ? 998 : 0);
+int add0999 = (x0999 + 999);
+int mul1000 = (y1000 * 1000);
+int sel1001 = (z1001 ? 1001 : 0);
+int add1002 = (x1002 + 1002);
+int mul1003 = (y1003 * 1003);
+int sel1004 = (z1004 ? 1004 : 0);
+int add1005 = (x1005 + 1005);
+int mul1006 = (y1006 * 1006);
+int sel1007 = (z1007 ? 1007 : 0);
+int add1008 = (x1008 + 1008);
+int mul1009 = (y1009 * 1009);
+int sel1010 = (z1010 ? 1010 : 0);
+int add1011 = (x1011 + 1011);
+int mul1012 = (y1012 * 1012);
+int sel1013 = (z1013 ? 1013 : 0);
+int add1014 = (x1014 + 1014);
+int mul1015 = (y1015 * 1015);
+int sel1016 = (z1016 ? 1016 : 0);
+int add1017 = (x1017 + 1017);
+int mul1018 = (y1018 * 1018);
+int sel1019 = (z1019 ? 1019 : 0);
+int add1020 = (x1020 + 1020);
+int mul1021 = (y1021 * 1021);
+int sel1022 = (z1022 ? 1022 : 0);
+int add1023 = (x1023 + 1023);
+int mul1024 = (y1024 * 1024);
+int sel1025 = (z1025 ? 1025 : 0);
+int add1026 = (x1026 + 1026);
+int mul1027 = (y1027 * 1027);
+int sel1028 = (z1028 ? 1028 : 0);
+int add1029 = (x1029 + 1029);
+int mul1030 = (y1030 * 1030);
+int sel1031 = (z1031 ? 1031 : 0);
+int add1032 = (x1032 + 1032);
+int mul1033 = (y1033 * 1033);
+int sel1034 = (z1034 ? 1034 : 0);
+int add1035 = (x1035 + 1035);
+int mul1036 = (y1036 * 1036);
+int sel1037 = (z1037 ? 1037 : 0);
+int add1038 = (x1038 + 1038);
+int mul1039 = (y1039 * 1039);
+int sel1040 = (z1040 ? 1040 : 0);
+int add1041 = (x1041 + 1041);
+int mul1042 = (y1042 * 1042);
+int sel1043 = (z1043 ? 1043 : 0);
+int add1044 = (x1044 + 1044);
+int mul1045 = (y1045 * 1045);
+int sel1046 = (z1046 ? 1046 : 0);
+int add1047 = (x1047 + 1047);
+int mul1048 = (y1048 * 1048);
+int sel1049 = (z1049 ? 1049 : 0);
+int add1050 = (x1050 + 1050);
+int mul1051 = (y1051 * 1051);
+int sel1052 = (z1052 ? 1052 : 0);
+int add1053 = (x1053 + 1053);
+int mul1054 = (y1054 * 1054);
+int sel1055 = (z1055 ? 1055 : 0);
+int add1056 = (x1056 + 1056);
+int mul1057 = (y1057 * 1057);
+int sel1058 = (z1058 ? 1058 : 0);
+int add1059 = (x1059 + 1059);
+int mul1060 = (y1060 * 1060);
+int sel1061 = (z1061 ? 1061 : 0);
+int add1062 = (x1062 + 1062);
+int mul1063 = (y1063 * 1063);
+int sel1064 = (z1064 ? 1064 : 0);
+int add1065 = (x1065 + 1065);
+int mul1066 = (y1066 * 1066);
+int sel1067 = (z1067 ? 1067 : 0);
+int add1068 = (x1068 + 1068);
+int mul1069 = (y1069 * 1069);
+int sel1070 = (z1070 ? 1070 : 0);
+int add1071 = (x1071 + 1071);
+int mul1072 = (y1072 * 1072);
+int sel1073 = (z1073 ? 1073 : 0);
+int add1074 = (x1074 + 1074);
+int mul1075 = (y1075 * 1075);
+int sel1076 = (z1076 ? 1076 : 0);
+int add1077 = (x1077 + 1077);
+int mul1078 = (y1078 * 1078);
+int sel1079 = (z1079 ? 1079 : 0);
+int add1080 = (x1080 + 1080);
+int mul1081 = (y1081 * 1081);
+int sel1082 = (z1082 ? 1082 : 0);
+int add1083 = (x1083 + 1083);
+int mul1084 = (y1084 * 1084);
+int sel1085 = (z1085 ? 1085 : 0);
+int add1086 = (x1086 + 1086);
+int mul1087 = (y1087 * 1087);
+int sel1088 = (z1088 ? 1088 : 0);
+int add1089 = (x1089 + 1089);
+int mul1090 = (y1090 * 1090);
+int sel1091 = (z1091 ? 1091 : 0);
+int add1092 = (x1092 + 1092);
+int mul1093 = (y1093 * 1093);
+int sel1094 = (z1094 ? 1094 : 0);
+int add1095 = (x1095 + 1095);
+int mul1096 = (y1096 * 1096);
+int sel1097 = (z1097 ? 1097 : 0);
+int add1098 = (x1098 + 1098);
+int mul1099 = (y1099 * 1099);
+int sel1100 = (z1100 ? 1100 : 0);
+int add1101 = (x1101 + 1101);
+int mul1102 = (y1102 * 1102);
+int sel1103 = (z1103 ? 1103 : 0);
+int add1104 = (x1104 + 1104);
+int mul1105 = (y1105 * 1105);
+int sel1106 = (z1106 ? 1106 : 0);
+int add1107 = (x1107 + 1107);
+int mul1108 = (y1108 * 1108);
+int sel1109 = (z1109 ? 1109 : 0);
+int add1110 = (x1110 + 1110);
+int mul1111 = (y1111 * 1111);
+int sel1112 = (z1112 ? 1112 : 0);
+int add1113 = (x1113 + 1113);
+int mul1114 = (y1114 * 1114);
+int sel1115 = (z1115 ? 1115 : 0);
+int add1116 = (x1116 + 1116);
+int mul1117 = (y1117 * 1117);
+int sel1118 = (z1118 ? 1118 : 0);
+int add1119 = (x1119 + 1119);
+int mul1120 = (y1120 * 1120);
+int sel1121 = (z1121 ? 1121 : 0);
+int add1122 = (x1122 + 1122);
+int mul1123 = (y1123 * 1123);
+int sel1124 = (z1124 ? 1124 : 0);
+int add1125 = (x1125 + 1125);
+int mul1126 = (y1126 * 1126);
+int sel1127 = (z1127 ? 1127 : 0);
+int add1128 = (x1128 + 1128);
+int mul1129 = (y1129 * 1129);
+int sel1130 = (z1130 ? 1130 : 0);
+int add1131 = (x1131 + 1131);
+int mul1132 = (y1132 * 1132);
+int sel1133 = (z1133 ? 1133 : 0);
+int add1134 = (x1134 + 1134);
+int mul1135 = (y1135 * 1135);
+int sel1136 = (z1136 ? 1136 : 0);
+int add1137 = (x1137 + 1137);
+int mul1138 = (y1138 * 1138);
+int sel1139 = (z1139 ? 1139 : 0);
+int add1140 = (x1140 + 1140);
+int mul1141 = (y1141 * 1141);
+int sel1142 = (z1142 ? 1142 : 0);
+int add1143 = (x1143 + 1143);
+int mul1144 = (y1144 * 1144);
+int sel1145 = (z1145 ? 1145 : 0);
+int add1146 = (x1146 + 1146);
+int mul1147 = (y1147 * 1147);
+int sel1148 = (z1148 ? 1148 : 0);
+int add1149 = (x1149 + 1149);
+int mul1150 = (y1150 * 1150);
+int sel1151 = (z1151 ? 1151 : 0);
+int add1152 = (x1152 + 1152);
+int mul1153 = (y1153 * 1153);
+int sel1154 = (z1154 ? 1154 : 0);
+int add1155 = (x1155 + 1155);
+int mul1156 = (y1156 * 1156);
+int sel1157 = (z1157 ? 1157 : 0);
+int add1158 = (x1158 + 1158);
+int mul1159 = (y1159 * 1159);
+int sel1160 = (z1160 ? 1160 : 0);
+int add1161 = (x1161 + 1161);
+int mul1162 = (y1162 * 1162);
+int sel1163 = (z1163 ? 1163 : 0);
+int add1164 = (x1164 + 1164);
+int mul1165 = (y1165 * 1165);
+int sel1166 = (z1166 ? 1166 : 0);
+int add1167 = (x1167 + 1167);
+int mul1168 = (y1168 * 1168);
+int sel1169 = (z1169 ? 1169 : 0);
+int add1170 = (x1170 + 1170);
+int mul1171 = (y1171 * 1171);
+int sel1172 = (z1172 ? 1172 : 0);
+int add1173 = (x1173 + 1173);
+int mul1174 = (y1174 * 1174);
+int sel1175 = (z1175 ? 1175 : 0);
+int add1176 = (x1176 + 1176);
+int mul1177 = (y1177 * 1177);
+int sel1178 = (z1178 ? 1178 : 0);
+int add1179 = (x1179 + 1179);
+int mul1180 = (y1180 * 1180);
+int sel1181 = (z1181 ? 1181 : 0);
+int add1182 = (x1182 + 1182);
+int mul1183 = (y1183 * 1183);
+int sel1184 = (z1184 ? 1184 : 0);
+int add1185 = (x1185 + 1185);
+int mul1186 = (y1186 * 1186);
+int sel1187 = (z1187 ? 1187 : 0);
+int add1188 = (x1188 + 1188);
+int mul1189 = (y1189 * 1189);
+int sel1190 = (z1190 ? 1190 : 0);
+int add1191 = (x1191 + 1191);
+int mul1192 = (y1192 * 1192);
+int sel1193 = (z1193 ? 1193 : 0);
+int add1194 = (x1194 + 1194);
+int mul1195 = (y1195 * 1195);
+int sel1196 = (z1196 ? 1196 : 0);
+int add1197 = (x1197 + 1197);
+int mul1198 = (y1198 * 1198);
+int sel1199 = (z1199 ? 1199 : 0);
+int add1200 = (x1200 + 1200);
+int mul1201 = (y1201 * 1201);
+int sel1202 = (z1202 ? 1202 : 0);
+int add1203 = (x1203 + 1203);
+int mul1204 = (y1204 * 1204);
+int sel1205 = (z1205 ? 1205 : 0);
+int add1206 = (x1206 + 1206);
+int mul1207 = (y1207 * 1207);
+int sel1208 = (z1208 ? 1208 : 0);
+int add1209 = (x1209 + 1209);
+int mul1210 = (y1210 * 1210);
+int sel1211 = (z1211 ? 1211 : 0);
+int add1212 = (x1212 + 1212);
+int mul1213 = (y1213 * 1213);
+int sel1214 = (z1214 ? 1214 : 0);
+int add1215 = (x1215 + 1215);
+int mul1216 = (y1216 * 1216);
+int sel1217 = (z1217 ? 1217 : 0);
+int add1218 = (x1218 + 1218);
+int mul1219 = (y1219 * 1219);
+int sel1220 = (z1220 ? 1220 : 0);
+int add1221 = (x1221 + 1221);
+int mul1222 = (y1222 * 1222);
+int sel1223 = (z1223 ? 1223 : 0);
+int add1224 = (x1224 + 1224);
+int mul1225 = (y1225 * 1225);
+int sel1226 = (z1226 ? 1226 : 0);
+int add1227 = (x1227 + 1227);
+int mul1228 = (y1228 * 1228);
+int sel1229 = (z1229 ? 1229 : 0);
+int add1230 = (x1230 + 1230);
+int mul1231 = (y1231 * 1231);
+int sel1232 = (z1232 ? 1232 : 0);
+int add1233 = (x1233 + 1233);
+int mul1234 = (y1234 * 1234);
+int sel1235 = (z1235 ? 1235 : 0);
+int add1236 = (x1236 + 1236);
+int mul1237 = (y1237 * 1237);
+int sel1238 = (z1238 ? 1238 : 0);
+int add1239 = (x1239 + 1239);
+int mul1240 = (y1240 * 1240);
+int sel1241 = (z1241 ? 1241 : 0);
+int add1242 = (x1242 + 1242);
+int mul1243 = (y1243 * 1243);
+int sel1244 = (z1244 ? 1244 : 0);
+int add1245 = (x1245 + 1245);
+int mul1246 = (y1246 * 1246);
+int sel1247 = (z1247 ? 1247 : 0);
+int add1248 = (x1248 + 1248);
+int mul1249 = (y1249 * 1249);
+int sel1250 = (z1250 ? 1250 : 0);
+int add1251 = (x1251 + 1251);
+int mul1252 = (y1252 * 1252);
+int sel1253 = (z1253 ? 1253 : 0);
+int add1254 = (x1254 + 1254);
+int mul1255 = (y1255 * 1255);
+int sel1256 = (z1256 ? 1256 : 0);
+int add1257 = (x1257 + 1257);
+int mul1258 = (y1258 * 1258);
+int sel1259 = (z1259 ? 1259 : 0);
+int add1260 = (x1260 + 1260);
+int mul1261 = (y1261 * 1261);
+int sel1262 = (z1262 ? 1262 : 0);
+int add1263 = (x1263 + 1263);
+int mul1264 = (y1264 * 1264);
+int sel1265 = (z1265 ? 1265 : 0);
+int add1266 = (x1266 + 1266);
+int mul1267 = (y1267 * 1267);
+int sel1268 = (z1268 ? 1268 : 0);
+int add1269 = (x1269 + 1269);
+int mul1270 = (y1270 * 1270);
+int sel1271 = (z1271 ? 1271 : 0);
+int add1272 = (x1272 + 1272);
+int mul1273 = (y1273 * 1273);
+int sel1274 = (z1274 ? 1274 : 0);
+int add1275 = (x1275 + 1275);
+int mul1276 = (y1276 * 1276);
+int sel1277 = (z1277 ? 1277 : 0);
+int add1278 = (x1278 + 1278);
+int mul1279 = (y1279 * 1279);
+int sel1280 = (z1280 ? 1280 : 0);
+int add1281 = (x1281 + 1281);
+int mul1282 = (y1282 * 1282);
+int sel1283 = (z1283 ? 1283 : 0);
+int add1284 = (x1284 + 1284);
+int mul1285 = (y1285 * 1285);
+int sel1286 = (z1286 ? 1286 : 0);
+int add1287 = (x1287 + 1287);
+int mul1288 = (y1288 * 1288);
+int sel1289 = (z1289 ? 1289 : 0);
+int add1290 = (x1290 + 1290);
+int mul1291 = (y1291 * 1291);
+int sel1292 = (z1292 ? 1292 : 0);
+int add1293 = (x1293 + 1293);
+int mul1294 = (y1294 * 1294);
+int sel1295 = (z1295 ? 1295 : 0);
+int add1296 = (x1296 + 1296);
+int mul1297 = (y1297 * 1297);
+int sel1298 = (z1298 ? 1298 : 0);
+int add1299 = (x1299 + 1299);
+int mul1300 = (y1300 * 1300);
+int sel1301 = (z1301 ? 1301 : 0);
+int add1302 = (x1302 + 1302);
+int mul1303 = (y1303 * 1303);
+int sel1304 = (z1304 ? 1304 : 0);
+int add1305 = (x1305 + 1305);
+int mul1306 = (y1306 * 1306);
+int sel1307 = (z1307 ? 1307 : 0);
+int add1308 = (x1308 + 1308);
+int mul1309 = (y1309 * 1309);
+int sel1310 = (z1310 ? 1310 : 0);
+int add1311 = (x1311 + 1311);
+int mul1312 = (y1312 * 1312);
+int sel1313 = (z1313 ? 1313 : 0);
+int add1314 = (x1314 + 1314);
+int mul1315 = (y1315 * 1315);
+int sel1316 = (z1316 ? 1316 : 0);
+int add1317 = (x1317 + 1317);
+int mul1318 = (y1318 * 1318);
+int sel1319 = (z1319 ? 1319 : 0);
+int add1320 = (x1320 + 1320);
+int mul1321 = (y1321 * 1321);
+int sel1322 = (z1322 ? 1322 : 0);
+int add1323 = (x1323 + 1323);
+int mul1324 = (y1324 * 1324);
+int sel1325 = (z1325 ? 1325 : 0);
+int add1326 = (x1326 + 1326);
+int mul1327 = (y1327 * 1327);
+int sel1328 = (z1328 ? 1328 : 0);
+int add1329 = (x1329 + 1329);
+int mul1330 = (y1330 * 1330);
+int sel1331 = (z1331 ? 1331 : 0);
+int add1332 = (x1332 + 1332);
+int mul1333 = (y1333 * 1333);
+int sel1334 = (z1334 ? 1334 : 0);
+int add1335 = (x1335 + 1335);
+int mul1336 = (y1336 * 1336);
+int sel1337 = (z1337 ? 1337 : 0);
+int add1338 = (x1338 + 1338);
+int mul1339 = (y1339 * 1339);
+int sel1340 = (z1340 ? 1340 : 0);
+int add1341 = (x1341 + 1341);
+int mul1342 = (y1342 * 1342);
+int sel1343 = (z1343 ? 1343 : 0);
+int add1344 = (x1344 + 1344);
+int mul1345 = (y1345 * 1345);
+int sel1346 = (z1346 ? 1346 : 0);
+int add1347 = (x1347 + 1347);
+int mul1348 = (y1348 * 1348);
+int sel1349 = (z1349 ? 1349 : 0);
+int add1350 = (x1350 + 1350);
+int mul1351 = (y1351 * 1351);
+int sel1352 = (z1352 ? 1352 : 0);
+int add1353 = (x1353 + 1353);
+int mul1354 = (y1354 * 1354);
+int sel1355 = (z1355 ? 1355 : 0);
+int add1356 = (x1356 + 1356);
+int mul1357 = (y1357 * 1357);
+int sel1358 = (z1358 ? 1358 : 0);
+int add1359 = (x1359 + 1359);
+int mul1360 = (y1360 * 1360);
+int sel1361 = (z1361 ? 1361 : 0);
+int add1362 = (x1362 + 1362);
+int mul1363 = (y1363 * 1363);
+int sel1364 = (z1364 ? 1364 : 0);
+int add1365 = (x1365 + 1365);
+int mul1366 = (y1366 * 1366);
+int sel1367 = (z1367 ? 1367 : 0);
+int add1368 = (x1368 + 1368);
+int mul1369 = (y1369 * 1369);
+int sel1370 = (z1370 ? 1370 : 0);
+int add1371 = (x1371 + 1371);
+int mul1372 = (y1372 * 1372);
+int sel1373 = (z1373 ? 1373 : 0);
+int add1374 = (x1374 + 1374);
+int mul1375 = (y1375 * 1375);
+int sel1376 = (z1376 ? 1376 : 0);
+int add1377 = (x1377 + 1377);
+int mul1378 = (y1378 * 1378);
+int sel1379 = (z1379 ? 1379 : 0);
+int add1380 = (x1380 + 1380);
+int mul1381 = (y1381 * 1381);
+int sel1382 = (z1382 ? 1382 : 0);
+int add1383 = (x1383 + 1383);
+int mul1384 = (y1384 * 1384);
+int sel1385 = (z1385 ? 1385 : 0);
+int add1386 = (x1386 + 1386);
+int mul1387 = (y1387 * 1387);
+int sel1388 = (z1388 ? 1388 : 0);
+int add1389 = (x1389 + 1389);
+int mul1390 = (y1390 * 1390);
+int sel1391 = (z1391 ? 1391 : 0);
+int add1392 = (x1392 + 1392);
+int mul1393 = (y1393 * 1393);
+int sel1394 = (z1394 ? 1394 : 0);
+int add1395 = (x1395 + 1395);
+int mul1396 = (y1396 * 1396);
+int sel1397 = (z1397 ? 1397 : 0);
+int add1398 = (x1398 + 1398);
+int mul1399 = (y1399 * 1399);
+int sel1400 = (z1400 ? 1400 : 0);
+int add1401 = (x1401 + 1401);
+int mul1402 = (y1402 * 1402);
+int sel1403 = (z1403 ? 1403 : 0);
+int add1404 = (x1404 + 1404);
+int mul1405 = (y1405 * 1405);
+int sel1406 = (z1406 ? 1406 : 0);
+int add1407 = (x1407 + 1407);
+int mul1408 = (y1408 * 1408);
+int sel1409 = (z1409 ? 1409 : 0);
+int add1410 = (x1410 + 1410);
+int mul1411 = (y1411 * 1411);
+int sel1412 = (z1412 ? 1412 : 0);
+int add1413 = (x1413 + 1413);
+int mul1414 = (y1414 * 1414);
+int sel1415 = (z1415 ? 1415 : 0);
+int add1416 = (x1416 + 1416);
+int mul1417 = (y1417 * 1417);
+int sel1418 = (z1418 ? 1418 : 0);
+int add1419 = (x1419 + 1419);
+int mul1420 = (y1420 * 1420);
+int sel1421 = (z1421 ? 1421 : 0);
+int add1422 = (x1422 + 1422);
+int mul1423 = (y1423 * 1423);
+int sel1424 = (z1424 ? 1424 : 0);
+int add1425 = (x1425 + 1425);
+int mul1426 = (y1426 * 1426);
+int sel1427 = (z1427 ? 1427 : 0);
+int add1428 = (x1428 + 1428);
+int mul1429 = (y1429 * 1429);
+int sel1430 = (z1430 ? 1430 : 0);
+int add1431 = (x1431 + 1431);
+int mul1432 = (y1432 * 1432);
+int sel1433 = (z1433 ? 1433 : 0);
+int add1434 = (x1434 + 1434);
+int mul1435 = (y1435 * 1435);
+int sel1436 = (z1436 ? 1436 : 0);
+int add1437 = (x1437 + 1437);
+int mul1438 = (y1438 * 1438);
+int sel1439 = (z1439 ? 1439 : 0);
+int add1440 = (x1440 + 1440);
+int mul1441 = (y1441 * 1441);
+int sel1442 = (z1442 ? 1442 : 0);
+int add1443 = (x1443 + 1443);
+int mul1444 = (y1444 * 1444);
+int sel1445 = (z1445 ? 1445 : 0);
+int add1446 = (x1446 + 1446);
+int mul1447 = (y1447 * 1447);
+int sel1448 = (z1448 ? 1448 : 0);
+int add1449 = (x1449 + 1449);
+int mul1450 = (y1450 * 1450);
+int sel1451 = (z1451 ? 1451 : 0);
+int add1452 = (x1452 + 1452);
+int mul1453 = (y1453 * 1453);
+int sel1454 = (z1454 ? 1454 : 0);
+int add1455 = (x1455 + 1455);
+int mul1456 = (y1456 * 1456);
+int sel1457 = (z1457 ? 1457 : 0);
+int add1458 = (x1458 + 1458);
+int mul1459 = (y1459 * 1459);
+int sel1460 = (z1460 ? 1460 : 0);
+int add1461 = (x1461 + 1461);
+int mul1462 = (y1462 * 1462);
+int sel1463 = (z1463 ? 1463 : 0);
+int add1464 = (x1464 + 1464);
+int mul1465 = (y1465 * 1465);
+int sel1466 = (z1466 ? 1466 : 0);
+int add1467 = (x1467 + 1467);
+int mul1468 = (y1468 * 1468);
+int sel1469 = (z1469 ? 1469 : 0);
+int add1470 = (x1470 + 1470);
+int mul1471 = (y1471 * 1471);
+int sel1472 = (z1472 ? 1472 : 0);
+int add1473 = (x1473 + 1473);
+int mul1474 = (y1474 * 1474);
+int sel1475 = (z1475 ? 1475 : 0);
+int add1476 = (x1476 + 1476);
+int mul1477 = (y1477 * 1477);
+int sel1478 = (z1478 ? 1478 : 0);
+int add1479 = (x1479 + 1479);
+int mul1480 = (y1480 * 1480);
+int sel1481 = (z1481 ? 1481 : 0);
+int add1482 = (x1482 + 1482);
+int mul1483 = (y1483 * 1483);
+int sel1484 = (z1484 ? 1484 : 0);
+int add1485 = (x1485 + 1485);
+int mul1486 = (y1486 * 1486);
+int sel1487 = (z1487 ? 1487 : 0);
+int add1488 = (x1488 + 1488);
+int mul1489 = (y1489 * 1489);
+int sel1490 = (z1490 ? 1490 : 0);
+int add1491 = (x1491 + 1491);
+int mul1492 = (y1492 * 1492);
+int sel1493 = (z1493 ? 1493 : 0);
+int add1494 = (x1494 + 1494);
+int mul1495 = (y1495 * 1495);
+int sel1496 = (z1496 ? 1496 : 0);
+int add1497 = (x1497 + 1497);
+int mul1498 = (y1498 * 1498);
+int sel1499 = (z1499 ? 1499 : 0);
+int add1500 = (x1500 + 1500);
+int mul1501 = (y1501 * 1501);
+int sel1502 = (z1502 ? 1502 : 0);
+int add1503 = (x1503 + 1503);
+int mul1504 = (y1504 * 1504);
+int sel1505 = (z1505 ? 1505 : 0);
+int add1506 = (x1506 + 1506);
+int mul1507 = (y1507 * 1507);
+int sel1508 = (z1508 ? 1508 : 0);
+int add1509 = (x1509 + 1509);
+int mul1510 = (y1510 * 1510);
+int sel1511 = (z1511 ? 1511 : 0);
+int add1512 = (x1512 + 1512);
+int mul1513 = (y1513 * 1513);
+int sel1514 = (z1514 ? 1514 : 0);
+int add1515 = (x1515 + 1515);
+int mul1516 = (y1516 * 1516);
+int sel1517 = (z1517 ? 1517 : 0);
+int add1518 = (x1518 + 1518);
+int mul1519 = (y1519 * 1519);
+int sel1520 = (z1520 ? 1520 : 0);
+int add1521 = (x1521 + 1521);
+int mul1522 = (y1522 * 1522);
+int sel1523 = (z1523 ? 1523 : 0);
+int add1524 = (x1524 + 1524);
+int mul1525 = (y1525 * 1525);
+int sel1526 = (z1526 ? 1526 : 0);
+int add1527 = (x1527 + 1527);
+int mul1528 = (y1528 * 1528);
+int sel1529 = (z1529 ? 1529 : 0);
+int add1530 = (x1530 + 1530);
+int mul1531 = (y1531 * 1531);
+int sel1532 = (z1532 ? 1532 : 0);
+int add1533 = (x1533 + 1533);
+int mul1534 = (y1534 * 1534);
+int sel1535 = (z1535 ? 1535 : 0);
+int add1536 = (x1536 + 1536);
+int mul1537 = (y1537 * 1537);
+int sel1538 = (z1538 ? 1538 : 0);
+int add1539 = (x1539 + 1539);
+int mul1540 = (y1540 * 1540);
+int sel1541 = (z1541 ? 1541 : 0);
+int add1542 = (x1542 + 1542);
+int mul1543 = (y1543 * 1543);
+int sel1544 = (z1544 ? 1544 : 0);
+int add1545 = (x1545 + 1545);
+int mul1546 = (y1546 * 1546);
+int sel1547 = (z1547 ? 1547 : 0);
+int add1548 = (x1548 + 1548);
+int mul1549 = (y1549 * 1549);
+int sel1550 = (z1550 ? 1550 : 0);
+int add1551 = (x1551 + 1551);
+int mul1552 = (y1552 * 1552);
+int sel1553 = (z1553 ? 1553 : 0);
+int add1554 = (x1554 + 1554);
+int mul1555 = (y1555 * 1555);
+int sel1556 = (z1556 ? 1556 : 0);
+int add1557 = (x1557 + 1557);
+int mul1558 = (y1558 * 1558);
+int sel1559 = (z1559 ? 1559 : 0);
+int add1560 = (x1560 + 1560);
+int mul1561 = (y1561 * 1561);
+int sel1562 = (z1562 ? 1562 : 0);
+int add1563 = (x1563 + 1563);
+int mul1564 = (y1564 * 1564);
+int sel1565 = (z1565 ? 1565 : 0);
+int add1566 = (x1566 + 1566);
+int mul1567 = (y1567 * 1567);
+int sel1568 = (z1568 ? 1568 : 0);
+int add1569 = (x1569 + 1569);
+int mul1570 = (y1570 * 1570);
+int sel1571 = (z1571 ? 1571 : 0);
+int add1572 = (x1572 + 1572);
+int mul1573 = (y1573 * 1573);
+int sel1574 = (z1574 ? 1574 : 0);
+int add1575 = (x1575 + 1575);
+int mul1576 = (y1576 * 1576);
+int sel1577 = (z1577 ? 1577 : 0);
+int add1578 = (x1578 + 1578);
+int mul1579 = (y1579 * 1579);
+int sel1580 = (z1580 ? 1580 : 0);
+int add1581 = (x1581 + 1581);
+int mul1582 = (y1582 * 1582);
+int sel1583 = (z1583 ? 1583 : 0);
+int add1584 = (x1584 + 1584);
+int mul1585 = (y1585 * 1585);
+int sel1586 = (z1586 ? 1586 : 0);
+int add1587 = (x1587 + 1587);
+int mul1588 = (y1588 * 1588);
+int sel1589 = (z1589 ? 1589 : 0);
+int add1590 = (x1590 + 1590);
+int mul1591 = (y1591 * 1591);
+int sel1592 = (z1592 ? 1592 : 0);
+int add1593 = (x1593 + 1593);
+int mul1594 = (y1594 * 1594);
+int sel1595 = (z1595 ? 1595 : 0);
+int add1596 = (x1596 + 1596);
+int mul1597 = (y1597 * 1597);
+int sel1598 = (z1598 ? 1598 : 0);
+int add1599 = (x1599 + 1599);
+int mul1600 = (y1600 * 1600);
+int sel1601 = (z1601 ? 1601 : 0);
+int add1602 = (x1602 + 1602);
+int mul1603 = (y1603 * 1603);
+int sel1604 = (z1604 ? 1604 : 0);
+int add1605 = (x1605 + 1605);
+int mul1606 = (y1606 * 1606);
+int sel1607 = (z1607 ? 1607 : 0);
+int add1608 = (x1608 + 1608);
+int mul1609 = (y1609 * 1609);
+int sel1610 = (z1610 ? 1610 : 0);
+int add1611 = (x1611 + 1611);
+int mul1612 = (y1612 * 1612);
+int sel1613 = (z1613 ? 1613 : 0);
+int add1614 = (x1614 + 1614);
+int mul1615 = (y1615 * 1615);
+int sel1616 = (z1616 ? 1616 : 0);
+int add1617 = (x1617 + 1617);
+int mul1618 = (y1618 * 1618);
+int sel1619 = (z1619 ? 1619 : 0);
+int add1620 = (x1620 + 1620);
+int mul1621 = (y1621 * 1621);
+int sel1622 = (z1622 ? 1622 : 0);
+int add1623 = (x1623 + 1623);
+int mul1624 = (y1624 * 1624);
+int sel1625 = (z1625 ? 1625 : 0);
+int add1626 = (x1626 + 1626);
+int mul1627 = (y1627 * 1627);
+int sel1628 = (z1628 ? 1628 : 0);
+int add1629 = (x1629 + 1629);
+int mul1630 = (y1630 * 1630);
+int sel1631 = (z1631 ? 1631 : 0);
+int add1632 = (x1632 + 1632);
+int mul1633 = (y1633 * 1633);
+int sel1634 = (z1634 ? 1634 : 0);
+int add1635 = (x1635 + 1635);
+int mul1636 = (y1636 * 1636);
+int sel1637 = (z1637 ? 1637 : 0);
+int add1638 = (x1638 + 1638);
+int mul1639 = (y1639 * 1639);
+int sel1640 = (z1640 ? 1640 : 0);
+int add1641 = (x1641 + 1641);
+int mul1642 = (y1642 * 1642);
+int sel1643 = (z1643 ? 1643 : 0);
+int add1644 = (x1644 + 1644);
+int mul1645 = (y1645 * 1645);
+int sel1646 = (z1646 ? 1646 : 0);
+int add1647 = (x1647 + 1647);
+int mul1648 = (y1648 * 1648);
+int sel1649 = (z1649 ? 1649 : 0);
+int add1650 = (x1650 + 1650);
+int mul1651 = (y1651 * 1651);
+int sel1652 = (z1652 ? 1652 : 0);
+int add1653 = (x1653 + 1653);
+int mul1654 = (y1654 * 1654);
+int sel1655 = (z1655 ? 1655 : 0);
+int add1656 = (x1656 + 1656);
+int mul1657 = (y1657 * 1657);
+int sel1658 = (z1658 ? 1658 : 0);
+int add1659 = (x1659 + 1659);
+int mul1660 = (y1660 * 1660);
+int sel1661 = (z1661 ? 1661 : 0);
+int add1662 = (x1662 + 1662);
+int mul1663 = (y1663 * 1663);
+int sel1664 = (z1664 ? 1664 : 0);
+int add1665 = (x1665 + 1665);
+int mul1666 = (y1666 * 1666);
+int sel1667 = (z1667 ? 1667 : 0);
+int add1668 = (x1668 + 1668);
+int mul1669 = (y1669 * 1669);
+int sel1670 = (z1670 ? 1670 : 0);
+int add1671 = (x1671 + 1671);
+int mul1672 = (y1672 * 1672);
+int sel1673 = (z1673 ? 1673 : 0);
+int add1674 = (x1674 + 1674);
+int mul1675 = (y1675 * 1675);
+int sel1676 = (z1676 ? 1676 : 0);
+int add1677 = (x1677 + 1677);
+int mul1678 = (y1678 * 1678);
+int sel1679 = (z1679 ? 1679 : 0);
+int add1680 = (x1680 + 1680);
+int mul1681 = (y1681 * 1681);
+int sel1682 = (z1682 ? 1682 : 0);
+int add1683 = (x1683 + 1683);
+int mul1684 = (y1684 * 1684);
+int sel1685 = (z1685 ? 1685 : 0);
+int add1686 = (x1686 + 1686);
+int mul1687 = (y1687 * 1687);
+int sel1688 = (z1688 ? 1688 : 0);
+int add1689 = (x1689 + 1689);
+int mul1690 = (y1690 * 1690);
+int sel1691 = (z1691 ? 1691 : 0);
+int add1692 = (x1692 + 1692);
+int mul1693 = (y1693 * 1693);
+int sel1694 = (z1694 ? 1694 : 0);
+int add1695 = (x1695 + 1695);
+int mul1696 = (y1696 * 1696);
+int sel1697 = (z1697 ? 1697 : 0);
+int add1698 = (x1698 + 1698);
+int mul1699 = (y1699 * 1699);
+int sel1700 = (z1700 ? 1700 : 0);
+int add1701 = (x1701 + 1701);
+int mul1702 = (y1702 * 1702);
+int sel1703 = (z1703 ? 1703 : 0);
+int add1704 = (x1704 + 1704);
+int mul1705 = (y1705 * 1705);
+int sel1706 = (z1706 ? 1706 : 0);
+int add1707 = (x1707 + 1707);
+int mul1708 = (y1708 * 1708);
+int sel1709 = (z1709 ? 1709 : 0);
+int add1710 = (x1710 + 1710);
+int mul1711 = (y1711 * 1711);
+int sel1712 = (z1712 ? 1712 : 0);
+int add1713 = (x1713 + 1713);
+int mul1714 = (y1714 * 1714);
+int sel1715 = (z1715 ? 1715 : 0);
+int add1716 = (x1716 + 1716);
+int mul1717 = (y1717 * 1717);
+int sel1718 = (z1718 ? 1718 : 0);
+int add1719 = (x1719 + 1719);
+int mul1720 = (y1720 * 1720);
+int sel1721 = (z1721 ? 1721 : 0);
+int add1722 = (x1722 + 1722);
+int mul1723 = (y1723 * 1723);
+int sel1724 = (z1724 ? 1724 : 0);
+int add1725 = (x1725 + 1725);
+int mul1726 = (y1726 * 1726);
+int sel1727 = (z1727 ? 1727 : 0);
+int add1728 = (x1728 + 1728);
+int mul1729 = (y1729 * 1729);
+int sel1730 = (z1730 ? 1730 : 0);
+int add1731 = (x1731 + 1731);
+int mul1732 = (y1732 * 1732);
+int sel1733 = (z1733 ? 1733 : 0);
+int add1734 = (x1734 + 1734);
+int mul1735 = (y1735 * 1735);
+int sel1736 = (z1736 ? 1736 : 0);
+int add1737 = (x1737 + 1737);
+int mul1738 = (y1738 * 1738);
+int sel1739 = (z1739 ? 1739 : 0);
+int add1740 = (x1740 + 1740);
+int mul1741 = (y1741 * 1741);
+int sel1742 = (z1742 ? 1742 : 0);
+int add1743 = (x1743 + 1743);
+int mul1744 = (y1744 * 1744);
+int sel1745 = (z1745 ? 1745 : 0);
+int add1746 = (x1746 + 1746);
+int mul1747 = (y1747 * 1747);
+int sel1748 = (z1748 ? 1748 : 0);
+int add1749 = (x1749 + 1749);
+int mul1750 = (y1750 * 1750);
+int sel1751 = (z1751 ? 1751 : 0);
+int add1752 = (x1752 + 1752);
+int mul1753 = (y1753 * 1753);
+int sel1754 = (z1754 ? 1754 : 0);
+int add1755 = (x1755 + 1755);
+int mul1756 = (y1756 * 1756);
+int sel1757 = (z1757 ? 1757 : 0);
+int add1758 = (x1758 + 1758);
+int mul1759 = (y1759 * 1759);
+int sel1760 = (z1760 ? 1760 : 0);
+int add1761 = (x1761 + 1761);
+int mul1762 = (y1762 * 1762);
+int sel1763 = (z1763 ? 1763 : 0);
+int add1764 = (x1764 + 1764);
+int mul1765 = (y1765 * 1765);
+int sel1766 = (z1766 ? 1766 : 0);
+int add1767 = (x1767 + 1767);
+int mul1768 = (y1768 * 1768);
+int sel1769 = (z1769 ? 1769 : 0);
+int add1770 = (x1770 + 1770);
+int mul1771 = (y1771 * 1771);
+int sel1772 = (z1772 ? 1772 : 0);
+int add1773 = (x1773 + 1773);
+int mul1774 = (y1774 * 1774);
+int sel1775 = (z1775 ? 1775 : 0);
+int add1776 = (x1776 + 1776);
+int mul1777 = (y1777 * 1777);
+int sel1778 = (z1778 ? 1778 : 0);
+int add1779 = (x1779 + 1779);
+int mul1780 = (y1780 * 1780);
+int sel1781 = (z1781 ? 1781 : 0);
+int add1782 = (x1782 + 1782);
+int mul1783 = (y1783 * 1783);
+int sel1784 = (z1784 ? 1784 : 0);
+int add1785 = (x1785 + 1785);
+int mul1786 = (y1786 * 1786);
+int sel1787 = (z1787 ? 1787 : 0);
+int add1788 = (x1788 + 1788);
+int mul1789 = (y1789 * 1789);
+int sel1790 = (z1790 ? 1790 : 0);
+int add1791 = (x1791 + 1791);
+int mul1792 = (y1792 * 1792);
+int sel1793 = (z1793 ? 1793 : 0);
+int add1794 = (x1794 + 1794);
+int mul1795 = (y1795 * 1795);
+int sel1796 = (z1796 ? 1796 : 0);
+int add1797 = (x1797 + 1797);
+int mul1798 = (y1798 * 1798);
+int sel1799 = (z1799 ? 1799 : 0);
+int add1800 = (x1800 + 1800);
+int mul1801 = (y1801 * 1801);
+int sel1802 = (z1802 ? 1802 : 0);
+int add1803 = (x1803 + 1803);
+int mul1804 = (y1804 * 1804);
+int sel1805 = (z1805 ? 1805 : 0);
+int add1806 = (x1806 + 1806);
+int mul1807 = (y1807 * 1807);
+int sel1808 = (z1808 ? 1808 : 0);
+int add1809 = (x1809 + 1809);
+int mul1810 = (y1810 * 1810);
+int sel1811 = (z1811 ? 1811 : 0);
+int add1812 = (x1812 + 1812);
+int mul1813 = (y1813 * 1813);
+int sel1814 = (z1814 ? 1814 : 0);
+int add1815 = (x1815 + 1815);
+int mul1816 = (y1816 * 1816);
+int sel1817 = (z1817 ? 1817 : 0);
+int add1818 = (x1818 + 1818);
+int mul1819 = (y1819 * 1819);
+int sel1820 = (z1820 ? 1820 : 0);
+int add1821 = (x1821 + 1821);
+int mul1822 = (y1822 * 1822);
+int sel1823 = (z1823 ? 1823 : 0);
+int add1824 = (x1824 + 1824);
+int mul1825 = (y1825 * 1825);
+int sel1826 = (z1826 ? 1826 : 0);
+int add1827 = (x1827 + 1827);
+int mul1828 = (y1828 * 1828);
+int sel1829 = (z1829 ? 1829 : 0);
+int add1830 = (x1830 + 1830);
+int mul1831 = (y1831 * 1831);
+int sel1832 = (z1832 ? 1832 : 0);
+int add1833 = (x1833 + 1833);
+int mul1834 = (y1834 * 1834);
+int sel1835 = (z1835 ? 1835 : 0);
+int add1836 = (x1836 + 1836);
+int mul1837 = (y1837 * 1837);
+int sel1838 = (z1838 ? 1838 : 0);
+int add1839 = (x1839 + 1839);
+int mul1840 = (y1840 * 1840);
+int sel1841 = (z1841 ? 1841 : 0);
+int add1842 = (x1842 + 1842);
+int mul1843 = (y1843 * 1843);
+int sel1844 = (z1844 ? 1844 : 0);
+int add1845 = (x1845 + 1845);
+int mul1846 = (y1846 * 1846);
+int sel1847 = (z1847 ? 1847 : 0);
+int add1848 = (x1848 + 1848);
+int mul1849 = (y1849 * 1849);
+int sel1850 = (z1850 ? 1850 : 0);
+int add1851 = (x1851 + 1851);
+int mul1852 = (y1852 * 1852);
+int sel1853 = (z1853 ? 1853 : 0);
+int add1854 = (x1854 + 1854);
+int mul1855 = (y1855 * 1855);
+int sel1856 = (z1856 ? 1856 : 0);
+int add1857 = (x1857 + 1857);
+int mul1858 = (y1858 * 1858);
+int sel1859 = (z1859 ? 1859 : 0);
+int add1860 = (x1860 + 1860);
+int mul1861 = (y1861 * 1861);
+int sel1862 = (z1862 ? 1862 : 0);
+int add1863 = (x1863 + 1863);
+int mul1864 = (y1864 * 1864);
+int sel1865 = (z1865 ? 1865 : 0);
+int add1866 = (x1866 + 1866);
+int mul1867 = (y1867 * 1867);
+int sel1868 = (z1868 ? 1868 : 0);
+int add1869 = (x1869 + 1869);
+int mul1870 = (y1870 * 1870);
+int sel1871 = (z1871 ? 1871 : 0);
+int add1872 = (x1872 + 1872);
+int mul1873 = (y1873 * 1873);
+int sel1874 = (z1874 ? 1874 : 0);
+int add1875 = (x1875 + 1875);
+int mul1876 = (y1876 * 1876);
+int sel1877 = (z1877 ? 1877 : 0);
+int add1878 = (x1878 + 1878);
+int mul1879 = (y1879 * 1879);
+int sel1880 = (z1880 ? 1880 : 0);
+int add1881 = (x1881 + 1881);
+int mul1882 = (y1882 * 1882);
+int sel1883 = (z1883 ? 1883 : 0);
+int add1884 = (x1884 + 1884);
+int mul1885 = (y1885 * 1885);
+int sel1886 = (z1886 ? 1886 : 0);
+int add1887 = (x1887 + 1887);
+int mul1888 = (y1888 * 1888);
+int sel1889 = (z1889 ? 1889 : 0);
+int add1890 = (x1890 + 1890);
+int mul1891 = (y1891 * 1891);
+int sel1892 = (z1892 ? 1892 : 0);
+int add1893 = (x1893 + 1893);
+int mul1894 = (y1894 * 1894);
+int sel1895 = (z1895 ? 1895 : 0);
+int add1896 = (x1896 + 1896);
+int mul1897 = (y1897 * 1897);
+int sel1898 = (z1898 ? 1898 : 0);
+int add1899 = (x1899 + 1899);
+int mul1900 = (y1900 * 1900);
+int sel1901 = (z1901 ? 1901 : 0);
+int add1902 = (x1902 + 1902);
+int mul1903 = (y1903 * 1903);
+int sel1904 = (z1904 ? 1904 : 0);
+int add1905 = (x1905 + 1905);
+int mul1906 = (y1906 * 1906);
+int sel1907 = (z1907 ? 1907 : 0);
+int add1908 = (x1908 + 1908);
+int mul1909 = (y1909 * 1909);
+int sel1910 = (z1910 ? 1910 : 0);
+int add1911 = (x1911 + 1911);
+int mul1912 = (y1912 * 1912);
+int sel1913 = (z1913 ? 1913 : 0);
+int add1914 = (x1914 + 1914);
+int mul1915 = (y1915 * 1915);
+int sel1916 = (z1916 ? 1916 : 0);
+int add1917 = (x1917 + 1917);
+int mul1918 = (y1918 * 1918);
+int sel1919 = (z1919 ? 1919 : 0);
+int add1920 = (x1920 + 1920);
+int mul1921 = (y1921 * 1921);
+int sel1922 = (z1922 ? 1922 : 0);
+int add1923 = (x1923 + 1923);
+int mul1924 = (y1924 * 1924);
+int sel1925 = (z1925 ? 1925 : 0);
+int add1926 = (x1926 + 1926);
+int mul1927 = (y1927 * 1927);
+int sel1928 = (z1928 ? 1928 : 0);
+int add1929 = (x1929 + 1929);
+int mul1930 = (y1930 * 1930);
+int sel1931 = (z1931 ? 1931 : 0);
+int add1932 = (x1932 + 1932);
+int mul1933 = (y1933 * 1933);
+int sel1934 = (z1934 ? 1934 : 0);
+int add1935 = (x1935 + 1935);
+int mul1936 = (y1936 * 1936);
+int sel1937 = (z1937 ? 1937 : 0);
+int add1938 = (x1938 + 1938);
+int mul1939 = (y1939 * 1939);
+int sel1940 = (z1940 ? 1940 : 0);
+int add1941 = (x1941 + 1941);
+int mul1942 = (y1942 * 1942);
+int sel1943 = (z1943 ? 1943 : 0);
+int add1944 = (x1944 + 1944);
+int mul1945 = (y1945 * 1945);
+int sel1946 = (z1946 ? 1946 : 0);
+int add1947 = (x1947 + 1947);
+int mul1948 = (y1948 * 1948);
+int sel1949 = (z1949 ? 1949 : 0);
+int add1950 = (x1950 + 1950);
+int mul1951 = (y1951 * 1951);
+int sel1952 = (z1952 ? 1952 : 0);
+int add1953 = (x1953 + 1953);
+int mul1954 = (y1954 * 1954);
+int sel1955 = (z1955 ? 1955 : 0);
+int add1956 = (x1956 + 1956);
+int mul1957 = (y1957 * 1957);
+int sel1958 = (z1958 ? 1958 : 0);
+int add1959 = (x1959 + 1959);
+int mul1960 = (y1960 * 1960);
+int sel1961 = (z1961 ? 1961 : 0);
+int add1962 = (x1962 + 1962);
+int mul1963 = (y1963 * 1963);
+int sel1964 = (z1964 ? 1964 : 0);
+int add1965 = (x1965 + 1965);
+int mul1966 = (y1966 * 1966);
+int sel1967 = (z1967 ? 1967 : 0);
+int add1968 = (x1968 + 1968);
+int mul1969 = (y1969 * 1969);
+int sel1970 = (z1970 ? 1970 : 0);
+int add1971 = (x1971 + 1971);
+int mul1972 = (y1972 * 1972);
+int sel1973 = (z1973 ? 1973 : 0);
+int add1974 = (x1974 + 1974);
+int mul1975 = (y1975 * 1975);
+int sel1976 = (z1976 ? 1976 : 0);
+int add1977 = (x1977 + 1977);
+int mul1978 = (y1978 * 1978);
+int sel1979 = (z1979 ? 1979 : 0);
+int add1980 = (x1980 + 1980);
+int mul1981 = (y1981 * 1981);
+int sel1982 = (z1982 ? 1982 : 0);
+int add1983 = (x1983 + 1983);
+int mul1984 = (y1984 * 1984);
+int sel1985 = (z1985 ? 1985 : 0);
+int add1986 = (x1986 + 1986);
+int mul1987 = (y1987 * 1987);
+int sel1988 = (z1988 ? 1988 : 0);
+int add1989 = (x1989 + 1989);
+int mul1990 = (y1990 * 1990);
+int sel1991 = (z1991 ? 1991 : 0);
+int add1992 = (x1992 + 1992);
+int mul1993 = (y1993 * 1993);
+int sel1994 = (z1994 ? 1994 : 0);
+int add1995 = (x1995 + 1995);
+int mul1996 = (y1996 * 1996);
+int sel1997 = (z1997 ? 1997 : 0);
+int add1998 = (x1998 + 1998);
+int mul1999 = (y1999 * 1999);
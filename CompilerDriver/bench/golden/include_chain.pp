@@ -0,0 +1,642 @@
+# 3 "./chain_127.h"
+int chain127_0;
+int chain127_1;
+int chain127_2;
+int chain127_3;
+# 4 "./chain_126.h"
+int chain126_0;
+int chain126_1;
+int chain126_2;
+int chain126_3;
+# 4 "./chain_125.h"
+int chain125_0;
+int chain125_1;
+int chain125_2;
+int chain125_3;
+# 4 "./chain_124.h"
+int chain124_0;
+int chain124_1;
+int chain124_2;
+int chain124_3;
+# 4 "./chain_123.h"
+int chain123_0;
+int chain123_1;
+int chain123_2;
+int chain123_3;
+# 4 "./chain_122.h"
+int chain122_0;
+int chain122_1;
+int chain122_2;
+int chain122_3;
+# 4 "./chain_121.h"
+int chain121_0;
+int chain121_1;
+int chain121_2;
+int chain121_3;
+# 4 "./chain_120.h"
+int chain120_0;
+int chain120_1;
+int chain120_2;
+int chain120_3;
+# 4 "./chain_119.h"
+int chain119_0;
+int chain119_1;
+int chain119_2;
+int chain119_3;
+# 4 "./chain_118.h"
+int chain118_0;
+int chain118_1;
+int chain118_2;
+int chain118_3;
+# 4 "./chain_117.h"
+int chain117_0;
+int chain117_1;
+int chain117_2;
+int chain117_3;
+# 4 "./chain_116.h"
+int chain116_0;
+int chain116_1;
+int chain116_2;
+int chain116_3;
+# 4 "./chain_115.h"
+int chain115_0;
+int chain115_1;
+int chain115_2;
+int chain115_3;
+# 4 "./chain_114.h"
+int chain114_0;
+int chain114_1;
+int chain114_2;
+int chain114_3;
+# 4 "./chain_113.h"
+int chain113_0;
+int chain113_1;
+int chain113_2;
+int chain113_3;
+# 4 "./chain_112.h"
+int chain112_0;
+int chain112_1;
+int chain112_2;
+int chain112_3;
+# 4 "./chain_111.h"
+int chain111_0;
+int chain111_1;
+int chain111_2;
+int chain111_3;
+# 4 "./chain_110.h"
+int chain110_0;
+int chain110_1;
+int chain110_2;
+int chain110_3;
+# 4 "./chain_109.h"
+int chain109_0;
+int chain109_1;
+int chain109_2;
+int chain109_3;
+# 4 "./chain_108.h"
+int chain108_0;
+int chain108_1;
+int chain108_2;
+int chain108_3;
+# 4 "./chain_107.h"
+int chain107_0;
+int chain107_1;
+int chain107_2;
+int chain107_3;
+# 4 "./chain_106.h"
+int chain106_0;
+int chain106_1;
+int chain106_2;
+int chain106_3;
+# 4 "./chain_105.h"
+int chain105_0;
+int chain105_1;
+int chain105_2;
+int chain105_3;
+# 4 "./chain_104.h"
+int chain104_0;
+int chain104_1;
+int chain104_2;
+int chain104_3;
+# 4 "./chain_103.h"
+int chain103_0;
+int chain103_1;
+int chain103_2;
+int chain103_3;
+# 4 "./chain_102.h"
+int chain102_0;
+int chain102_1;
+int chain102_2;
+int chain102_3;
+# 4 "./chain_101.h"
+int chain101_0;
+int chain101_1;
+int chain101_2;
+int chain101_3;
+# 4 "./chain_100.h"
+int chain100_0;
+int chain100_1;
+int chain100_2;
+int chain100_3;
+# 4 "./chain_099.h"
+int chain099_0;
+int chain099_1;
+int chain099_2;
+int chain099_3;
+# 4 "./chain_098.h"
+int chain098_0;
+int chain098_1;
+int chain098_2;
+int chain098_3;
+# 4 "./chain_097.h"
+int chain097_0;
+int chain097_1;
+int chain097_2;
+int chain097_3;
+# 4 "./chain_096.h"
+int chain096_0;
+int chain096_1;
+int chain096_2;
+int chain096_3;
+# 4 "./chain_095.h"
+int chain095_0;
+int chain095_1;
+int chain095_2;
+int chain095_3;
+# 4 "./chain_094.h"
+int chain094_0;
+int chain094_1;
+int chain094_2;
+int chain094_3;
+# 4 "./chain_093.h"
+int chain093_0;
+int chain093_1;
+int chain093_2;
+int chain093_3;
+# 4 "./chain_092.h"
+int chain092_0;
+int chain092_1;
+int chain092_2;
+int chain092_3;
+# 4 "./chain_091.h"
+int chain091_0;
+int chain091_1;
+int chain091_2;
+int chain091_3;
+# 4 "./chain_090.h"
+int chain090_0;
+int chain090_1;
+int chain090_2;
+int chain090_3;
+# 4 "./chain_089.h"
+int chain089_0;
+int chain089_1;
+int chain089_2;
+int chain089_3;
+# 4 "./chain_088.h"
+int chain088_0;
+int chain088_1;
+int chain088_2;
+int chain088_3;
+# 4 "./chain_087.h"
+int chain087_0;
+int chain087_1;
+int chain087_2;
+int chain087_3;
+# 4 "./chain_086.h"
+int chain086_0;
+int chain086_1;
+int chain086_2;
+int chain086_3;
+# 4 "./chain_085.h"
+int chain085_0;
+int chain085_1;
+int chain085_2;
+int chain085_3;
+# 4 "./chain_084.h"
+int chain084_0;
+int chain084_1;
+int chain084_2;
+int chain084_3;
+# 4 "./chain_083.h"
+int chain083_0;
+int chain083_1;
+int chain083_2;
+int chain083_3;
+# 4 "./chain_082.h"
+int chain082_0;
+int chain082_1;
+int chain082_2;
+int chain082_3;
+# 4 "./chain_081.h"
+int chain081_0;
+int chain081_1;
+int chain081_2;
+int chain081_3;
+# 4 "./chain_080.h"
+int chain080_0;
+int chain080_1;
+int chain080_2;
+int chain080_3;
+# 4 "./chain_079.h"
+int chain079_0;
+int chain079_1;
+int chain079_2;
+int chain079_3;
+# 4 "./chain_078.h"
+int chain078_0;
+int chain078_1;
+int chain078_2;
+int chain078_3;
+# 4 "./chain_077.h"
+int chain077_0;
+int chain077_1;
+int chain077_2;
+int chain077_3;
+# 4 "./chain_076.h"
+int chain076_0;
+int chain076_1;
+int chain076_2;
+int chain076_3;
+# 4 "./chain_075.h"
+int chain075_0;
+int chain075_1;
+int chain075_2;
+int chain075_3;
+# 4 "./chain_074.h"
+int chain074_0;
+int chain074_1;
+int chain074_2;
+int chain074_3;
+# 4 "./chain_073.h"
+int chain073_0;
+int chain073_1;
+int chain073_2;
+int chain073_3;
+# 4 "./chain_072.h"
+int chain072_0;
+int chain072_1;
+int chain072_2;
+int chain072_3;
+# 4 "./chain_071.h"
+int chain071_0;
+int chain071_1;
+int chain071_2;
+int chain071_3;
+# 4 "./chain_070.h"
+int chain070_0;
+int chain070_1;
+int chain070_2;
+int chain070_3;
+# 4 "./chain_069.h"
+int chain069_0;
+int chain069_1;
+int chain069_2;
+int chain069_3;
+# 4 "./chain_068.h"
+int chain068_0;
+int chain068_1;
+int chain068_2;
+int chain068_3;
+# 4 "./chain_067.h"
+int chain067_0;
+int chain067_1;
+int chain067_2;
+int chain067_3;
+# 4 "./chain_066.h"
+int chain066_0;
+int chain066_1;
+int chain066_2;
+int chain066_3;
+# 4 "./chain_065.h"
+int chain065_0;
+int chain065_1;
+int chain065_2;
+int chain065_3;
+# 4 "./chain_064.h"
+int chain064_0;
+int chain064_1;
+int chain064_2;
+int chain064_3;
+# 4 "./chain_063.h"
+int chain063_0;
+int chain063_1;
+int chain063_2;
+int chain063_3;
+# 4 "./chain_062.h"
+int chain062_0;
+int chain062_1;
+int chain062_2;
+int chain062_3;
+# 4 "./chain_061.h"
+int chain061_0;
+int chain061_1;
+int chain061_2;
+int chain061_3;
+# 4 "./chain_060.h"
+int chain060_0;
+int chain060_1;
+int chain060_2;
+int chain060_3;
+# 4 "./chain_059.h"
+int chain059_0;
+int chain059_1;
+int chain059_2;
+int chain059_3;
+# 4 "./chain_058.h"
+int chain058_0;
+int chain058_1;
+int chain058_2;
+int chain058_3;
+# 4 "./chain_057.h"
+int chain057_0;
+int chain057_1;
+int chain057_2;
+int chain057_3;
+# 4 "./chain_056.h"
+int chain056_0;
+int chain056_1;
+int chain056_2;
+int chain056_3;
+# 4 "./chain_055.h"
+int chain055_0;
+int chain055_1;
+int chain055_2;
+int chain055_3;
+# 4 "./chain_054.h"
+int chain054_0;
+int chain054_1;
+int chain054_2;
+int chain054_3;
+# 4 "./chain_053.h"
+int chain053_0;
+int chain053_1;
+int chain053_2;
+int chain053_3;
+# 4 "./chain_052.h"
+int chain052_0;
+int chain052_1;
+int chain052_2;
+int chain052_3;
+# 4 "./chain_051.h"
+int chain051_0;
+int chain051_1;
+int chain051_2;
+int chain051_3;
+# 4 "./chain_050.h"
+int chain050_0;
+int chain050_1;
+int chain050_2;
+int chain050_3;
+# 4 "./chain_049.h"
+int chain049_0;
+int chain049_1;
+int chain049_2;
+int chain049_3;
+# 4 "./chain_048.h"
+int chain048_0;
+int chain048_1;
+int chain048_2;
+int chain048_3;
+# 4 "./chain_047.h"
+int chain047_0;
+int chain047_1;
+int chain047_2;
+int chain047_3;
+# 4 "./chain_046.h"
+int chain046_0;
+int chain046_1;
+int chain046_2;
+int chain046_3;
+# 4 "./chain_045.h"
+int chain045_0;
+int chain045_1;
+int chain045_2;
+int chain045_3;
+# 4 "./chain_044.h"
+int chain044_0;
+int chain044_1;
+int chain044_2;
+int chain044_3;
+# 4 "./chain_043.h"
+int chain043_0;
+int chain043_1;
+int chain043_2;
+int chain043_3;
+# 4 "./chain_042.h"
+int chain042_0;
+int chain042_1;
+int chain042_2;
+int chain042_3;
+# 4 "./chain_041.h"
+int chain041_0;
+int chain041_1;
+int chain041_2;
+int chain041_3;
+# 4 "./chain_040.h"
+int chain040_0;
+int chain040_1;
+int chain040_2;
+int chain040_3;
+# 4 "./chain_039.h"
+int chain039_0;
+int chain039_1;
+int chain039_2;
+int chain039_3;
+# 4 "./chain_038.h"
+int chain038_0;
+int chain038_1;
+int chain038_2;
+int chain038_3;
+# 4 "./chain_037.h"
+int chain037_0;
+int chain037_1;
+int chain037_2;
+int chain037_3;
+# 4 "./chain_036.h"
+int chain036_0;
+int chain036_1;
+int chain036_2;
+int chain036_3;
+# 4 "./chain_035.h"
+int chain035_0;
+int chain035_1;
+int chain035_2;
+int chain035_3;
+# 4 "./chain_034.h"
+int chain034_0;
+int chain034_1;
+int chain034_2;
+int chain034_3;
+# 4 "./chain_033.h"
+int chain033_0;
+int chain033_1;
+int chain033_2;
+int chain033_3;
+# 4 "./chain_032.h"
+int chain032_0;
+int chain032_1;
+int chain032_2;
+int chain032_3;
+# 4 "./chain_031.h"
+int chain031_0;
+int chain031_1;
+int chain031_2;
+int chain031_3;
+# 4 "./chain_030.h"
+int chain030_0;
+int chain030_1;
+int chain030_2;
+int chain030_3;
+# 4 "./chain_029.h"
+int chain029_0;
+int chain029_1;
+int chain029_2;
+int chain029_3;
+# 4 "./chain_028.h"
+int chain028_0;
+int chain028_1;
+int chain028_2;
+int chain028_3;
+# 4 "./chain_027.h"
+int chain027_0;
+int chain027_1;
+int chain027_2;
+int chain027_3;
+# 4 "./chain_026.h"
+int chain026_0;
+int chain026_1;
+int chain026_2;
+int chain026_3;
+# 4 "./chain_025.h"
+int chain025_0;
+int chain025_1;
+int chain025_2;
+int chain025_3;
+# 4 "./chain_024.h"
+int chain024_0;
+int chain024_1;
+int chain024_2;
+int chain024_3;
+# 4 "./chain_023.h"
+int chain023_0;
+int chain023_1;
+int chain023_2;
+int chain023_3;
+# 4 "./chain_022.h"
+int chain022_0;
+int chain022_1;
+int chain022_2;
+int chain022_3;
+# 4 "./chain_021.h"
+int chain021_0;
+int chain021_1;
+int chain021_2;
+int chain021_3;
+# 4 "./chain_020.h"
+int chain020_0;
+int chain020_1;
+int chain020_2;
+int chain020_3;
+# 4 "./chain_019.h"
+int chain019_0;
+int chain019_1;
+int chain019_2;
+int chain019_3;
+# 4 "./chain_018.h"
+int chain018_0;
+int chain018_1;
+int chain018_2;
+int chain018_3;
+# 4 "./chain_017.h"
+int chain017_0;
+int chain017_1;
+int chain017_2;
+int chain017_3;
+# 4 "./chain_016.h"
+int chain016_0;
+int chain016_1;
+int chain016_2;
+int chain016_3;
+# 4 "./chain_015.h"
+int chain015_0;
+int chain015_1;
+int chain015_2;
+int chain015_3;
+# 4 "./chain_014.h"
+int chain014_0;
+int chain014_1;
+int chain014_2;
+int chain014_3;
+# 4 "./chain_013.h"
+int chain013_0;
+int chain013_1;
+int chain013_2;
+int chain013_3;
+# 4 "./chain_012.h"
+int chain012_0;
+int chain012_1;
+int chain012_2;
+int chain012_3;
+# 4 "./chain_011.h"
+int chain011_0;
+int chain011_1;
+int chain011_2;
+int chain011_3;
+# 4 "./chain_010.h"
+int chain010_0;
+int chain010_1;
+int chain010_2;
+int chain010_3;
+# 4 "./chain_009.h"
+int chain009_0;
+int chain009_1;
+int chain009_2;
+int chain009_3;
+# 4 "./chain_008.h"
+int chain008_0;
+int chain008_1;
+int chain008_2;
+int chain008_3;
+# 4 "./chain_007.h"
+int chain007_0;
+int chain007_1;
+int chain007_2;
+int chain007_3;
+# 4 "./chain_006.h"
+int chain006_0;
+int chain006_1;
+int chain006_2;
+int chain006_3;
+# 4 "./chain_005.h"
+int chain005_0;
+int chain005_1;
+int chain005_2;
+int chain005_3;
+# 4 "./chain_004.h"
+int chain004_0;
+int chain004_1;
+int chain004_2;
+int chain004_3;
+# 4 "./chain_003.h"
+int chain003_0;
+int chain003_1;
+int chain003_2;
+int chain003_3;
+# 4 "./chain_002.h"
+int chain002_0;
+int chain002_1;
+int chain002_2;
+int chain002_3;
+# 4 "./chain_001.h"
+int chain001_0;
+int chain001_1;
+int chain001_2;
+int chain001_3;
+# 4 "./chain_000.h"
+int chain000_0;
+int chain000_1;
+int chain000_2;
+int chain000_3;
+# 3 "include_chain.c"
+int main_chain;
@@ -0,0 +1,401 @@
+# 2 "macros_10k.c"
+int use00000 = 0;
+int use00025 = 75;
+int use00050 = 150;
+int use00075 = 225;
+int use00100 = 300;
+int use00125 = 375;
+int use00150 = 450;
+int use00175 = 525;
+int use00200 = 600;
+int use00225 = 675;
+int use00250 = 750;
+int use00275 = 825;
+int use00300 = 900;
+int use00325 = 975;
+int use00350 = 1050;
+int use00375 = 1125;
+int use00400 = 1200;
+int use00425 = 1275;
+int use00450 = 1350;
+int use00475 = 1425;
+int use00500 = 1500;
+int use00525 = 1575;
+int use00550 = 1650;
+int use00575 = 1725;
+int use00600 = 1800;
+int use00625 = 1875;
+int use00650 = 1950;
+int use00675 = 2025;
+int use00700 = 2100;
+int use00725 = 2175;
+int use00750 = 2250;
+int use00775 = 2325;
+int use00800 = 2400;
+int use00825 = 2475;
+int use00850 = 2550;
+int use00875 = 2625;
+int use00900 = 2700;
+int use00925 = 2775;
+int use00950 = 2850;
+int use00975 = 2925;
+int use01000 = 3000;
+int use01025 = 3075;
+int use01050 = 3150;
+int use01075 = 3225;
+int use01100 = 3300;
+int use01125 = 3375;
+int use01150 = 3450;
+int use01175 = 3525;
+int use01200 = 3600;
+int use01225 = 3675;
+int use01250 = 3750;
+int use01275 = 3825;
+int use01300 = 3900;
+int use01325 = 3975;
+int use01350 = 4050;
+int use01375 = 4125;
+int use01400 = 4200;
+int use01425 = 4275;
+int use01450 = 4350;
+int use01475 = 4425;
+int use01500 = 4500;
+int use01525 = 4575;
+int use01550 = 4650;
+int use01575 = 4725;
+int use01600 = 4800;
+int use01625 = 4875;
+int use01650 = 4950;
+int use01675 = 5025;
+int use01700 = 5100;
+int use01725 = 5175;
+int use01750 = 5250;
+int use01775 = 5325;
+int use01800 = 5400;
+int use01825 = 5475;
+int use01850 = 5550;
+int use01875 = 5625;
+int use01900 = 5700;
+int use01925 = 5775;
+int use01950 = 5850;
+int use01975 = 5925;
+int use02000 = 6000;
+int use02025 = 6075;
+int use02050 = 6150;
+int use02075 = 6225;
+int use02100 = 6300;
+int use02125 = 6375;
+int use02150 = 6450;
+int use02175 = 6525;
+int use02200 = 6600;
+int use02225 = 6675;
+int use02250 = 6750;
+int use02275 = 6825;
+int use02300 = 6900;
+int use02325 = 6975;
+int use02350 = 7050;
+int use02375 = 7125;
+int use02400 = 7200;
+int use02425 = 7275;
+int use02450 = 7350;
+int use02475 = 7425;
+int use02500 = 7500;
+int use02525 = 7575;
+int use02550 = 7650;
+int use02575 = 7725;
+int use02600 = 7800;
+int use02625 = 7875;
+int use02650 = 7950;
+int use02675 = 8025;
+int use02700 = 8100;
+int use02725 = 8175;
+int use02750 = 8250;
+int use02775 = 8325;
+int use02800 = 8400;
+int use02825 = 8475;
+int use02850 = 8550;
+int use02875 = 8625;
+int use02900 = 8700;
+int use02925 = 8775;
+int use02950 = 8850;
+int use02975 = 8925;
+int use03000 = 9000;
+int use03025 = 9075;
+int use03050 = 9150;
+int use03075 = 9225;
+int use03100 = 9300;
+int use03125 = 9375;
+int use03150 = 9450;
+int use03175 = 9525;
+int use03200 = 9600;
+int use03225 = 9675;
+int use03250 = 9750;
+int use03275 = 9825;
+int use03300 = 9900;
+int use03325 = 9975;
+int use03350 = 10050;
+int use03375 = 10125;
+int use03400 = 10200;
+int use03425 = 10275;
+int use03450 = 10350;
+int use03475 = 10425;
+int use03500 = 10500;
+int use03525 = 10575;
+int use03550 = 10650;
+int use03575 = 10725;
+int use03600 = 10800;
+int use03625 = 10875;
+int use03650 = 10950;
+int use03675 = 11025;
+int use03700 = 11100;
+int use03725 = 11175;
+int use03750 = 11250;
+int use03775 = 11325;
+int use03800 = 11400;
+int use03825 = 11475;
+int use03850 = 11550;
+int use03875 = 11625;
+int use03900 = 11700;
+int use03925 = 11775;
+int use03950 = 11850;
+int use03975 = 11925;
+int use04000 = 12000;
+int use04025 = 12075;
+int use04050 = 12150;
+int use04075 = 12225;
+int use04100 = 12300;
+int use04125 = 12375;
+int use04150 = 12450;
+int use04175 = 12525;
+int use04200 = 12600;
+int use04225 = 12675;
+int use04250 = 12750;
+int use04275 = 12825;
+int use04300 = 12900;
+int use04325 = 12975;
+int use04350 = 13050;
+int use04375 = 13125;
+int use04400 = 13200;
+int use04425 = 13275;
+int use04450 = 13350;
+int use04475 = 13425;
+int use04500 = 13500;
+int use04525 = 13575;
+int use04550 = 13650;
+int use04575 = 13725;
+int use04600 = 13800;
+int use04625 = 13875;
+int use04650 = 13950;
+int use04675 = 14025;
+int use04700 = 14100;
+int use04725 = 14175;
+int use04750 = 14250;
+int use04775 = 14325;
+int use04800 = 14400;
+int use04825 = 14475;
+int use04850 = 14550;
+int use04875 = 14625;
+int use04900 = 14700;
+int use04925 = 14775;
+int use04950 = 14850;
+int use04975 = 14925;
+int use05000 = 15000;
+int use05025 = 15075;
+int use05050 = 15150;
+int use05075 = 15225;
+int use05100 = 15300;
+int use05125 = 15375;
+int use05150 = 15450;
+int use05175 = 15525;
+int use05200 = 15600;
+int use05225 = 15675;
+int use05250 = 15750;
+int use05275 = 15825;
+int use05300 = 15900;
+int use05325 = 15975;
+int use05350 = 16050;
+int use05375 = 16125;
+int use05400 = 16200;
+int use05425 = 16275;
+int use05450 = 16350;
+int use05475 = 16425;
+int use05500 = 16500;
+int use05525 = 16575;
+int use05550 = 16650;
+int use05575 = 16725;
+int use05600 = 16800;
+int use05625 = 16875;
+int use05650 = 16950;
+int use05675 = 17025;
+int use05700 = 17100;
+int use05725 = 17175;
+int use05750 = 17250;
+int use05775 = 17325;
+int use05800 = 17400;
+int use05825 = 17475;
+int use05850 = 17550;
+int use05875 = 17625;
+int use05900 = 17700;
+int use05925 = 17775;
+int use05950 = 17850;
+int use05975 = 17925;
+int use06000 = 18000;
+int use06025 = 18075;
+int use06050 = 18150;
+int use06075 = 18225;
+int use06100 = 18300;
+int use06125 = 18375;
+int use06150 = 18450;
+int use06175 = 18525;
+int use06200 = 18600;
+int use06225 = 18675;
+int use06250 = 18750;
+int use06275 = 18825;
+int use06300 = 18900;
+int use06325 = 18975;
+int use06350 = 19050;
+int use06375 = 19125;
+int use06400 = 19200;
+int use06425 = 19275;
+int use06450 = 19350;
+int use06475 = 19425;
+int use06500 = 19500;
+int use06525 = 19575;
+int use06550 = 19650;
+int use06575 = 19725;
+int use06600 = 19800;
+int use06625 = 19875;
+int use06650 = 19950;
+int use06675 = 20025;
+int use06700 = 20100;
+int use06725 = 20175;
+int use06750 = 20250;
+int use06775 = 20325;
+int use06800 = 20400;
+int use06825 = 20475;
+int use06850 = 20550;
+int use06875 = 20625;
+int use06900 = 20700;
+int use06925 = 20775;
+int use06950 = 20850;
+int use06975 = 20925;
+int use07000 = 21000;
+int use07025 = 21075;
+int use07050 = 21150;
+int use07075 = 21225;
+int use07100 = 21300;
+int use07125 = 21375;
+int use07150 = 21450;
+int use07175 = 21525;
+int use07200 = 21600;
+int use07225 = 21675;
+int use07250 = 21750;
+int use07275 = 21825;
+int use07300 = 21900;
+int use07325 = 21975;
+int use07350 = 22050;
+int use07375 = 22125;
+int use07400 = 22200;
+int use07425 = 22275;
+int use07450 = 22350;
+int use07475 = 22425;
+int use07500 = 22500;
+int use07525 = 22575;
+int use07550 = 22650;
+int use07575 = 22725;
+int use07600 = 22800;
+int use07625 = 22875;
+int use07650 = 22950;
+int use07675 = 23025;
+int use07700 = 23100;
+int use07725 = 23175;
+int use07750 = 23250;
+int use07775 = 23325;
+int use07800 = 23400;
+int use07825 = 23475;
+int use07850 = 23550;
+int use07875 = 23625;
+int use07900 = 23700;
+int use07925 = 23775;
+int use07950 = 23850;
+int use07975 = 23925;
+int use08000 = 24000;
+int use08025 = 24075;
+int use08050 = 24150;
+int use08075 = 24225;
+int use08100 = 24300;
+int use08125 = 24375;
+int use08150 = 24450;
+int use08175 = 24525;
+int use08200 = 24600;
+int use08225 = 24675;
+int use08250 = 24750;
+int use08275 = 24825;
+int use08300 = 24900;
+int use08325 = 24975;
+int use08350 = 25050;
+int use08375 = 25125;
+int use08400 = 25200;
+int use08425 = 25275;
+int use08450 = 25350;
+int use08475 = 25425;
+int use08500 = 25500;
+int use08525 = 25575;
+int use08550 = 25650;
+int use08575 = 25725;
+int use08600 = 25800;
+int use08625 = 25875;
+int use08650 = 25950;
+int use08675 = 26025;
+int use08700 = 26100;
+int use08725 = 26175;
+int use08750 = 26250;
+int use08775 = 26325;
+int use08800 = 26400;
+int use08825 = 26475;
+int use08850 = 26550;
+int use08875 = 26625;
+int use08900 = 26700;
+int use08925 = 26775;
+int use08950 = 26850;
+int use08975 = 26925;
+int use09000 = 27000;
+int use09025 = 27075;
+int use09050 = 27150;
+int use09075 = 27225;
+int use09100 = 27300;
+int use09125 = 27375;
+int use09150 = 27450;
+int use09175 = 27525;
+int use09200 = 27600;
+int use09225 = 27675;
+int use09250 = 27750;
+int use09275 = 27825;
+int use09300 = 27900;
+int use09325 = 27975;
+int use09350 = 28050;
+int use09375 = 28125;
+int use09400 = 28200;
+int use09425 = 28275;
+int use09450 = 28350;
+int use09475 = 28425;
+int use09500 = 28500;
+int use09525 = 28575;
+int use09550 = 28650;
+int use09575 = 28725;
+int use09600 = 28800;
+int use09625 = 28875;
+int use09650 = 28950;
+int use09675 = 29025;
+int use09700 = 29100;
+int use09725 = 29175;
+int use09750 = 29250;
+int use09775 = 29325;
+int use09800 = 29400;
+int use09825 = 29475;
+int use09850 = 29550;
+int use09875 = 29625;
+int use09900 = 29700;
+int use09925 = 29775;
+int use09950 = 29850;
+int use09975 = 29925;
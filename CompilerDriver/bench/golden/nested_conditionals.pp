@@ -0,0 +1,4495 @@
+# 3 "nested_conditionals.c"
+int on000;
+# 54 "nested_conditionals.c"
+int else000;
+
+
+
+
+
+
+int on001;
+# 112 "nested_conditionals.c"
+int else001;
+
+
+
+
+
+
+int on002;
+# 170 "nested_conditionals.c"
+int else002;
+
+
+
+
+
+
+int on003;
+# 228 "nested_conditionals.c"
+int else003;
+
+
+
+
+
+
+int on004;
+# 286 "nested_conditionals.c"
+int else004;
+
+
+
+
+
+
+int on005;
+# 344 "nested_conditionals.c"
+int else005;
+
+
+
+
+
+
+int on006;
+# 402 "nested_conditionals.c"
+int else006;
+
+
+
+
+
+
+int on007;
+# 460 "nested_conditionals.c"
+int else007;
+
+
+
+
+
+
+int on008;
+# 518 "nested_conditionals.c"
+int else008;
+
+
+
+
+
+
+int on009;
+# 576 "nested_conditionals.c"
+int else009;
+
+
+
+
+
+
+int on010;
+# 634 "nested_conditionals.c"
+int else010;
+
+
+
+
+
+
+int on011;
+# 692 "nested_conditionals.c"
+int else011;
+
+
+
+
+
+
+int on012;
+# 750 "nested_conditionals.c"
+int else012;
+
+
+
+
+
+
+int on013;
+# 808 "nested_conditionals.c"
+int else013;
+
+
+
+
+
+
+int on014;
+# 866 "nested_conditionals.c"
+int else014;
+
+
+
+
+
+
+int on015;
+# 924 "nested_conditionals.c"
+int else015;
+
+
+
+
+
+
+int on016;
+# 982 "nested_conditionals.c"
+int else016;
+
+
+
+
+
+
+int on017;
+# 1040 "nested_conditionals.c"
+int else017;
+
+
+
+
+
+
+int on018;
+# 1098 "nested_conditionals.c"
+int else018;
+
+
+
+
+
+
+int on019;
+# 1156 "nested_conditionals.c"
+int else019;
+
+
+
+
+
+
+int on020;
+# 1214 "nested_conditionals.c"
+int else020;
+
+
+
+
+
+
+int on021;
+# 1272 "nested_conditionals.c"
+int else021;
+
+
+
+
+
+
+int on022;
+# 1330 "nested_conditionals.c"
+int else022;
+
+
+
+
+
+
+int on023;
+# 1388 "nested_conditionals.c"
+int else023;
+
+
+
+
+
+
+int on024;
+# 1446 "nested_conditionals.c"
+int else024;
+
+
+
+
+
+
+int on025;
+# 1504 "nested_conditionals.c"
+int else025;
+
+
+
+
+
+
+int on026;
+# 1562 "nested_conditionals.c"
+int else026;
+
+
+
+
+
+
+int on027;
+# 1620 "nested_conditionals.c"
+int else027;
+
+
+
+
+
+
+int on028;
+# 1678 "nested_conditionals.c"
+int else028;
+
+
+
+
+
+
+int on029;
+# 1736 "nested_conditionals.c"
+int else029;
+
+
+
+
+
+
+int on030;
+# 1794 "nested_conditionals.c"
+int else030;
+
+
+
+
+
+
+int on031;
+# 1852 "nested_conditionals.c"
+int else031;
+
+
+
+
+
+
+int on032;
+# 1910 "nested_conditionals.c"
+int else032;
+
+
+
+
+
+
+int on033;
+# 1968 "nested_conditionals.c"
+int else033;
+
+
+
+
+
+
+int on034;
+# 2026 "nested_conditionals.c"
+int else034;
+
+
+
+
+
+
+int on035;
+# 2084 "nested_conditionals.c"
+int else035;
+
+
+
+
+
+
+int on036;
+# 2142 "nested_conditionals.c"
+int else036;
+
+
+
+
+
+
+int on037;
+# 2200 "nested_conditionals.c"
+int else037;
+
+
+
+
+
+
+int on038;
+# 2258 "nested_conditionals.c"
+int else038;
+
+
+
+
+
+
+int on039;
+# 2316 "nested_conditionals.c"
+int else039;
+
+
+
+
+
+
+int on040;
+# 2374 "nested_conditionals.c"
+int else040;
+
+
+
+
+
+
+int on041;
+# 2432 "nested_conditionals.c"
+int else041;
+
+
+
+
+
+
+int on042;
+# 2490 "nested_conditionals.c"
+int else042;
+
+
+
+
+
+
+int on043;
+# 2548 "nested_conditionals.c"
+int else043;
+
+
+
+
+
+
+int on044;
+# 2606 "nested_conditionals.c"
+int else044;
+
+
+
+
+
+
+int on045;
+# 2664 "nested_conditionals.c"
+int else045;
+
+
+
+
+
+
+int on046;
+# 2722 "nested_conditionals.c"
+int else046;
+
+
+
+
+
+
+int on047;
+# 2780 "nested_conditionals.c"
+int else047;
+
+
+
+
+
+
+int on048;
+# 2838 "nested_conditionals.c"
+int else048;
+
+
+
+
+
+
+int on049;
+# 2896 "nested_conditionals.c"
+int else049;
+
+
+
+
+
+
+int on050;
+# 2954 "nested_conditionals.c"
+int else050;
+
+
+
+
+
+
+int on051;
+# 3012 "nested_conditionals.c"
+int else051;
+
+
+
+
+
+
+int on052;
+# 3070 "nested_conditionals.c"
+int else052;
+
+
+
+
+
+
+int on053;
+# 3128 "nested_conditionals.c"
+int else053;
+
+
+
+
+
+
+int on054;
+# 3186 "nested_conditionals.c"
+int else054;
+
+
+
+
+
+
+int on055;
+# 3244 "nested_conditionals.c"
+int else055;
+
+
+
+
+
+
+int on056;
+# 3302 "nested_conditionals.c"
+int else056;
+
+
+
+
+
+
+int on057;
+# 3360 "nested_conditionals.c"
+int else057;
+
+
+
+
+
+
+int on058;
+# 3418 "nested_conditionals.c"
+int else058;
+
+
+
+
+
+
+int on059;
+# 3476 "nested_conditionals.c"
+int else059;
+
+
+
+
+
+
+int on060;
+# 3534 "nested_conditionals.c"
+int else060;
+
+
+
+
+
+
+int on061;
+# 3592 "nested_conditionals.c"
+int else061;
+
+
+
+
+
+
+int on062;
+# 3650 "nested_conditionals.c"
+int else062;
+
+
+
+
+
+
+int on063;
+# 3708 "nested_conditionals.c"
+int else063;
+
+
+
+
+
+
+int on064;
+# 3766 "nested_conditionals.c"
+int else064;
+
+
+
+
+
+
+int on065;
+# 3824 "nested_conditionals.c"
+int else065;
+
+
+
+
+
+
+int on066;
+# 3882 "nested_conditionals.c"
+int else066;
+
+
+
+
+
+
+int on067;
+# 3940 "nested_conditionals.c"
+int else067;
+
+
+
+
+
+
+int on068;
+# 3998 "nested_conditionals.c"
+int else068;
+
+
+
+
+
+
+int on069;
+# 4056 "nested_conditionals.c"
+int else069;
+
+
+
+
+
+
+int on070;
+# 4114 "nested_conditionals.c"
+int else070;
+
+
+
+
+
+
+int on071;
+# 4172 "nested_conditionals.c"
+int else071;
+
+
+
+
+
+
+int on072;
+# 4230 "nested_conditionals.c"
+int else072;
+
+
+
+
+
+
+int on073;
+# 4288 "nested_conditionals.c"
+int else073;
+
+
+
+
+
+
+int on074;
+# 4346 "nested_conditionals.c"
+int else074;
+
+
+
+
+
+
+int on075;
+# 4404 "nested_conditionals.c"
+int else075;
+
+
+
+
+
+
+int on076;
+# 4462 "nested_conditionals.c"
+int else076;
+
+
+
+
+
+
+int on077;
+# 4520 "nested_conditionals.c"
+int else077;
+
+
+
+
+
+
+int on078;
+# 4578 "nested_conditionals.c"
+int else078;
+
+
+
+
+
+
+int on079;
+# 4636 "nested_conditionals.c"
+int else079;
+
+
+
+
+
+
+int on080;
+# 4694 "nested_conditionals.c"
+int else080;
+
+
+
+
+
+
+int on081;
+# 4752 "nested_conditionals.c"
+int else081;
+
+
+
+
+
+
+int on082;
+# 4810 "nested_conditionals.c"
+int else082;
+
+
+
+
+
+
+int on083;
+# 4868 "nested_conditionals.c"
+int else083;
+
+
+
+
+
+
+int on084;
+# 4926 "nested_conditionals.c"
+int else084;
+
+
+
+
+
+
+int on085;
+# 4984 "nested_conditionals.c"
+int else085;
+
+
+
+
+
+
+int on086;
+# 5042 "nested_conditionals.c"
+int else086;
+
+
+
+
+
+
+int on087;
+# 5100 "nested_conditionals.c"
+int else087;
+
+
+
+
+
+
+int on088;
+# 5158 "nested_conditionals.c"
+int else088;
+
+
+
+
+
+
+int on089;
+# 5216 "nested_conditionals.c"
+int else089;
+
+
+
+
+
+
+int on090;
+# 5274 "nested_conditionals.c"
+int else090;
+
+
+
+
+
+
+int on091;
+# 5332 "nested_conditionals.c"
+int else091;
+
+
+
+
+
+
+int on092;
+# 5390 "nested_conditionals.c"
+int else092;
+
+
+
+
+
+
+int on093;
+# 5448 "nested_conditionals.c"
+int else093;
+
+
+
+
+
+
+int on094;
+# 5506 "nested_conditionals.c"
+int else094;
+
+
+
+
+
+
+int on095;
+# 5564 "nested_conditionals.c"
+int else095;
+
+
+
+
+
+
+int on096;
+# 5622 "nested_conditionals.c"
+int else096;
+
+
+
+
+
+
+int on097;
+# 5680 "nested_conditionals.c"
+int else097;
+
+
+
+
+
+
+int on098;
+# 5738 "nested_conditionals.c"
+int else098;
+
+
+
+
+
+
+int on099;
+# 5796 "nested_conditionals.c"
+int else099;
+
+
+
+
+
+
+int on100;
+# 5854 "nested_conditionals.c"
+int else100;
+
+
+
+
+
+
+int on101;
+# 5912 "nested_conditionals.c"
+int else101;
+
+
+
+
+
+
+int on102;
+# 5970 "nested_conditionals.c"
+int else102;
+
+
+
+
+
+
+int on103;
+# 6028 "nested_conditionals.c"
+int else103;
+
+
+
+
+
+
+int on104;
+# 6086 "nested_conditionals.c"
+int else104;
+
+
+
+
+
+
+int on105;
+# 6144 "nested_conditionals.c"
+int else105;
+
+
+
+
+
+
+int on106;
+# 6202 "nested_conditionals.c"
+int else106;
+
+
+
+
+
+
+int on107;
+# 6260 "nested_conditionals.c"
+int else107;
+
+
+
+
+
+
+int on108;
+# 6318 "nested_conditionals.c"
+int else108;
+
+
+
+
+
+
+int on109;
+# 6376 "nested_conditionals.c"
+int else109;
+
+
+
+
+
+
+int on110;
+# 6434 "nested_conditionals.c"
+int else110;
+
+
+
+
+
+
+int on111;
+# 6492 "nested_conditionals.c"
+int else111;
+
+
+
+
+
+
+int on112;
+# 6550 "nested_conditionals.c"
+int else112;
+
+
+
+
+
+
+int on113;
+# 6608 "nested_conditionals.c"
+int else113;
+
+
+
+
+
+
+int on114;
+# 6666 "nested_conditionals.c"
+int else114;
+
+
+
+
+
+
+int on115;
+# 6724 "nested_conditionals.c"
+int else115;
+
+
+
+
+
+
+int on116;
+# 6782 "nested_conditionals.c"
+int else116;
+
+
+
+
+
+
+int on117;
+# 6840 "nested_conditionals.c"
+int else117;
+
+
+
+
+
+
+int on118;
+# 6898 "nested_conditionals.c"
+int else118;
+
+
+
+
+
+
+int on119;
+# 6956 "nested_conditionals.c"
+int else119;
+
+
+
+
+
+
+int on120;
+# 7014 "nested_conditionals.c"
+int else120;
+
+
+
+
+
+
+int on121;
+# 7072 "nested_conditionals.c"
+int else121;
+
+
+
+
+
+
+int on122;
+# 7130 "nested_conditionals.c"
+int else122;
+
+
+
+
+
+
+int on123;
+# 7188 "nested_conditionals.c"
+int else123;
+
+
+
+
+
+
+int on124;
+# 7246 "nested_conditionals.c"
+int else124;
+
+
+
+
+
+
+int on125;
+# 7304 "nested_conditionals.c"
+int else125;
+
+
+
+
+
+
+int on126;
+# 7362 "nested_conditionals.c"
+int else126;
+
+
+
+
+
+
+int on127;
+# 7420 "nested_conditionals.c"
+int else127;
+
+
+
+
+
+
+int on128;
+# 7478 "nested_conditionals.c"
+int else128;
+
+
+
+
+
+
+int on129;
+# 7536 "nested_conditionals.c"
+int else129;
+
+
+
+
+
+
+int on130;
+# 7594 "nested_conditionals.c"
+int else130;
+
+
+
+
+
+
+int on131;
+# 7652 "nested_conditionals.c"
+int else131;
+
+
+
+
+
+
+int on132;
+# 7710 "nested_conditionals.c"
+int else132;
+
+
+
+
+
+
+int on133;
+# 7768 "nested_conditionals.c"
+int else133;
+
+
+
+
+
+
+int on134;
+# 7826 "nested_conditionals.c"
+int else134;
+
+
+
+
+
+
+int on135;
+# 7884 "nested_conditionals.c"
+int else135;
+
+
+
+
+
+
+int on136;
+# 7942 "nested_conditionals.c"
+int else136;
+
+
+
+
+
+
+int on137;
+# 8000 "nested_conditionals.c"
+int else137;
+
+
+
+
+
+
+int on138;
+# 8058 "nested_conditionals.c"
+int else138;
+
+
+
+
+
+
+int on139;
+# 8116 "nested_conditionals.c"
+int else139;
+
+
+
+
+
+
+int on140;
+# 8174 "nested_conditionals.c"
+int else140;
+
+
+
+
+
+
+int on141;
+# 8232 "nested_conditionals.c"
+int else141;
+
+
+
+
+
+
+int on142;
+# 8290 "nested_conditionals.c"
+int else142;
+
+
+
+
+
+
+int on143;
+# 8348 "nested_conditionals.c"
+int else143;
+
+
+
+
+
+
+int on144;
+# 8406 "nested_conditionals.c"
+int else144;
+
+
+
+
+
+
+int on145;
+# 8464 "nested_conditionals.c"
+int else145;
+
+
+
+
+
+
+int on146;
+# 8522 "nested_conditionals.c"
+int else146;
+
+
+
+
+
+
+int on147;
+# 8580 "nested_conditionals.c"
+int else147;
+
+
+
+
+
+
+int on148;
+# 8638 "nested_conditionals.c"
+int else148;
+
+
+
+
+
+
+int on149;
+# 8696 "nested_conditionals.c"
+int else149;
+
+
+
+
+
+
+int on150;
+# 8754 "nested_conditionals.c"
+int else150;
+
+
+
+
+
+
+int on151;
+# 8812 "nested_conditionals.c"
+int else151;
+
+
+
+
+
+
+int on152;
+# 8870 "nested_conditionals.c"
+int else152;
+
+
+
+
+
+
+int on153;
+# 8928 "nested_conditionals.c"
+int else153;
+
+
+
+
+
+
+int on154;
+# 8986 "nested_conditionals.c"
+int else154;
+
+
+
+
+
+
+int on155;
+# 9044 "nested_conditionals.c"
+int else155;
+
+
+
+
+
+
+int on156;
+# 9102 "nested_conditionals.c"
+int else156;
+
+
+
+
+
+
+int on157;
+# 9160 "nested_conditionals.c"
+int else157;
+
+
+
+
+
+
+int on158;
+# 9218 "nested_conditionals.c"
+int else158;
+
+
+
+
+
+
+int on159;
+# 9276 "nested_conditionals.c"
+int else159;
+
+
+
+
+
+
+int on160;
+# 9334 "nested_conditionals.c"
+int else160;
+
+
+
+
+
+
+int on161;
+# 9392 "nested_conditionals.c"
+int else161;
+
+
+
+
+
+
+int on162;
+# 9450 "nested_conditionals.c"
+int else162;
+
+
+
+
+
+
+int on163;
+# 9508 "nested_conditionals.c"
+int else163;
+
+
+
+
+
+
+int on164;
+# 9566 "nested_conditionals.c"
+int else164;
+
+
+
+
+
+
+int on165;
+# 9624 "nested_conditionals.c"
+int else165;
+
+
+
+
+
+
+int on166;
+# 9682 "nested_conditionals.c"
+int else166;
+
+
+
+
+
+
+int on167;
+# 9740 "nested_conditionals.c"
+int else167;
+
+
+
+
+
+
+int on168;
+# 9798 "nested_conditionals.c"
+int else168;
+
+
+
+
+
+
+int on169;
+# 9856 "nested_conditionals.c"
+int else169;
+
+
+
+
+
+
+int on170;
+# 9914 "nested_conditionals.c"
+int else170;
+
+
+
+
+
+
+int on171;
+# 9972 "nested_conditionals.c"
+int else171;
+
+
+
+
+
+
+int on172;
+# 10030 "nested_conditionals.c"
+int else172;
+
+
+
+
+
+
+int on173;
+# 10088 "nested_conditionals.c"
+int else173;
+
+
+
+
+
+
+int on174;
+# 10146 "nested_conditionals.c"
+int else174;
+
+
+
+
+
+
+int on175;
+# 10204 "nested_conditionals.c"
+int else175;
+
+
+
+
+
+
+int on176;
+# 10262 "nested_conditionals.c"
+int else176;
+
+
+
+
+
+
+int on177;
+# 10320 "nested_conditionals.c"
+int else177;
+
+
+
+
+
+
+int on178;
+# 10378 "nested_conditionals.c"
+int else178;
+
+
+
+
+
+
+int on179;
+# 10436 "nested_conditionals.c"
+int else179;
+
+
+
+
+
+
+int on180;
+# 10494 "nested_conditionals.c"
+int else180;
+
+
+
+
+
+
+int on181;
+# 10552 "nested_conditionals.c"
+int else181;
+
+
+
+
+
+
+int on182;
+# 10610 "nested_conditionals.c"
+int else182;
+
+
+
+
+
+
+int on183;
+# 10668 "nested_conditionals.c"
+int else183;
+
+
+
+
+
+
+int on184;
+# 10726 "nested_conditionals.c"
+int else184;
+
+
+
+
+
+
+int on185;
+# 10784 "nested_conditionals.c"
+int else185;
+
+
+
+
+
+
+int on186;
+# 10842 "nested_conditionals.c"
+int else186;
+
+
+
+
+
+
+int on187;
+# 10900 "nested_conditionals.c"
+int else187;
+
+
+
+
+
+
+int on188;
+# 10958 "nested_conditionals.c"
+int else188;
+
+
+
+
+
+
+int on189;
+# 11016 "nested_conditionals.c"
+int else189;
+
+
+
+
+
+
+int on190;
+# 11074 "nested_conditionals.c"
+int else190;
+
+
+
+
+
+
+int on191;
+# 11132 "nested_conditionals.c"
+int else191;
+
+
+
+
+
+
+int on192;
+# 11190 "nested_conditionals.c"
+int else192;
+
+
+
+
+
+
+int on193;
+# 11248 "nested_conditionals.c"
+int else193;
+
+
+
+
+
+
+int on194;
+# 11306 "nested_conditionals.c"
+int else194;
+
+
+
+
+
+
+int on195;
+# 11364 "nested_conditionals.c"
+int else195;
+
+
+
+
+
+
+int on196;
+# 11422 "nested_conditionals.c"
+int else196;
+
+
+
+
+
+
+int on197;
+# 11480 "nested_conditionals.c"
+int else197;
+
+
+
+
+
+
+int on198;
+# 11538 "nested_conditionals.c"
+int else198;
+
+
+
+
+
+
+int on199;
+# 11596 "nested_conditionals.c"
+int else199;
+
+
+
+
+
+
+int on200;
+# 11654 "nested_conditionals.c"
+int else200;
+
+
+
+
+
+
+int on201;
+# 11712 "nested_conditionals.c"
+int else201;
+
+
+
+
+
+
+int on202;
+# 11770 "nested_conditionals.c"
+int else202;
+
+
+
+
+
+
+int on203;
+# 11828 "nested_conditionals.c"
+int else203;
+
+
+
+
+
+
+int on204;
+# 11886 "nested_conditionals.c"
+int else204;
+
+
+
+
+
+
+int on205;
+# 11944 "nested_conditionals.c"
+int else205;
+
+
+
+
+
+
+int on206;
+# 12002 "nested_conditionals.c"
+int else206;
+
+
+
+
+
+
+int on207;
+# 12060 "nested_conditionals.c"
+int else207;
+
+
+
+
+
+
+int on208;
+# 12118 "nested_conditionals.c"
+int else208;
+
+
+
+
+
+
+int on209;
+# 12176 "nested_conditionals.c"
+int else209;
+
+
+
+
+
+
+int on210;
+# 12234 "nested_conditionals.c"
+int else210;
+
+
+
+
+
+
+int on211;
+# 12292 "nested_conditionals.c"
+int else211;
+
+
+
+
+
+
+int on212;
+# 12350 "nested_conditionals.c"
+int else212;
+
+
+
+
+
+
+int on213;
+# 12408 "nested_conditionals.c"
+int else213;
+
+
+
+
+
+
+int on214;
+# 12466 "nested_conditionals.c"
+int else214;
+
+
+
+
+
+
+int on215;
+# 12524 "nested_conditionals.c"
+int else215;
+
+
+
+
+
+
+int on216;
+# 12582 "nested_conditionals.c"
+int else216;
+
+
+
+
+
+
+int on217;
+# 12640 "nested_conditionals.c"
+int else217;
+
+
+
+
+
+
+int on218;
+# 12698 "nested_conditionals.c"
+int else218;
+
+
+
+
+
+
+int on219;
+# 12756 "nested_conditionals.c"
+int else219;
+
+
+
+
+
+
+int on220;
+# 12814 "nested_conditionals.c"
+int else220;
+
+
+
+
+
+
+int on221;
+# 12872 "nested_conditionals.c"
+int else221;
+
+
+
+
+
+
+int on222;
+# 12930 "nested_conditionals.c"
+int else222;
+
+
+
+
+
+
+int on223;
+# 12988 "nested_conditionals.c"
+int else223;
+
+
+
+
+
+
+int on224;
+# 13046 "nested_conditionals.c"
+int else224;
+
+
+
+
+
+
+int on225;
+# 13104 "nested_conditionals.c"
+int else225;
+
+
+
+
+
+
+int on226;
+# 13162 "nested_conditionals.c"
+int else226;
+
+
+
+
+
+
+int on227;
+# 13220 "nested_conditionals.c"
+int else227;
+
+
+
+
+
+
+int on228;
+# 13278 "nested_conditionals.c"
+int else228;
+
+
+
+
+
+
+int on229;
+# 13336 "nested_conditionals.c"
+int else229;
+
+
+
+
+
+
+int on230;
+# 13394 "nested_conditionals.c"
+int else230;
+
+
+
+
+
+
+int on231;
+# 13452 "nested_conditionals.c"
+int else231;
+
+
+
+
+
+
+int on232;
+# 13510 "nested_conditionals.c"
+int else232;
+
+
+
+
+
+
+int on233;
+# 13568 "nested_conditionals.c"
+int else233;
+
+
+
+
+
+
+int on234;
+# 13626 "nested_conditionals.c"
+int else234;
+
+
+
+
+
+
+int on235;
+# 13684 "nested_conditionals.c"
+int else235;
+
+
+
+
+
+
+int on236;
+# 13742 "nested_conditionals.c"
+int else236;
+
+
+
+
+
+
+int on237;
+# 13800 "nested_conditionals.c"
+int else237;
+
+
+
+
+
+
+int on238;
+# 13858 "nested_conditionals.c"
+int else238;
+
+
+
+
+
+
+int on239;
+# 13916 "nested_conditionals.c"
+int else239;
+
+
+
+
+
+
+int on240;
+# 13974 "nested_conditionals.c"
+int else240;
+
+
+
+
+
+
+int on241;
+# 14032 "nested_conditionals.c"
+int else241;
+
+
+
+
+
+
+int on242;
+# 14090 "nested_conditionals.c"
+int else242;
+
+
+
+
+
+
+int on243;
+# 14148 "nested_conditionals.c"
+int else243;
+
+
+
+
+
+
+int on244;
+# 14206 "nested_conditionals.c"
+int else244;
+
+
+
+
+
+
+int on245;
+# 14264 "nested_conditionals.c"
+int else245;
+
+
+
+
+
+
+int on246;
+# 14322 "nested_conditionals.c"
+int else246;
+
+
+
+
+
+
+int on247;
+# 14380 "nested_conditionals.c"
+int else247;
+
+
+
+
+
+
+int on248;
+# 14438 "nested_conditionals.c"
+int else248;
+
+
+
+
+
+
+int on249;
+# 14496 "nested_conditionals.c"
+int else249;
+
+
+
+
+
+
+int on250;
+# 14554 "nested_conditionals.c"
+int else250;
+
+
+
+
+
+
+int on251;
+# 14612 "nested_conditionals.c"
+int else251;
+
+
+
+
+
+
+int on252;
+# 14670 "nested_conditionals.c"
+int else252;
+
+
+
+
+
+
+int on253;
+# 14728 "nested_conditionals.c"
+int else253;
+
+
+
+
+
+
+int on254;
+# 14786 "nested_conditionals.c"
+int else254;
+
+
+
+
+
+
+int on255;
+# 14844 "nested_conditionals.c"
+int else255;
+
+
+
+
+
+
+int on256;
+# 14902 "nested_conditionals.c"
+int else256;
+
+
+
+
+
+
+int on257;
+# 14960 "nested_conditionals.c"
+int else257;
+
+
+
+
+
+
+int on258;
+# 15018 "nested_conditionals.c"
+int else258;
+
+
+
+
+
+
+int on259;
+# 15076 "nested_conditionals.c"
+int else259;
+
+
+
+
+
+
+int on260;
+# 15134 "nested_conditionals.c"
+int else260;
+
+
+
+
+
+
+int on261;
+# 15192 "nested_conditionals.c"
+int else261;
+
+
+
+
+
+
+int on262;
+# 15250 "nested_conditionals.c"
+int else262;
+
+
+
+
+
+
+int on263;
+# 15308 "nested_conditionals.c"
+int else263;
+
+
+
+
+
+
+int on264;
+# 15366 "nested_conditionals.c"
+int else264;
+
+
+
+
+
+
+int on265;
+# 15424 "nested_conditionals.c"
+int else265;
+
+
+
+
+
+
+int on266;
+# 15482 "nested_conditionals.c"
+int else266;
+
+
+
+
+
+
+int on267;
+# 15540 "nested_conditionals.c"
+int else267;
+
+
+
+
+
+
+int on268;
+# 15598 "nested_conditionals.c"
+int else268;
+
+
+
+
+
+
+int on269;
+# 15656 "nested_conditionals.c"
+int else269;
+
+
+
+
+
+
+int on270;
+# 15714 "nested_conditionals.c"
+int else270;
+
+
+
+
+
+
+int on271;
+# 15772 "nested_conditionals.c"
+int else271;
+
+
+
+
+
+
+int on272;
+# 15830 "nested_conditionals.c"
+int else272;
+
+
+
+
+
+
+int on273;
+# 15888 "nested_conditionals.c"
+int else273;
+
+
+
+
+
+
+int on274;
+# 15946 "nested_conditionals.c"
+int else274;
+
+
+
+
+
+
+int on275;
+# 16004 "nested_conditionals.c"
+int else275;
+
+
+
+
+
+
+int on276;
+# 16062 "nested_conditionals.c"
+int else276;
+
+
+
+
+
+
+int on277;
+# 16120 "nested_conditionals.c"
+int else277;
+
+
+
+
+
+
+int on278;
+# 16178 "nested_conditionals.c"
+int else278;
+
+
+
+
+
+
+int on279;
+# 16236 "nested_conditionals.c"
+int else279;
+
+
+
+
+
+
+int on280;
+# 16294 "nested_conditionals.c"
+int else280;
+
+
+
+
+
+
+int on281;
+# 16352 "nested_conditionals.c"
+int else281;
+
+
+
+
+
+
+int on282;
+# 16410 "nested_conditionals.c"
+int else282;
+
+
+
+
+
+
+int on283;
+# 16468 "nested_conditionals.c"
+int else283;
+
+
+
+
+
+
+int on284;
+# 16526 "nested_conditionals.c"
+int else284;
+
+
+
+
+
+
+int on285;
+# 16584 "nested_conditionals.c"
+int else285;
+
+
+
+
+
+
+int on286;
+# 16642 "nested_conditionals.c"
+int else286;
+
+
+
+
+
+
+int on287;
+# 16700 "nested_conditionals.c"
+int else287;
+
+
+
+
+
+
+int on288;
+# 16758 "nested_conditionals.c"
+int else288;
+
+
+
+
+
+
+int on289;
+# 16816 "nested_conditionals.c"
+int else289;
+
+
+
+
+
+
+int on290;
+# 16874 "nested_conditionals.c"
+int else290;
+
+
+
+
+
+
+int on291;
+# 16932 "nested_conditionals.c"
+int else291;
+
+
+
+
+
+
+int on292;
+# 16990 "nested_conditionals.c"
+int else292;
+
+
+
+
+
+
+int on293;
+# 17048 "nested_conditionals.c"
+int else293;
+
+
+
+
+
+
+int on294;
+# 17106 "nested_conditionals.c"
+int else294;
+
+
+
+
+
+
+int on295;
+# 17164 "nested_conditionals.c"
+int else295;
+
+
+
+
+
+
+int on296;
+# 17222 "nested_conditionals.c"
+int else296;
+
+
+
+
+
+
+int on297;
+# 17280 "nested_conditionals.c"
+int else297;
+
+
+
+
+
+
+int on298;
+# 17338 "nested_conditionals.c"
+int else298;
+
+
+
+
+
+
+int on299;
+# 17396 "nested_conditionals.c"
+int else299;
+
+
+
+
+
+
+int on300;
+# 17454 "nested_conditionals.c"
+int else300;
+
+
+
+
+
+
+int on301;
+# 17512 "nested_conditionals.c"
+int else301;
+
+
+
+
+
+
+int on302;
+# 17570 "nested_conditionals.c"
+int else302;
+
+
+
+
+
+
+int on303;
+# 17628 "nested_conditionals.c"
+int else303;
+
+
+
+
+
+
+int on304;
+# 17686 "nested_conditionals.c"
+int else304;
+
+
+
+
+
+
+int on305;
+# 17744 "nested_conditionals.c"
+int else305;
+
+
+
+
+
+
+int on306;
+# 17802 "nested_conditionals.c"
+int else306;
+
+
+
+
+
+
+int on307;
+# 17860 "nested_conditionals.c"
+int else307;
+
+
+
+
+
+
+int on308;
+# 17918 "nested_conditionals.c"
+int else308;
+
+
+
+
+
+
+int on309;
+# 17976 "nested_conditionals.c"
+int else309;
+
+
+
+
+
+
+int on310;
+# 18034 "nested_conditionals.c"
+int else310;
+
+
+
+
+
+
+int on311;
+# 18092 "nested_conditionals.c"
+int else311;
+
+
+
+
+
+
+int on312;
+# 18150 "nested_conditionals.c"
+int else312;
+
+
+
+
+
+
+int on313;
+# 18208 "nested_conditionals.c"
+int else313;
+
+
+
+
+
+
+int on314;
+# 18266 "nested_conditionals.c"
+int else314;
+
+
+
+
+
+
+int on315;
+# 18324 "nested_conditionals.c"
+int else315;
+
+
+
+
+
+
+int on316;
+# 18382 "nested_conditionals.c"
+int else316;
+
+
+
+
+
+
+int on317;
+# 18440 "nested_conditionals.c"
+int else317;
+
+
+
+
+
+
+int on318;
+# 18498 "nested_conditionals.c"
+int else318;
+
+
+
+
+
+
+int on319;
+# 18556 "nested_conditionals.c"
+int else319;
+
+
+
+
+
+
+int on320;
+# 18614 "nested_conditionals.c"
+int else320;
+
+
+
+
+
+
+int on321;
+# 18672 "nested_conditionals.c"
+int else321;
+
+
+
+
+
+
+int on322;
+# 18730 "nested_conditionals.c"
+int else322;
+
+
+
+
+
+
+int on323;
+# 18788 "nested_conditionals.c"
+int else323;
+
+
+
+
+
+
+int on324;
+# 18846 "nested_conditionals.c"
+int else324;
+
+
+
+
+
+
+int on325;
+# 18904 "nested_conditionals.c"
+int else325;
+
+
+
+
+
+
+int on326;
+# 18962 "nested_conditionals.c"
+int else326;
+
+
+
+
+
+
+int on327;
+# 19020 "nested_conditionals.c"
+int else327;
+
+
+
+
+
+
+int on328;
+# 19078 "nested_conditionals.c"
+int else328;
+
+
+
+
+
+
+int on329;
+# 19136 "nested_conditionals.c"
+int else329;
+
+
+
+
+
+
+int on330;
+# 19194 "nested_conditionals.c"
+int else330;
+
+
+
+
+
+
+int on331;
+# 19252 "nested_conditionals.c"
+int else331;
+
+
+
+
+
+
+int on332;
+# 19310 "nested_conditionals.c"
+int else332;
+
+
+
+
+
+
+int on333;
+# 19368 "nested_conditionals.c"
+int else333;
+
+
+
+
+
+
+int on334;
+# 19426 "nested_conditionals.c"
+int else334;
+
+
+
+
+
+
+int on335;
+# 19484 "nested_conditionals.c"
+int else335;
+
+
+
+
+
+
+int on336;
+# 19542 "nested_conditionals.c"
+int else336;
+
+
+
+
+
+
+int on337;
+# 19600 "nested_conditionals.c"
+int else337;
+
+
+
+
+
+
+int on338;
+# 19658 "nested_conditionals.c"
+int else338;
+
+
+
+
+
+
+int on339;
+# 19716 "nested_conditionals.c"
+int else339;
+
+
+
+
+
+
+int on340;
+# 19774 "nested_conditionals.c"
+int else340;
+
+
+
+
+
+
+int on341;
+# 19832 "nested_conditionals.c"
+int else341;
+
+
+
+
+
+
+int on342;
+# 19890 "nested_conditionals.c"
+int else342;
+
+
+
+
+
+
+int on343;
+# 19948 "nested_conditionals.c"
+int else343;
+
+
+
+
+
+
+int on344;
+# 20006 "nested_conditionals.c"
+int else344;
+
+
+
+
+
+
+int on345;
+# 20064 "nested_conditionals.c"
+int else345;
+
+
+
+
+
+
+int on346;
+# 20122 "nested_conditionals.c"
+int else346;
+
+
+
+
+
+
+int on347;
+# 20180 "nested_conditionals.c"
+int else347;
+
+
+
+
+
+
+int on348;
+# 20238 "nested_conditionals.c"
+int else348;
+
+
+
+
+
+
+int on349;
+# 20296 "nested_conditionals.c"
+int else349;
+
+
+
+
+
+
+int on350;
+# 20354 "nested_conditionals.c"
+int else350;
+
+
+
+
+
+
+int on351;
+# 20412 "nested_conditionals.c"
+int else351;
+
+
+
+
+
+
+int on352;
+# 20470 "nested_conditionals.c"
+int else352;
+
+
+
+
+
+
+int on353;
+# 20528 "nested_conditionals.c"
+int else353;
+
+
+
+
+
+
+int on354;
+# 20586 "nested_conditionals.c"
+int else354;
+
+
+
+
+
+
+int on355;
+# 20644 "nested_conditionals.c"
+int else355;
+
+
+
+
+
+
+int on356;
+# 20702 "nested_conditionals.c"
+int else356;
+
+
+
+
+
+
+int on357;
+# 20760 "nested_conditionals.c"
+int else357;
+
+
+
+
+
+
+int on358;
+# 20818 "nested_conditionals.c"
+int else358;
+
+
+
+
+
+
+int on359;
+# 20876 "nested_conditionals.c"
+int else359;
+
+
+
+
+
+
+int on360;
+# 20934 "nested_conditionals.c"
+int else360;
+
+
+
+
+
+
+int on361;
+# 20992 "nested_conditionals.c"
+int else361;
+
+
+
+
+
+
+int on362;
+# 21050 "nested_conditionals.c"
+int else362;
+
+
+
+
+
+
+int on363;
+# 21108 "nested_conditionals.c"
+int else363;
+
+
+
+
+
+
+int on364;
+# 21166 "nested_conditionals.c"
+int else364;
+
+
+
+
+
+
+int on365;
+# 21224 "nested_conditionals.c"
+int else365;
+
+
+
+
+
+
+int on366;
+# 21282 "nested_conditionals.c"
+int else366;
+
+
+
+
+
+
+int on367;
+# 21340 "nested_conditionals.c"
+int else367;
+
+
+
+
+
+
+int on368;
+# 21398 "nested_conditionals.c"
+int else368;
+
+
+
+
+
+
+int on369;
+# 21456 "nested_conditionals.c"
+int else369;
+
+
+
+
+
+
+int on370;
+# 21514 "nested_conditionals.c"
+int else370;
+
+
+
+
+
+
+int on371;
+# 21572 "nested_conditionals.c"
+int else371;
+
+
+
+
+
+
+int on372;
+# 21630 "nested_conditionals.c"
+int else372;
+
+
+
+
+
+
+int on373;
+# 21688 "nested_conditionals.c"
+int else373;
+
+
+
+
+
+
+int on374;
+# 21746 "nested_conditionals.c"
+int else374;
+
+
+
+
+
+
+int on375;
+# 21804 "nested_conditionals.c"
+int else375;
+
+
+
+
+
+
+int on376;
+# 21862 "nested_conditionals.c"
+int else376;
+
+
+
+
+
+
+int on377;
+# 21920 "nested_conditionals.c"
+int else377;
+
+
+
+
+
+
+int on378;
+# 21978 "nested_conditionals.c"
+int else378;
+
+
+
+
+
+
+int on379;
+# 22036 "nested_conditionals.c"
+int else379;
+
+
+
+
+
+
+int on380;
+# 22094 "nested_conditionals.c"
+int else380;
+
+
+
+
+
+
+int on381;
+# 22152 "nested_conditionals.c"
+int else381;
+
+
+
+
+
+
+int on382;
+# 22210 "nested_conditionals.c"
+int else382;
+
+
+
+
+
+
+int on383;
+# 22268 "nested_conditionals.c"
+int else383;
+
+
+
+
+
+
+int on384;
+# 22326 "nested_conditionals.c"
+int else384;
+
+
+
+
+
+
+int on385;
+# 22384 "nested_conditionals.c"
+int else385;
+
+
+
+
+
+
+int on386;
+# 22442 "nested_conditionals.c"
+int else386;
+
+
+
+
+
+
+int on387;
+# 22500 "nested_conditionals.c"
+int else387;
+
+
+
+
+
+
+int on388;
+# 22558 "nested_conditionals.c"
+int else388;
+
+
+
+
+
+
+int on389;
+# 22616 "nested_conditionals.c"
+int else389;
+
+
+
+
+
+
+int on390;
+# 22674 "nested_conditionals.c"
+int else390;
+
+
+
+
+
+
+int on391;
+# 22732 "nested_conditionals.c"
+int else391;
+
+
+
+
+
+
+int on392;
+# 22790 "nested_conditionals.c"
+int else392;
+
+
+
+
+
+
+int on393;
+# 22848 "nested_conditionals.c"
+int else393;
+
+
+
+
+
+
+int on394;
+# 22906 "nested_conditionals.c"
+int else394;
+
+
+
+
+
+
+int on395;
+# 22964 "nested_conditionals.c"
+int else395;
+
+
+
+
+
+
+int on396;
+# 23022 "nested_conditionals.c"
+int else396;
+
+
+
+
+
+
+int on397;
+# 23080 "nested_conditionals.c"
+int else397;
+
+
+
+
+
+
+int on398;
+# 23138 "nested_conditionals.c"
+int else398;
+
+
+
+
+
+
+int on399;
+# 23196 "nested_conditionals.c"
+int else399;
+
+
+
+
+
+
+int on400;
+# 23254 "nested_conditionals.c"
+int else400;
+
+
+
+
+
+
+int on401;
+# 23312 "nested_conditionals.c"
+int else401;
+
+
+
+
+
+
+int on402;
+# 23370 "nested_conditionals.c"
+int else402;
+
+
+
+
+
+
+int on403;
+# 23428 "nested_conditionals.c"
+int else403;
+
+
+
+
+
+
+int on404;
+# 23486 "nested_conditionals.c"
+int else404;
+
+
+
+
+
+
+int on405;
+# 23544 "nested_conditionals.c"
+int else405;
+
+
+
+
+
+
+int on406;
+# 23602 "nested_conditionals.c"
+int else406;
+
+
+
+
+
+
+int on407;
+# 23660 "nested_conditionals.c"
+int else407;
+
+
+
+
+
+
+int on408;
+# 23718 "nested_conditionals.c"
+int else408;
+
+
+
+
+
+
+int on409;
+# 23776 "nested_conditionals.c"
+int else409;
+
+
+
+
+
+
+int on410;
+# 23834 "nested_conditionals.c"
+int else410;
+
+
+
+
+
+
+int on411;
+# 23892 "nested_conditionals.c"
+int else411;
+
+
+
+
+
+
+int on412;
+# 23950 "nested_conditionals.c"
+int else412;
+
+
+
+
+
+
+int on413;
+# 24008 "nested_conditionals.c"
+int else413;
+
+
+
+
+
+
+int on414;
+# 24066 "nested_conditionals.c"
+int else414;
+
+
+
+
+
+
+int on415;
+# 24124 "nested_conditionals.c"
+int else415;
+
+
+
+
+
+
+int on416;
+# 24182 "nested_conditionals.c"
+int else416;
+
+
+
+
+
+
+int on417;
+# 24240 "nested_conditionals.c"
+int else417;
+
+
+
+
+
+
+int on418;
+# 24298 "nested_conditionals.c"
+int else418;
+
+
+
+
+
+
+int on419;
+# 24356 "nested_conditionals.c"
+int else419;
+
+
+
+
+
+
+int on420;
+# 24414 "nested_conditionals.c"
+int else420;
+
+
+
+
+
+
+int on421;
+# 24472 "nested_conditionals.c"
+int else421;
+
+
+
+
+
+
+int on422;
+# 24530 "nested_conditionals.c"
+int else422;
+
+
+
+
+
+
+int on423;
+# 24588 "nested_conditionals.c"
+int else423;
+
+
+
+
+
+
+int on424;
+# 24646 "nested_conditionals.c"
+int else424;
+
+
+
+
+
+
+int on425;
+# 24704 "nested_conditionals.c"
+int else425;
+
+
+
+
+
+
+int on426;
+# 24762 "nested_conditionals.c"
+int else426;
+
+
+
+
+
+
+int on427;
+# 24820 "nested_conditionals.c"
+int else427;
+
+
+
+
+
+
+int on428;
+# 24878 "nested_conditionals.c"
+int else428;
+
+
+
+
+
+
+int on429;
+# 24936 "nested_conditionals.c"
+int else429;
+
+
+
+
+
+
+int on430;
+# 24994 "nested_conditionals.c"
+int else430;
+
+
+
+
+
+
+int on431;
+# 25052 "nested_conditionals.c"
+int else431;
+
+
+
+
+
+
+int on432;
+# 25110 "nested_conditionals.c"
+int else432;
+
+
+
+
+
+
+int on433;
+# 25168 "nested_conditionals.c"
+int else433;
+
+
+
+
+
+
+int on434;
+# 25226 "nested_conditionals.c"
+int else434;
+
+
+
+
+
+
+int on435;
+# 25284 "nested_conditionals.c"
+int else435;
+
+
+
+
+
+
+int on436;
+# 25342 "nested_conditionals.c"
+int else436;
+
+
+
+
+
+
+int on437;
+# 25400 "nested_conditionals.c"
+int else437;
+
+
+
+
+
+
+int on438;
+# 25458 "nested_conditionals.c"
+int else438;
+
+
+
+
+
+
+int on439;
+# 25516 "nested_conditionals.c"
+int else439;
+
+
+
+
+
+
+int on440;
+# 25574 "nested_conditionals.c"
+int else440;
+
+
+
+
+
+
+int on441;
+# 25632 "nested_conditionals.c"
+int else441;
+
+
+
+
+
+
+int on442;
+# 25690 "nested_conditionals.c"
+int else442;
+
+
+
+
+
+
+int on443;
+# 25748 "nested_conditionals.c"
+int else443;
+
+
+
+
+
+
+int on444;
+# 25806 "nested_conditionals.c"
+int else444;
+
+
+
+
+
+
+int on445;
+# 25864 "nested_conditionals.c"
+int else445;
+
+
+
+
+
+
+int on446;
+# 25922 "nested_conditionals.c"
+int else446;
+
+
+
+
+
+
+int on447;
+# 25980 "nested_conditionals.c"
+int else447;
+
+
+
+
+
+
+int on448;
+# 26038 "nested_conditionals.c"
+int else448;
+
+
+
+
+
+
+int on449;
+# 26096 "nested_conditionals.c"
+int else449;
+
+
+
+
+
+
+int on450;
+# 26154 "nested_conditionals.c"
+int else450;
+
+
+
+
+
+
+int on451;
+# 26212 "nested_conditionals.c"
+int else451;
+
+
+
+
+
+
+int on452;
+# 26270 "nested_conditionals.c"
+int else452;
+
+
+
+
+
+
+int on453;
+# 26328 "nested_conditionals.c"
+int else453;
+
+
+
+
+
+
+int on454;
+# 26386 "nested_conditionals.c"
+int else454;
+
+
+
+
+
+
+int on455;
+# 26444 "nested_conditionals.c"
+int else455;
+
+
+
+
+
+
+int on456;
+# 26502 "nested_conditionals.c"
+int else456;
+
+
+
+
+
+
+int on457;
+# 26560 "nested_conditionals.c"
+int else457;
+
+
+
+
+
+
+int on458;
+# 26618 "nested_conditionals.c"
+int else458;
+
+
+
+
+
+
+int on459;
+# 26676 "nested_conditionals.c"
+int else459;
+
+
+
+
+
+
+int on460;
+# 26734 "nested_conditionals.c"
+int else460;
+
+
+
+
+
+
+int on461;
+# 26792 "nested_conditionals.c"
+int else461;
+
+
+
+
+
+
+int on462;
+# 26850 "nested_conditionals.c"
+int else462;
+
+
+
+
+
+
+int on463;
+# 26908 "nested_conditionals.c"
+int else463;
+
+
+
+
+
+
+int on464;
+# 26966 "nested_conditionals.c"
+int else464;
+
+
+
+
+
+
+int on465;
+# 27024 "nested_conditionals.c"
+int else465;
+
+
+
+
+
+
+int on466;
+# 27082 "nested_conditionals.c"
+int else466;
+
+
+
+
+
+
+int on467;
+# 27140 "nested_conditionals.c"
+int else467;
+
+
+
+
+
+
+int on468;
+# 27198 "nested_conditionals.c"
+int else468;
+
+
+
+
+
+
+int on469;
+# 27256 "nested_conditionals.c"
+int else469;
+
+
+
+
+
+
+int on470;
+# 27314 "nested_conditionals.c"
+int else470;
+
+
+
+
+
+
+int on471;
+# 27372 "nested_conditionals.c"
+int else471;
+
+
+
+
+
+
+int on472;
+# 27430 "nested_conditionals.c"
+int else472;
+
+
+
+
+
+
+int on473;
+# 27488 "nested_conditionals.c"
+int else473;
+
+
+
+
+
+
+int on474;
+# 27546 "nested_conditionals.c"
+int else474;
+
+
+
+
+
+
+int on475;
+# 27604 "nested_conditionals.c"
+int else475;
+
+
+
+
+
+
+int on476;
+# 27662 "nested_conditionals.c"
+int else476;
+
+
+
+
+
+
+int on477;
+# 27720 "nested_conditionals.c"
+int else477;
+
+
+
+
+
+
+int on478;
+# 27778 "nested_conditionals.c"
+int else478;
+
+
+
+
+
+
+int on479;
+# 27836 "nested_conditionals.c"
+int else479;
+
+
+
+
+
+
+int on480;
+# 27894 "nested_conditionals.c"
+int else480;
+
+
+
+
+
+
+int on481;
+# 27952 "nested_conditionals.c"
+int else481;
+
+
+
+
+
+
+int on482;
+# 28010 "nested_conditionals.c"
+int else482;
+
+
+
+
+
+
+int on483;
+# 28068 "nested_conditionals.c"
+int else483;
+
+
+
+
+
+
+int on484;
+# 28126 "nested_conditionals.c"
+int else484;
+
+
+
+
+
+
+int on485;
+# 28184 "nested_conditionals.c"
+int else485;
+
+
+
+
+
+
+int on486;
+# 28242 "nested_conditionals.c"
+int else486;
+
+
+
+
+
+
+int on487;
+# 28300 "nested_conditionals.c"
+int else487;
+
+
+
+
+
+
+int on488;
+# 28358 "nested_conditionals.c"
+int else488;
+
+
+
+
+
+
+int on489;
+# 28416 "nested_conditionals.c"
+int else489;
+
+
+
+
+
+
+int on490;
+# 28474 "nested_conditionals.c"
+int else490;
+
+
+
+
+
+
+int on491;
+# 28532 "nested_conditionals.c"
+int else491;
+
+
+
+
+
+
+int on492;
+# 28590 "nested_conditionals.c"
+int else492;
+
+
+
+
+
+
+int on493;
+# 28648 "nested_conditionals.c"
+int else493;
+
+
+
+
+
+
+int on494;
+# 28706 "nested_conditionals.c"
+int else494;
+
+
+
+
+
+
+int on495;
+# 28764 "nested_conditionals.c"
+int else495;
+
+
+
+
+
+
+int on496;
+# 28822 "nested_conditionals.c"
+int else496;
+
+
+
+
+
+
+int on497;
+# 28880 "nested_conditionals.c"
+int else497;
+
+
+
+
+
+
+int on498;
+# 28938 "nested_conditionals.c"
+int else498;
+
+
+
+
+
+
+int on499;
+# 28996 "nested_conditionals.c"
+int else499;
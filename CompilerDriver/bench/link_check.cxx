@@ -0,0 +1,446 @@
+/*
+ *	========================================================
+ *
+ *	link_check
+ * 	Copyright Amlal El Mahrouss, all rights reserved.
+ *
+ * 	========================================================
+ */
+
+/// @file link_check.cxx
+/// @brief Linker conformance harness.
+/// Generates small C units, builds them with cc and links them with ld, then
+/// checks what ld made of them.
+
+#include <C++Kit/Defines.hpp>
+#include <C++Kit/StdKit/PEF.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define kCheckVersion "MP-UX Linker Conformance Check v1.0, (c) Amlal El Mahrouss"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Check internal types.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace details
+{
+	struct check_case final
+	{
+		std::string fName;
+		std::function<bool(std::string& why)> fRun;
+	};
+}
+
+static std::string kCcPath = "bin/cc";
+static std::string kMasmPath = "bin/masm";
+static std::string kLdPath = "bin/ld";
+static std::string kWorkDir = "bin/link_cases";
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name check_run
+// @brief run a tool, what it prints goes to log.
+// @return exit status of the tool.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static int check_run(std::vector<std::string> args, const std::string& log)
+{
+	pid_t pid = fork();
+
+	if (pid < 0)
+		return -1;
+
+	if (pid == 0)
+	{
+		int fd = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+		if (fd >= 0)
+		{
+			dup2(fd, 1);
+			dup2(fd, 2);
+			close(fd);
+		}
+
+		std::vector<char*> argv;
+
+		for (auto& arg : args)
+			argv.push_back(arg.data());
+
+		argv.push_back(nullptr);
+
+		execv(argv[0], argv.data());
+		_exit(127);
+	}
+
+	int status = 0;
+
+	if (waitpid(pid, &status, 0) < 0)
+		return -1;
+
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static bool check_read(const std::string& path, std::string& contents)
+{
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file.is_open())
+		return false;
+
+	std::stringstream ss;
+	ss << file.rdbuf();
+	contents = ss.str();
+
+	return true;
+}
+
+/// @brief the body of function in a masm listing, between its begin and end.
+static std::string check_function(const std::string& listing, const std::string& function)
+{
+	auto at = listing.find("__export .text " + function + "\n");
+
+	if (at == std::string::npos)
+		return "";
+
+	auto end = listing.find("\nend", at);
+
+	return listing.substr(at, end == std::string::npos ? std::string::npos : end - at);
+}
+
+/// @brief builds a unit with cc -flto, its object is <stem>.o.
+static bool check_compile_lto(const std::string& source, const std::string& contents, std::string& why)
+{
+	std::ofstream(source, std::ios::binary) << contents;
+
+	if (check_run({ kCcPath, "--asm=masm", "--compiler=dolvik", "-flto", source }, source + ".log") != 0)
+	{
+		why = "cc failed on " + source;
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief builds a unit with cc and masm, its object is <stem>.o.
+static bool check_compile(const std::string& source, const std::string& contents, std::string& why)
+{
+	std::ofstream(source, std::ios::binary) << contents;
+
+	auto assembly = source.substr(0, source.rfind('.')) + ".masm";
+
+	if (check_run({ kCcPath, "--asm=masm", "--compiler=dolvik", source }, source + ".log") != 0 ||
+		check_run({ kMasmPath, assembly }, assembly + ".log") != 0)
+	{
+		why = "cc or masm failed on " + source;
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief the bytes of a PEF which end where the command header named name ends.
+static bool check_pef_bytes(const std::string& pef, const std::string& name, SizeType size, std::string& bytes)
+{
+	if (pef.size() < sizeof(CxxKit::PEFContainer))
+		return false;
+
+	auto container = reinterpret_cast<const CxxKit::PEFContainer*>(pef.data());
+	auto start = container->HdrSz + container->Count * sizeof(CxxKit::PEFCommandHeader);
+
+	if (start > pef.size())
+		return false;
+
+	for (SizeType index = 0; index < container->Count; ++index)
+	{
+		auto header = reinterpret_cast<const CxxKit::PEFCommandHeader*>(pef.data() + container->HdrSz +
+			index * sizeof(CxxKit::PEFCommandHeader));
+
+		if (std::string(header->Name, strnlen(header->Name, kPefNameLen)) != name)
+			continue;
+
+		if (header->Size < size ||
+			start + header->Size > pef.size())
+			return false;
+
+		bytes = pef.substr(start + header->Size - size, size);
+		return true;
+	}
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Cases, each one builds in its own directory.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief two -flto units with a static of the same name, each one keeps calling its own.
+static bool check_lto_statics(std::string& why)
+{
+	if (!check_compile_lto("a.c",
+			"static int helper() { return 11; }\n"
+			"int fb();\n"
+			"int fa() { return helper(); }\n"
+			"int __start() { return fa() + fb(); }\n", why) ||
+		!check_compile_lto("b.c",
+			"static int helper() { return 22; }\n"
+			"int fb() { return helper(); }\n", why))
+		return false;
+
+	if (check_run({ kLdPath, "-mrv64", "a.o", "b.o", "-o", "ab", "--lto-asm", "ab.masm" }, "ld.log") != 0)
+	{
+		why = "ld failed";
+		return false;
+	}
+
+	std::string listing;
+
+	if (!check_read("ab.masm", listing))
+	{
+		why = "no listing from --lto-asm";
+		return false;
+	}
+
+	auto fa = check_function(listing, "fa");
+	auto fb = check_function(listing, "fb");
+
+	if (fa.find("jlr __lto_0_helper") == std::string::npos ||
+		fb.find("jlr __lto_1_helper") == std::string::npos)
+	{
+		why = "fa and fb do not call the helper of their own unit";
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief two -flto units defining the same function, ld has to refuse them.
+static bool check_lto_duplicates(std::string& why)
+{
+	if (!check_compile_lto("a.c",
+			"int fa() { return 1; }\n"
+			"int __start() { return fa(); }\n", why) ||
+		!check_compile_lto("b.c",
+			"int fa() { return 2; }\n", why))
+		return false;
+
+	if (check_run({ kLdPath, "-mrv64", "a.o", "b.o", "-o", "ab" }, "ld.log") == 0)
+	{
+		why = "ld linked two definitions of fa";
+		return false;
+	}
+
+	std::string log;
+	check_read("ld.log", log);
+
+	if (log.find("multiple symbols of fa") == std::string::npos)
+	{
+		why = "ld did not report fa";
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief a pool record another object already brought in, in the middle of an object,
+/// the records after it still end on their own bytes.
+static bool check_pool_middle(std::string& why)
+{
+	if (!check_compile("b.c",
+			"int puts(char* s) { return 0; }\n"
+			"int fb() { puts(\"hello\"); return 0; }\n", why) ||
+		!check_compile("a.c",
+			"int puts(char* s);\n"
+			"int __start() { puts(\"hello\"); return 0; }\n"
+			"int kMarker = 0x11223344;\n", why))
+		return false;
+
+	// b.o first, the copy of the pool record of a.o is the one dropped.
+	if (check_run({ kLdPath, "-mrv64", "b.o", "a.o", "-o", "ba" }, "ld.log") != 0)
+	{
+		why = "ld failed";
+		return false;
+	}
+
+	std::string pef, marker;
+
+	if (!check_read("ba", pef) ||
+		!check_pef_bytes(pef, "$.data$kMarker", 8, marker))
+	{
+		why = "no kMarker record in the program";
+		return false;
+	}
+
+	if (marker != std::string("\x44\x33\x22\x11\0\0\0\0", 8))
+	{
+		why = "kMarker does not end on its own bytes";
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief two units with the same file name in other directories, each one with a loop
+/// and a static local, the labels and statics cc makes must not collide.
+static bool check_same_basename(std::string& why)
+{
+	std::filesystem::create_directories("d1");
+	std::filesystem::create_directories("d2");
+
+	if (!check_compile("d1/u.c",
+			"int fb();\n"
+			"int __start() { static int counter; int i; for (i = 0; i < 3; i = i + 1) counter = counter + 1; return counter + fb(); }\n", why) ||
+		!check_compile("d2/u.c",
+			"int fb() { static int counter; int i; for (i = 0; i < 3; i = i + 1) counter = counter + 1; return counter; }\n", why))
+		return false;
+
+	if (check_run({ kLdPath, "-mrv64", "d1/u.o", "d2/u.o", "-o", "u" }, "ld.log") != 0)
+	{
+		std::string log;
+		check_read("ld.log", log);
+
+		why = "ld failed: " + log.substr(0, log.find('\n'));
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief a mutual recursion at -O2, each function has the other one inlined, the
+/// result of the call left reaches the return through the exit of the inlined body.
+static bool check_tail_inlined(std::string& why)
+{
+	std::ofstream("oe.c", std::ios::binary) <<
+		"int even(int n);\n"
+		"int odd(int n) { if (n == 0) return 0; return even(n - 1); }\n"
+		"int even(int n) { if (n == 0) return 1; return odd(n - 1); }\n"
+		"int __start() { return even(100000); }\n";
+
+	if (check_run({ kCcPath, "--asm=masm", "--compiler=dolvik", "-O2", "oe.c" }, "oe.c.log") != 0 ||
+		check_run({ kMasmPath, "oe.masm" }, "oe.masm.log") != 0)
+	{
+		why = "cc or masm failed on oe.c";
+		return false;
+	}
+
+	std::string listing;
+	check_read("oe.masm", listing);
+
+	auto odd = check_function(listing, "odd");
+	auto even = check_function(listing, "even");
+
+	if (odd.find("jb odd") == std::string::npos ||
+		even.find("jb even") == std::string::npos ||
+		listing.find("jlr") != std::string::npos)
+	{
+		why = "the recursion through the inlined body is not a jump";
+		return false;
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name main
+// @brief check entrypoint.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+	for (auto index = 1; index < argc; ++index)
+	{
+		if (strcmp(argv[index], "-v") == 0 ||
+			strcmp(argv[index], "--version") == 0)
+		{
+			printf("%s\n", kCheckVersion);
+			return 0;
+		}
+
+		if (strcmp(argv[index], "-h") == 0 ||
+			strcmp(argv[index], "--help") == 0)
+		{
+			printf("%s\n", kCheckVersion);
+			printf("%s\n", "--cc: C compiler to build the cases with.");
+			printf("%s\n", "--masm: assembler to build the cases with.");
+			printf("%s\n", "--ld: linker to check.");
+			printf("%s\n", "--work: directory where the cases are built.");
+
+			return 0;
+		}
+
+		if (index + 1 >= argc)
+		{
+			std::cerr << "link_check: missing argument for " << argv[index] << "\n";
+			return 1;
+		}
+
+		if (strcmp(argv[index], "--cc") == 0)
+			kCcPath = argv[++index];
+		else if (strcmp(argv[index], "--masm") == 0)
+			kMasmPath = argv[++index];
+		else if (strcmp(argv[index], "--ld") == 0)
+			kLdPath = argv[++index];
+		else if (strcmp(argv[index], "--work") == 0)
+			kWorkDir = argv[++index];
+		else
+		{
+			std::cerr << "link_check: unknown option " << argv[index] << "\n";
+			return 1;
+		}
+	}
+
+	kCcPath = std::filesystem::absolute(kCcPath).string();
+	kMasmPath = std::filesystem::absolute(kMasmPath).string();
+	kLdPath = std::filesystem::absolute(kLdPath).string();
+	kWorkDir = std::filesystem::absolute(kWorkDir).string();
+
+	std::vector<details::check_case> cases = {
+		{ "lto_statics", check_lto_statics },
+		{ "lto_duplicates", check_lto_duplicates },
+		{ "pool_middle", check_pool_middle },
+		{ "same_basename", check_same_basename },
+		{ "tail_inlined", check_tail_inlined },
+	};
+
+	Int32 failures = 0;
+
+	for (auto& check : cases)
+	{
+		auto dir = kWorkDir + "/" + check.fName;
+
+		std::filesystem::remove_all(dir);
+		std::filesystem::create_directories(dir);
+		std::filesystem::current_path(dir);
+
+		std::string why;
+
+		if (check.fRun(why))
+		{
+			printf("%-22s ok\n", check.fName.c_str());
+		}
+		else
+		{
+			printf("%-22s FAIL (%s)\n", check.fName.c_str(), why.c_str());
+			++failures;
+		}
+	}
+
+	return failures == 0 ? 0 : 1;
+}
@@ -10,9 +10,23 @@
 #include <cstdio>
 #include <vector>
 #include <string>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <atomic>
 #include <fstream>
+#include <filesystem>
 #include <iostream>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <C++Kit/AsmKit/Arch/NewCPU.hpp>
+#include <C++Kit/AsmKit/Module.hpp>
+#include <C++Kit/AsmKit/SSA.hpp>
+#include <C++Kit/StdKit/Arena.hpp>
+#include <C++Kit/StdKit/PEF.hpp>
+#include <C++Kit/StdKit/Report.hpp>
 #include <C++Kit/ParserKit.hpp>
 
 #define kOk 0
@@ -30,6 +44,7 @@
 #define kBlank "\e[0;30m"
 #define kRed "\e[0;31m"
 #define kWhite "\e[0;97m"
+#define kYellow "\e[0;33m"
 
 /////////////////////////////////////
 
@@ -39,20 +54,17 @@
 
 namespace detail
 {
-    struct CompilerRegisterMap
-    {
-        std::string fName;
-        std::string fRegister;
-    };
-
     struct CompilerState
     {
-        std::vector<ParserKit::SyntaxLeafList> fSyntaxTreeList;
-        std::vector<CompilerRegisterMap> kStackFrame;
-        ParserKit::SyntaxLeafList* fSyntaxTree{ nullptr };
+        std::vector<CxxKit::AsmLine> fAssembly;
+        CxxKit::IRModule fModule;
         std::unique_ptr<std::ofstream> fOutputAssembly;
+        std::vector<std::string> fFileNames;
+        std::string fUnitName;
         std::string fLastFile;
         std::string fLastError;
+        std::string fSourceFile;
+        SizeType fSourceLine{ 0 };
         bool kVerbose;
     };
 }
@@ -60,15 +72,43 @@ namespace detail
 static detail::CompilerState kState;
 static SizeType kErrorLimit = 100;
 
+/// @brief -O level, 0 lowers the IR as generated.
+static Int32 kOptimizationLevel = 0;
+
+/// @brief -j, threads lowering functions, 1 lowers them in order on the main thread.
+static SizeType kJobs = 1;
+
+/// @brief -finline-limit=, largest function inlined at -O1 and up, in IR instructions.
+/// Functions declared inline may be kIRInlineHint times as large, 0 inlines nothing.
+static SizeType kInlineLimit = 16;
+
+/// @brief -funroll-loops, copies of a small inner loop's body run per trip at -O2, 0 unrolls nothing.
+static SizeType kUnrollFactor = 0;
+
+#define kUnrollDefault 4 // -funroll-loops without a factor.
+
+// @brief switch lowering, up to kSwitchLinear cases are compared one by one, from
+// kSwitchTable cases spanning at most kSwitchDensity values per case take a jump table,
+// anything else is split in two halves around its middle case.
+#define kSwitchLinear  3
+#define kSwitchTable   4
+#define kSwitchDensity 3
+
 static Int32 kAcceptableErrors = 0;
 
+/// @brief -Wpadded, report the padding of each struct laid out.
+static bool kWarnPadded = false;
+
 namespace detail
 {
-    void print_error(std::string reason, std::string file) noexcept
+    void print_error(std::string reason, std::string file, SizeType line = 0) noexcept
     {
         if (reason[0] == '\n')
             reason.erase(0, 1);
 
+        if (line > 0)
+            reason = "line " + std::to_string(line) + ", " + reason;
+
         if (file.find(".pp") != std::string::npos)
         {
             file.erase(file.find(".pp"), 3);
@@ -92,10 +132,334 @@ namespace detail
         ++kAcceptableErrors;
     }
 
+    /// @brief as print_error, but neither counted nor fatal.
+    void print_warning(std::string reason, std::string file, SizeType line = 0) noexcept
+    {
+        if (line > 0)
+            reason = "line " + std::to_string(line) + ", " + reason;
+
+        if (file.find(".pp") != std::string::npos)
+            file.erase(file.find(".pp"), 3);
+
+        std::cout << kYellow << "[ cc ] [ " << file << " ] " << kWhite << "warning: " << reason << kBlank << std::endl;
+    }
+
+    /// @brief reads a '# <line> "<file>"' marker left by cpp.
+    /// @return true if the line was a marker.
+    bool read_line_marker(const std::string& line) noexcept
+    {
+        if (line.size() < 3 ||
+            line[0] != '#' ||
+            line[1] != ' ' ||
+            !isdigit(line[2]))
+            return false;
+
+        auto first_quote = line.find('"');
+        auto last_quote = line.rfind('"');
+
+        if (first_quote == std::string::npos ||
+            first_quote == last_quote)
+            return false;
+
+        // the marker names the line that comes right after it.
+        kState.fSourceLine = std::strtoul(line.c_str() + 2, nullptr, 10) - 1;
+        kState.fSourceFile = line.substr(first_quote + 1, last_quote - first_quote - 1);
+
+        return true;
+    }
+
+    /// @brief index of a file name in kState.fFileNames, tokens refer to files by index.
+    Int32 file_index(const std::string& file) noexcept
+    {
+        for (SizeType i = 0; i < kState.fFileNames.size(); ++i)
+        {
+            if (kState.fFileNames[i] == file)
+                return i;
+        }
+
+        kState.fFileNames.push_back(file);
+        return kState.fFileNames.size() - 1;
+    }
+
+    /// @brief tag of a translation unit, a 64-bit FNV-1a hash of its full path and of its source.
+    /// Compiler made symbols (labels, static locals) carry it, two units with the same
+    /// file name in other directories get other tags.
+    std::string unit_name(const std::string& file, const std::string& source) noexcept
+    {
+        std::error_code error;
+        auto path = std::filesystem::weakly_canonical(std::filesystem::absolute(file, error), error).string();
+
+        if (error)
+            path = file;
+
+        UInt64 hash = 14695981039346656037ULL;
+
+        auto mix = [&](const std::string& bytes) {
+            for (auto ch : bytes)
+            {
+                hash ^= (UInt8)ch;
+                hash *= 1099511628211ULL;
+            }
+        };
+
+        mix(path);
+        mix(std::string(1, '\0'));
+        mix(source);
+
+        char name[24] = { 0 };
+        snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash);
+
+        return name;
+    }
+
+    /// @brief constant pool symbol of some bytes, the same in every unit that has them.
+    std::string pool_symbol(const std::vector<UInt8>& bytes) noexcept
+    {
+        UInt64 hash = 14695981039346656037ULL;
+
+        for (auto byte : bytes)
+        {
+            hash ^= byte;
+            hash *= 1099511628211ULL;
+        }
+
+        char name[24] = { 0 };
+        snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash);
+
+        return kAEPoolPrefix + std::to_string(bytes.size()) + "_" + name;
+    }
+
+    /// @brief a compiler made symbol, scope is the index of the function it belongs to.
+    std::string local_symbol(SizeType scope, const std::string& name) noexcept
+    {
+        return "__cc_" + kState.fUnitName + "_" + std::to_string(scope) + "_" + name;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Tokens, types, symbols and the typed syntax tree of the C front-end.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+    enum
+    {
+        kTokenEof,
+        kTokenIdentifier,
+        kTokenKeyword,
+        kTokenNumber,
+        kTokenFloat,
+        kTokenString,
+        kTokenPunct,
+    };
+
+    struct CompilerToken final
+    {
+        Int32 fKind{ kTokenEof };
+        std::string_view fText; // interned
+        UInt64 fValue{ 0 };
+        SizeType fLine{ 0 };
+        Int32 fFile{ 0 };
+    };
+
+    enum
+    {
+        kTypeVoid,
+        kTypeBool,
+        kTypeChar,
+        kTypeShort,
+        kTypeInt,
+        kTypeLong,
+        kTypeFloat,
+        kTypeDouble,
+        kTypeEnum,
+        kTypePointer,
+        kTypeArray,
+        kTypeFunction,
+        kTypeStruct,
+        kTypeUnion,
+    };
+
+    struct CompilerRecordInfo;
+
+    /// @brief a C type, fBase is the pointee, element or return type.
+    struct CompilerDataType final
+    {
+        Int32 fKind{ kTypeInt };
+        bool fUnsigned{ false };
+        bool fComplete{ true };
+        CompilerDataType* fBase{ nullptr };
+        SizeType fCount{ 0 };
+        CompilerRecordInfo* fRecord{ nullptr };
+        std::vector<CompilerDataType*> fParams;
+        std::vector<std::string_view> fParamNames;
+        bool fVariadic{ false };
+        bool fPrototype{ true };
+    };
+
+    struct CompilerField final
+    {
+        std::string_view fName; // interned
+        CompilerDataType* fType{ nullptr };
+        SizeType fOffset{ 0 };
+    };
+
+    /// @brief struct, union or enum tag.
+    struct CompilerRecordInfo final
+    {
+        std::string fTag;
+        Int32 fKind{ kTypeStruct };
+        bool fComplete{ false };
+        std::vector<CompilerField> fFields;
+        SizeType fSize{ 0 };
+        SizeType fAlign{ 1 };
+    };
+
+    /// @brief builtin type keywords, fValue is the matching MASM data word.
     struct CompilerType
     {
         std::string fName;
         std::string fValue;
+        Int32 fKind{ kTypeInt };
+    };
+
+    enum
+    {
+        kSymbolVariable,
+        kSymbolFunction,
+        kSymbolTypedef,
+        kSymbolConstant,
+    };
+
+    enum
+    {
+        kStorageGlobal,
+        kStorageLocal,
+        kStorageParam,
+    };
+
+    struct CompilerSymbol final
+    {
+        std::string_view fName; // interned
+        std::string fAsmName;
+        Int32 fKind{ kSymbolVariable };
+        Int32 fStorage{ kStorageGlobal };
+        CompilerDataType* fType{ nullptr };
+        Int64 fValue{ 0 };
+        SizeType fOffset{ 0 };
+        SizeType fIndex{ 0 }; // definition order of a function in its translation unit.
+        bool fDefined{ false };
+        bool fInitialized{ false };
+        bool fStatic{ false };
+        bool fExtern{ false };
+        bool fInline{ false };
+    };
+
+    enum
+    {
+        // expressions
+        kNodeNumber,
+        kNodeString,
+        kNodeVariable,
+        kNodeUnary,
+        kNodeBinary,
+        kNodeLogical,
+        kNodeAssign,
+        kNodeIncrement,
+        kNodeTernary,
+        kNodeCall,
+        kNodeMember,
+        kNodeCast,
+        kNodeComma,
+        kNodeAddress,
+        kNodeDeref,
+        kNodeInitList,
+
+        // statements
+        kNodeBlock,
+        kNodeDeclaration,
+        kNodeExpression,
+        kNodeIf,
+        kNodeWhile,
+        kNodeDoWhile,
+        kNodeFor,
+        kNodeReturn,
+        kNodeBreak,
+        kNodeContinue,
+        kNodeSwitch,
+        kNodeCase,    // fValue: fChildren[0]
+        kNodeDefault, // default: fChildren[0]
+        kNodeEmpty,
+
+        // top level
+        kNodeFunction,
+        kNodeGlobal,
+    };
+
+    enum
+    {
+        kOpNone,
+        kOpAdd,
+        kOpSub,
+        kOpMul,
+        kOpDiv,
+        kOpMod,
+        kOpAnd,
+        kOpOr,
+        kOpXor,
+        kOpShl,
+        kOpShr,
+        kOpEq,
+        kOpNe,
+        kOpLt,
+        kOpGt,
+        kOpLe,
+        kOpGe,
+        kOpLogicalAnd,
+        kOpLogicalOr,
+        kOpNeg,
+        kOpNot,
+        kOpLogicalNot,
+        kOpPlus,
+    };
+
+    /// @brief node of the typed syntax tree.
+    /// Expressions carry their C type in fType, declarations their symbol in fSymbol.
+    struct CompilerNode final
+    {
+        Int32 fKind{ kNodeEmpty };
+        Int32 fOp{ kOpNone };
+        CompilerDataType* fType{ nullptr };
+        CompilerSymbol* fSymbol{ nullptr };
+        CompilerField* fField{ nullptr };
+        Int64 fValue{ 0 };
+        std::string_view fText; // interned
+        std::vector<CompilerNode*> fChildren;
+        SizeType fLine{ 0 };
+        Int32 fFile{ 0 };
+    };
+
+    struct CompilerDeclSpec final
+    {
+        CompilerDataType* fType{ nullptr };
+        bool fTypedef{ false };
+        bool fStatic{ false };
+        bool fExtern{ false };
+        bool fInline{ false };
+    };
+
+    /// @brief the labels of a switch being parsed.
+    struct CompilerSwitch final
+    {
+        std::unordered_set<Int64> fCases;
+        bool fDefault{ false };
+    };
+
+    /// @brief thrown by the parser after reporting a syntax error, to resynchronize.
+    struct CompilerParseError final
+    {
     };
 }
 
@@ -104,18 +468,41 @@ namespace detail
 // Target architecture.
 static int kMachine = 0;
 
+/// @brief --emit-obj assembles in process, -S keeps the MASM text as well.
+static bool kEmitObject = false;
+static bool kEmitAssembly = false;
+
+/// @brief -flto, the object holds the IR of the unit and its data, ld optimizes and lowers them.
+static bool kLinkTimeOptimization = false;
+
+/// @brief arch of the AE header, -marc as with masm.
+static CharType kObjectArch = CxxKit::kPefArchRISCV;
+
+/// @brief -ftime-report and -fmem-report, printed on stderr after each file, as JSON with =json.
+static bool kTimeReport = false;
+static bool kMemReport = false;
+static bool kReportJson = false;
+static CxxKit::CompileReport kReport;
+
+/// @brief the report phases are timed in, none unless asked for.
+static CxxKit::CompileReport* cc_report()
+{
+    return kTimeReport || kMemReport ? &kReport : nullptr;
+}
+
 /////////////////////////////////////////
 
 // REGISTERS ACCORDING TO USED ASSEMBLER
 
 /////////////////////////////////////////
 
-static size_t kRegisterCnt = kAsmRegisterLimit;
-static size_t kStartUsable = 1;
-static size_t kUsableLimit = 14;
-static size_t kRegisterCounter = kStartUsable;
+static size_t kStartUsable = kIRFirstUsable;
+static size_t kUsableLimit = kIRLastUsable;
 static std::string kRegisterPrefix = kAsmRegisterPrefix;
 
+/// @brief size of a stack slot and of a machine word.
+#define kWordSize kIRWordSize
+
 /////////////////////////////////////////
 
 // COMPILER PARSING UTILITIES/STATES.
@@ -124,11 +511,6 @@ static std::string kRegisterPrefix = kAsmRegisterPrefix;
 
 static std::vector<std::string> kFileList;
 static CxxKit::AssemblyFactory kFactory;
-static bool kInStruct = false;
-static bool kOnWhileLoop = false;
-static bool kOnForLoop = false;
-static bool kInBraces = false;
-static size_t kBracesCount = 0UL;
 
 /* @brief C compiler backend for Amlal El Mahrouss C */
 class CompilerBackendClang final : public ParserKit::CompilerBackend
@@ -139,7 +521,6 @@ public:
 
     CXXKIT_COPY_DEFAULT(CompilerBackendClang);
 
-    std::string Check(const char* text, const char* file);
     void Compile(const char* text, const char* file) override;
 
     const char* Language() override { return "C"; }
@@ -147,1452 +528,4499 @@ public:
 };
 
 static CompilerBackendClang* kCompilerBackend = nullptr;
-static std::vector<detail::CompilerType> kCompilerVariables;
-static std::vector<std::string>          kCompilerFunctions;
-static std::vector<detail::CompilerType> kCompilerTypes;
 
-// @brief this hook code before the begin/end command.
-static std::string kAddIfAnyBegin;
-static std::string kAddIfAnyEnd;
-static std::string kLatestVar;
+using CompilerScope = std::unordered_map<std::string_view, detail::CompilerSymbol*>;
 
-static std::string cc_parse_function_call(std::string& _text)
-{
-    if (_text[0] == '(') {
-        std::string substr;
-        std::string args_buffer;
-        std::string args;
-
-        bool type_crossed = false;
+// @brief builtin types, ordinary identifiers (one table per open scope, innermost last) and tags.
+static std::unordered_map<std::string_view, detail::CompilerType>   kCompilerTypes;
+static std::vector<CompilerScope>                                   kCompilerScopes;
+static std::vector<detail::CompilerSymbol*>                         kCompilerFunctions;
+static std::unordered_map<std::string, detail::CompilerRecordInfo*> kCompilerRecords;
 
-        for (char substr_first_index: _text)
-        {
-            args_buffer += substr_first_index;
+// @brief owner of everything the tree points to, and of the token texts,
+// released at once per translation unit.
+static CxxKit::Arena      kArena;
+static CxxKit::InternPool kIdentifiers(kArena);
 
-            if (substr_first_index == ';')
-            {
-                args_buffer = args_buffer.erase(0, args_buffer.find('('));
-                args_buffer = args_buffer.erase(args_buffer.find(';'), 1);
-                args_buffer = args_buffer.erase(args_buffer.find(')'), 1);
-                args_buffer = args_buffer.erase(args_buffer.find('('), 1);
+/// @brief symbols made in this translation unit.
+static SizeType kSymbolCount = 0;
 
-                if (!args_buffer.empty())
-                    args += "\tpsh ";
+/////////////////////////////////////////////////////////////////////////////////////////
 
-                while (args_buffer.find(',') != std::string::npos)
-                {
-                    args_buffer.replace(args_buffer.find(','), 1, "\n\tpsh ");
-                }
+// @brief Type helpers.
+// Scalars take one 8 byte word, except char and bool which take a byte.
 
-                args += args_buffer;
-                args += "\n\tjlr __import ";
-            }
-        }
+/////////////////////////////////////////////////////////////////////////////////////////
 
-        return args;
-    }
+static detail::CompilerDataType* cc_new_type(Int32 kind)
+{
+    auto type = kArena.New<detail::CompilerDataType>();
+    type->fKind = kind;
 
-    return "";
+    return type;
 }
 
-#include <uuid/uuid.h>
-
-namespace detail
+static detail::CompilerDataType* cc_builtin_type(Int32 kind, bool is_unsigned = false)
 {
-    union number_type
-    {
-        number_type(UInt64 raw)
-                : raw(raw)
-        {}
+    static detail::CompilerDataType kBuiltins[2][detail::kTypeEnum + 1];
 
-        char number[8];
-        UInt64 raw;
-    };
-}
+    auto type = &kBuiltins[is_unsigned][kind];
 
-/////////////////////////////////////////////////////////////////////////////////////////
+    type->fKind = kind;
+    type->fUnsigned = is_unsigned;
 
-// @name Compile
-// @brief Generate MASM from a C source.
+    return type;
+}
 
-/////////////////////////////////////////////////////////////////////////////////////////
+static detail::CompilerDataType* cc_pointer_to(detail::CompilerDataType* base)
+{
+    auto type = cc_new_type(detail::kTypePointer);
+    type->fBase = base;
+
+    return type;
+}
 
-void CompilerBackendClang::Compile(const char* text, const char* file)
+static detail::CompilerDataType* cc_array_of(detail::CompilerDataType* base, SizeType count, bool complete)
 {
-    std::string _text = text;
+    auto type = cc_new_type(detail::kTypeArray);
 
-    auto syntax_tree = ParserKit::SyntaxLeafList::SyntaxLeaf();
-    bool type_found = false;
-    bool function_found = false;
+    type->fBase = base;
+    type->fCount = count;
+    type->fComplete = complete;
 
-    // start parsing
-    for (size_t text_index = 0; text_index < _text.size(); ++text_index)
-    {
-        uuid_t out{0};
+    return type;
+}
 
-        uuid_generate_random(out);
-        detail::number_type time_off = (UInt64)out;
+static bool cc_is_integer(detail::CompilerDataType* type)
+{
+    return (type->fKind >= detail::kTypeBool &&
+        type->fKind <= detail::kTypeLong) ||
+        type->fKind == detail::kTypeEnum;
+}
 
-        if (!type_found)
-        {
-            auto substr = _text.substr(text_index);
-            std::string match_type;
+static bool cc_is_float(detail::CompilerDataType* type)
+{
+    return type->fKind == detail::kTypeFloat ||
+        type->fKind == detail::kTypeDouble;
+}
 
-            for (size_t y = 0; y < substr.size(); ++y)
-            {
-                if (substr[y] == ' ')
-                {
-                    while (match_type.find(' ') != std::string::npos) {
-                        match_type.erase(match_type.find(' '));
-                    }
+static bool cc_is_pointer(detail::CompilerDataType* type)
+{
+    return type->fKind == detail::kTypePointer;
+}
 
-                    for (auto& clType : kCompilerTypes)
-                    {
-                        if (clType.fName == match_type)
-                        {
-                            match_type.clear();
-
-                            std::string buf;
-
-                            buf += clType.fValue;
-                            buf += ' ';
-
-                            if (clType.fName == "struct" ||
-                                clType.fName == "union")
-                            {
-                                for (size_t a = y + 1; a < substr.size(); a++)
-                                {
-                                    if (substr[a] == ' ')
-                                    {
-                                        break;
-                                    }
-
-                                    if (substr[a] == '\n')
-                                        break;
-
-                                    buf += substr[a];
-                                }
-                            }
-
-                            if (substr.find('=') != std::string::npos)
-                            {
-                                break;
-                            }
-
-                            if (_text.find('(') != std::string::npos)
-                            {
-                                syntax_tree.fUserValue = buf;
-
-                                kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-                            }
-
-                            type_found = true;
-                            break;
-                        }
-                    }
+static bool cc_is_record(detail::CompilerDataType* type)
+{
+    return type->fKind == detail::kTypeStruct ||
+        type->fKind == detail::kTypeUnion;
+}
 
-                    break;
-                }
+static bool cc_is_scalar(detail::CompilerDataType* type)
+{
+    return cc_is_integer(type) ||
+        cc_is_float(type) ||
+        cc_is_pointer(type);
+}
 
-                match_type += substr[y];
-            }
-        }
+/// @brief arrays and functions used as values become pointers.
+static detail::CompilerDataType* cc_decay(detail::CompilerDataType* type)
+{
+    if (type->fKind == detail::kTypeArray)
+        return cc_pointer_to(type->fBase);
 
-        if (_text[text_index] == '{')
-        {
-            if (kInStruct)
-            {
-                continue;
-            }
+    if (type->fKind == detail::kTypeFunction)
+        return cc_pointer_to(type);
 
-            kInBraces = true;
-            ++kBracesCount;
+    return type;
+}
 
-            if (kOnWhileLoop ||
-                kOnForLoop)
-            {
-                syntax_tree.fUserValue = "void __export .text _L";
-                syntax_tree.fUserValue += std::to_string(kBracesCount) + "_" + std::to_string(time_off.raw);
-                syntax_tree.fUserValue += "\nbegin";
-            }
-            else
-            {
-                syntax_tree.fUserValue = "begin\n";
-                syntax_tree.fUserValue += kAddIfAnyBegin;
-            }
+static SizeType cc_round_up(SizeType size, SizeType align)
+{
+    return (size + align - 1) / align * align;
+}
 
-            kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-        }
+static SizeType cc_round_word(SizeType size)
+{
+    return cc_round_up(size, kWordSize);
+}
 
-        // return keyword handler
-        if (_text[text_index] == 'r')
-        {
-            std::string return_keyword;
-            return_keyword += "return";
+static SizeType cc_type_size(detail::CompilerDataType* type)
+{
+    switch (type->fKind)
+    {
+    case detail::kTypeVoid:
+    case detail::kTypeBool:
+    case detail::kTypeChar:
+        return 1;
+    case detail::kTypeArray:
+        return type->fCount * cc_type_size(type->fBase);
+    case detail::kTypeFunction:
+        return 1;
+    case detail::kTypeStruct:
+    case detail::kTypeUnion:
+        return type->fRecord ? type->fRecord->fSize : 0;
+    default:
+        return kWordSize;
+    }
+}
 
-            std::size_t index = 0UL;
+/// @brief NewCPU loads bytes and words only, so a scalar is as aligned as it is large.
+static SizeType cc_type_align(detail::CompilerDataType* type)
+{
+    switch (type->fKind)
+    {
+    case detail::kTypeVoid:
+    case detail::kTypeBool:
+    case detail::kTypeChar:
+    case detail::kTypeFunction:
+        return 1;
+    case detail::kTypeArray:
+        return cc_type_align(type->fBase);
+    case detail::kTypeStruct:
+    case detail::kTypeUnion:
+        return type->fRecord ? type->fRecord->fAlign : 1;
+    default:
+        return kWordSize;
+    }
+}
 
-            std::string value;
+static bool cc_is_complete(detail::CompilerDataType* type)
+{
+    if (type->fKind == detail::kTypeVoid)
+        return false;
 
-            for (size_t return_index = text_index; return_index < _text.size(); ++return_index)
-            {
-                if (_text[return_index] != return_keyword[index])
-                {
-                    for (size_t value_index = return_index; value_index < _text.size(); ++value_index)
-                    {
-                        if (_text[value_index] == ';')
-                            break;
+    if (type->fKind == detail::kTypeArray)
+        return type->fComplete && cc_is_complete(type->fBase);
 
-                        value += _text[value_index];
-                    }
+    if (cc_is_record(type))
+        return type->fRecord && type->fRecord->fComplete;
 
-                    break;
-                }
+    return true;
+}
 
-                ++index;
-            }
+/// @brief size of the object a pointer steps over, void* steps by one byte.
+static SizeType cc_element_size(detail::CompilerDataType* pointer)
+{
+    auto size = cc_type_size(pointer->fBase);
+    return size > 0 ? size : 1;
+}
 
-            if (index == return_keyword.size())
-            {
-                if (!value.empty())
-                {
-                    if (value.find('(') != std::string::npos)
-                    {
-                        value.erase(value.find('('));
-                    }
+/// @brief usual arithmetic conversions, every integer is promoted to a word.
+static detail::CompilerDataType* cc_common_type(detail::CompilerDataType* lhs, detail::CompilerDataType* rhs)
+{
+    if (cc_is_float(lhs) || cc_is_float(rhs))
+        return cc_builtin_type(detail::kTypeDouble);
 
-                    if (!isdigit(value[value.find('(') + 2]))
-                    {
-                        std::string tmp = value;
+    bool is_unsigned = lhs->fUnsigned || rhs->fUnsigned;
 
-                        value.clear();
-                        value += " __import";
-                        value += tmp;
-                    }
-                    
-                    syntax_tree.fUserValue = "\tldw r31, ";
+    if (lhs->fKind == detail::kTypeLong ||
+        rhs->fKind == detail::kTypeLong)
+        return cc_builtin_type(detail::kTypeLong, is_unsigned);
 
-                    // make it pretty.
-                    if (value.find('\t') != std::string::npos)
-                        value.erase(value.find('\t'), 1);
+    return cc_builtin_type(detail::kTypeInt, is_unsigned);
+}
 
-                    syntax_tree.fUserValue += value + "\n";
-                }
+/// @brief each field at the first offset its alignment allows, in declaration order.
+/// The record is as aligned as its most aligned field, and its size a multiple of that,
+/// so that every element of an array of it is aligned too.
+static void cc_layout_record(detail::CompilerRecordInfo* record)
+{
+    SizeType size = 0;
+    SizeType align = 1;
 
-                syntax_tree.fUserValue += "\tjlr r31";
+    for (auto& field : record->fFields)
+    {
+        auto field_size = cc_type_size(field.fType);
+        auto field_align = cc_type_align(field.fType);
 
-                kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
+        align = std::max(align, field_align);
 
-                break;
-            }
+        if (record->fKind == detail::kTypeUnion)
+        {
+            field.fOffset = 0;
+            size = std::max(size, field_size);
         }
-
-        if (_text[text_index] == 'i' &&
-            _text[text_index + 1] == 'f')
+        else
         {
-            std::string format = "ldw r15, %s\nldw r16, %s2\n";
-            std::string expr = format;
+            field.fOffset = cc_round_up(size, field_align);
+            size = field.fOffset + field_size;
+        }
+    }
 
-            if (ParserKit::find_word(_text, "=="))
-            {
-                expr += "\nbeq";
-            }
-            
-            if (ParserKit::find_word(_text, "!="))
-            {
-                expr += "\nbneq";
-            }
-            
-            if (ParserKit::find_word(_text, ">="))
-            {
-                expr += "\nbge";
-            }
-            else if (ParserKit::find_word(_text, ">"))
-            {
-                expr += "\nbg";
-            }
+    record->fSize = cc_round_up(size, align);
+    record->fAlign = align;
+    record->fComplete = true;
+}
 
-            if (ParserKit::find_word(_text, "<="))
-            {
-                expr += "\nble";
-            }
-            else if (ParserKit::find_word(_text, "<"))
-            {
-                expr += "\nbl";
-            }
+/// @brief -Wpadded, where a struct holds padding, and the size it would have with
+/// its fields from the most to the least aligned, if that is smaller.
+static void cc_report_padding(detail::CompilerRecordInfo* record, const std::string& file, SizeType line)
+{
+    if (record->fKind != detail::kTypeStruct)
+        return;
 
-            std::string substr = expr;
+    auto name = "struct " + (record->fTag.empty() ? std::string("<anonymous>") : record->fTag);
+    SizeType end = 0;
 
-            std::string buf;
+    for (auto& field : record->fFields)
+    {
+        if (field.fOffset > end)
+            detail::print_warning(std::to_string(field.fOffset - end) + " bytes of padding before '" +
+                                  std::string(field.fName) + "' in " + name + ".", file, line);
 
-            for (size_t text_index_2 = (_text.find("if") + std::string("if").size()); text_index_2 < _text.size(); ++text_index_2)
-            {
-                if (_text[text_index_2] == ';')
-                {
-                    buf.clear();
+        end = field.fOffset + cc_type_size(field.fType);
+    }
 
-                    for (size_t text_index_3 = text_index_2 + 1; text_index_3 < _text.size(); text_index_3++)
-                    {
-                        if (_text[text_index_3] == '{')
-                            continue;
+    if (record->fSize > end)
+        detail::print_warning(std::to_string(record->fSize - end) + " bytes of padding at the end of " + name + ".", file, line);
 
-                        if (_text[text_index_3] == '}')
-                            continue;
+    auto sorted = record->fFields;
 
-                        if (_text[text_index_3] == ' ')
-                            continue;
+    std::stable_sort(sorted.begin(), sorted.end(), [](const detail::CompilerField& lhs, const detail::CompilerField& rhs) {
+        return cc_type_align(lhs.fType) > cc_type_align(rhs.fType);
+    });
 
-                        if (_text[text_index_3] == '=')
-                            continue;
+    SizeType size = 0;
 
-                        if (_text[text_index_3] == '<' &&
-                            _text[text_index_3+1] == '=' ||
-                            _text[text_index_3] == '=' &&
-                            _text[text_index_3+1] == '=' ||
-                            _text[text_index_3] == '>' &&
-                            _text[text_index_3+1] == '=' ||
-                            _text[text_index_3] == '>' ||
-                            _text[text_index_3] == '<' &&
-                            _text[text_index_3+1] == '=' ||
-                            _text[text_index_3] == '!')
-                        {
-                            buf += ", ";
-                            continue;
-                        }
-                        else if (_text[text_index_3] == '=')
-                        {
-                            continue;
-                        }
+    for (auto& field : sorted)
+        size = cc_round_up(size, cc_type_align(field.fType)) + cc_type_size(field.fType);
 
-                        buf += _text[text_index_3];
-                    }
+    size = cc_round_up(size, record->fAlign);
 
-                    break;
-                }
+    if (size >= record->fSize)
+        return;
 
-                if (_text[text_index_2] == '{')
-                    continue;
+    std::string order;
 
-                if (_text[text_index_2] == '}')
-                    continue;
+    for (auto& field : sorted)
+        order += (order.empty() ? "" : ", ") + std::string(field.fName);
 
-                if (_text[text_index_2] == '<' &&
-                    _text[text_index_2+1] == '=' ||
-                    _text[text_index_2] == '=' &&
-                    _text[text_index_2+1] == '=' ||
-                    _text[text_index_2] == '>' &&
-                    _text[text_index_2+1] == '=' ||
-                    _text[text_index_2] == '>' ||
-                    _text[text_index_2] == '<' &&
-                    _text[text_index_2+1] == '=' ||
-                    _text[text_index_2] == '!')
-                {
-                    buf += ", ";
-                    continue;
-                }
-                else if (_text[text_index_2] == '=')
-                {
-                    continue;
-                }
+    detail::print_warning(name + " takes " + std::to_string(record->fSize) + " bytes, " + std::to_string(size) +
+                          " with its fields in this order: " + order + ".", file, line);
+}
 
-                buf += _text[text_index_2];
-            }
+/////////////////////////////////////////////////////////////////////////////////////////
 
-            if (buf.find(",") == std::string::npos &&
-                buf.find("(") != std::string::npos &&
-                buf.find(")") != std::string::npos )
+// @brief Symbol tables.
+// Each open scope has a hash table, keyed by views of the fName of the symbols
+// it holds, so closing a scope drops every name declared inside it.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void cc_push_scope()
+{
+    kCompilerScopes.emplace_back();
+}
+
+static void cc_pop_scope()
+{
+    kCompilerScopes.pop_back();
+}
+
+static detail::CompilerSymbol* cc_new_symbol(std::string_view name, Int32 kind)
+{
+    auto symbol = kArena.New<detail::CompilerSymbol>();
+
+    symbol->fName = name;
+    symbol->fAsmName = name;
+    symbol->fKind = kind;
+
+    ++kSymbolCount;
+
+    return symbol;
+}
+
+/// @brief declare symbol in the innermost scope, or in the file scope when asked to.
+static void cc_add_symbol(detail::CompilerSymbol* symbol, bool file_scope = false)
+{
+    auto& scope = file_scope ? kCompilerScopes.front() : kCompilerScopes.back();
+    scope[symbol->fName] = symbol;
+}
+
+static detail::CompilerSymbol* cc_find_symbol(std::string_view name)
+{
+    for (auto scope = kCompilerScopes.rbegin(); scope != kCompilerScopes.rend(); ++scope)
+    {
+        if (auto it = scope->find(name); it != scope->end())
+            return it->second;
+    }
+
+    return nullptr;
+}
+
+static detail::CompilerSymbol* cc_find_in_scope(std::string_view name)
+{
+    auto it = kCompilerScopes.back().find(name);
+    return it != kCompilerScopes.back().end() ? it->second : nullptr;
+}
+
+/// @brief tags of each kind have a namespace of their own.
+static std::string cc_record_key(const std::string& tag, Int32 kind)
+{
+    return std::to_string(kind) + ":" + tag;
+}
+
+static void cc_add_record(detail::CompilerRecordInfo* record)
+{
+    if (!record->fTag.empty())
+        kCompilerRecords[cc_record_key(record->fTag, record->fKind)] = record;
+}
+
+static detail::CompilerRecordInfo* cc_find_record(const std::string& tag, Int32 kind)
+{
+    auto it = kCompilerRecords.find(cc_record_key(tag, kind));
+    return it != kCompilerRecords.end() ? it->second : nullptr;
+}
+
+static const detail::CompilerType* cc_find_builtin(std::string_view name)
+{
+    auto it = kCompilerTypes.find(name);
+    return it != kCompilerTypes.end() ? &it->second : nullptr;
+}
+
+/// @brief forget everything about the previous translation unit.
+static void cc_reset_unit()
+{
+    kCompilerFunctions.clear();
+    kCompilerRecords.clear();
+    kCompilerScopes.clear();
+
+    kIdentifiers.Reset();
+    kArena.Reset();
+
+    kSymbolCount = 0;
+
+    // the file scope.
+    cc_push_scope();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Constant expressions, used by array sizes, enumerators and initializers.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool cc_eval_constant(detail::CompilerNode* node, Int64& value)
+{
+    Int64 lhs = 0, rhs = 0;
+
+    switch (node->fKind)
+    {
+    case detail::kNodeNumber:
+    {
+        if (cc_is_float(node->fType))
+            return false;
+
+        value = node->fValue;
+        return true;
+    }
+    case detail::kNodeCast:
+    {
+        if (!cc_eval_constant(node->fChildren[0], lhs))
+            return false;
+
+        if (node->fType->fKind == detail::kTypeBool)
+            lhs = lhs != 0;
+        else if (node->fType->fKind == detail::kTypeChar)
+            lhs = node->fType->fUnsigned ? (UInt8)lhs : (Int8)lhs;
+
+        value = lhs;
+        return true;
+    }
+    case detail::kNodeUnary:
+    {
+        if (!cc_eval_constant(node->fChildren[0], lhs))
+            return false;
+
+        switch (node->fOp)
+        {
+        case detail::kOpNeg: value = -lhs; break;
+        case detail::kOpNot: value = ~lhs; break;
+        case detail::kOpLogicalNot: value = !lhs; break;
+        default: value = lhs; break;
+        }
+
+        return true;
+    }
+    case detail::kNodeTernary:
+    {
+        if (!cc_eval_constant(node->fChildren[0], lhs))
+            return false;
+
+        return cc_eval_constant(node->fChildren[lhs ? 1 : 2], value);
+    }
+    case detail::kNodeLogical:
+    case detail::kNodeBinary:
+    {
+        if (!cc_eval_constant(node->fChildren[0], lhs) ||
+            !cc_eval_constant(node->fChildren[1], rhs))
+            return false;
+
+        switch (node->fOp)
+        {
+        case detail::kOpAdd: value = lhs + rhs; break;
+        case detail::kOpSub: value = lhs - rhs; break;
+        case detail::kOpMul: value = lhs * rhs; break;
+        case detail::kOpDiv:
+        case detail::kOpMod:
+        {
+            if (rhs == 0)
+                return false;
+
+            value = node->fOp == detail::kOpDiv ? lhs / rhs : lhs % rhs;
+            break;
+        }
+        case detail::kOpAnd: value = lhs & rhs; break;
+        case detail::kOpOr: value = lhs | rhs; break;
+        case detail::kOpXor: value = lhs ^ rhs; break;
+        case detail::kOpShl: value = lhs << rhs; break;
+        case detail::kOpShr: value = lhs >> rhs; break;
+        case detail::kOpEq: value = lhs == rhs; break;
+        case detail::kOpNe: value = lhs != rhs; break;
+        case detail::kOpLt: value = lhs < rhs; break;
+        case detail::kOpGt: value = lhs > rhs; break;
+        case detail::kOpLe: value = lhs <= rhs; break;
+        case detail::kOpGe: value = lhs >= rhs; break;
+        case detail::kOpLogicalAnd: value = lhs && rhs; break;
+        case detail::kOpLogicalOr: value = lhs || rhs; break;
+        default: return false;
+        }
+
+        return true;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+
+/// @brief the address of a global, a function or a string literal, base is set to the node naming it.
+static bool cc_address_constant(detail::CompilerNode* init, detail::CompilerNode*& base)
+{
+    switch (init->fKind)
+    {
+    case detail::kNodeString:
+    {
+        base = init;
+        return true;
+    }
+    case detail::kNodeCast:
+    {
+        return cc_address_constant(init->fChildren[0], base);
+    }
+    case detail::kNodeAddress:
+    {
+        auto operand = init->fChildren[0];
+
+        if (operand->fKind != detail::kNodeVariable ||
+            operand->fSymbol->fStorage != detail::kStorageGlobal)
+            return false;
+
+        base = operand;
+        return true;
+    }
+    case detail::kNodeVariable:
+    {
+        if (init->fSymbol->fStorage != detail::kStorageGlobal ||
+            (init->fType->fKind != detail::kTypeArray && init->fType->fKind != detail::kTypeFunction))
+            return false;
+
+        base = init;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name cc_lex
+// @brief Split a preprocessed translation unit into tokens, in a single pass.
+// cpp line markers move the position tokens are reported at.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::unordered_set<std::string_view> kKeywords = {
+    "auto", "break", "case", "char", "const", "continue", "default", "do",
+    "double", "else", "enum", "extern", "float", "for", "goto", "if",
+    "inline", "int", "long", "register", "restrict", "return", "short",
+    "signed", "sizeof", "static", "struct", "switch", "typedef", "union",
+    "unsigned", "void", "volatile", "while", "_Bool", "bool",
+};
+
+static const char* kPunctuators[] = {
+    "...", "<<=", ">>=", "->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=",
+    "&&", "||", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=",
+};
+
+static char cc_lex_escape(const std::string& text, SizeType& i)
+{
+    char ch = text[i++];
+
+    if (ch != '\\' ||
+        i >= text.size())
+        return ch;
+
+    ch = text[i++];
+
+    switch (ch)
+    {
+    case 'n': return '\n';
+    case 't': return '\t';
+    case 'r': return '\r';
+    case 'a': return '\a';
+    case 'b': return '\b';
+    case 'f': return '\f';
+    case 'v': return '\v';
+    case 'e': return '\e';
+    case 'x':
+    {
+        Int32 value = 0;
+
+        while (i < text.size() &&
+               isxdigit(text[i]))
+        {
+            value = value * 16 + (isdigit(text[i]) ? text[i] - '0' : tolower(text[i]) - 'a' + 10);
+            ++i;
+        }
+
+        return (char)value;
+    }
+    default:
+    {
+        if (ch >= '0' && ch <= '7')
+        {
+            Int32 value = ch - '0';
+
+            for (Int32 digits = 1; digits < 3 && i < text.size() && text[i] >= '0' && text[i] <= '7'; ++digits)
+                value = value * 8 + (text[i++] - '0');
+
+            return (char)value;
+        }
+
+        return ch;
+    }
+    }
+}
+
+static bool cc_lex(const std::string& text, std::vector<detail::CompilerToken>& tokens)
+{
+    SizeType line = 1;
+    Int32 file = detail::file_index(kState.fSourceFile);
+    bool line_start = true;
+    bool ok = true;
+
+    auto error = [&](const std::string& reason) {
+        detail::print_error(reason, kState.fFileNames[file], line);
+        ok = false;
+    };
+
+    for (SizeType i = 0; i < text.size();)
+    {
+        char ch = text[i];
+
+        if (ch == '\n')
+        {
+            ++line;
+            line_start = true;
+            ++i;
+
+            continue;
+        }
+
+        if (isspace(ch))
+        {
+            ++i;
+            continue;
+        }
+
+        // line markers, and directives cpp let through.
+        if (ch == '#' &&
+            line_start)
+        {
+            auto eol = text.find('\n', i);
+
+            if (eol == std::string::npos)
+                eol = text.size();
+
+            if (detail::read_line_marker(text.substr(i, eol - i)))
+            {
+                line = kState.fSourceLine;
+                file = detail::file_index(kState.fSourceFile);
+            }
+
+            i = eol;
+            continue;
+        }
+
+        line_start = false;
+
+        if (ch == '/' &&
+            i + 1 < text.size() &&
+            text[i + 1] == '/')
+        {
+            i = text.find('\n', i);
+
+            if (i == std::string::npos)
+                i = text.size();
+
+            continue;
+        }
+
+        if (ch == '/' &&
+            i + 1 < text.size() &&
+            text[i + 1] == '*')
+        {
+            auto end = text.find("*/", i + 2);
+
+            if (end == std::string::npos)
+            {
+                error("Unterminated comment.");
+                break;
+            }
+
+            line += std::count(text.begin() + i, text.begin() + end, '\n');
+            i = end + 2;
+
+            continue;
+        }
+
+        detail::CompilerToken tok;
+
+        tok.fLine = line;
+        tok.fFile = file;
+
+        if (isalpha(ch) ||
+            ch == '_')
+        {
+            auto start = i;
+
+            while (i < text.size() &&
+                   (isalnum(text[i]) || text[i] == '_'))
+                ++i;
+
+            tok.fText = kIdentifiers.Intern(std::string_view(text).substr(start, i - start));
+            tok.fKind = kKeywords.count(tok.fText) ? detail::kTokenKeyword : detail::kTokenIdentifier;
+
+            tokens.push_back(std::move(tok));
+            continue;
+        }
+
+        if (isdigit(ch) ||
+            (ch == '.' && i + 1 < text.size() && isdigit(text[i + 1])))
+        {
+            auto start = i;
+            bool is_hex = ch == '0' && i + 1 < text.size() && tolower(text[i + 1]) == 'x';
+            bool is_float = false;
+
+            while (i < text.size() &&
+                   (isalnum(text[i]) || text[i] == '.' ||
+                   ((text[i] == '+' || text[i] == '-') && !is_hex && tolower(text[i - 1]) == 'e')))
+            {
+                if (text[i] == '.' ||
+                    (!is_hex && tolower(text[i]) == 'e'))
+                    is_float = true;
+
+                ++i;
+            }
+
+            tok.fText = kIdentifiers.Intern(std::string_view(text).substr(start, i - start));
+
+            if (is_float)
+            {
+                tok.fKind = detail::kTokenFloat;
+            }
+            else
+            {
+                tok.fKind = detail::kTokenNumber;
+
+                if (tok.fText.size() > 2 &&
+                    tok.fText[0] == '0' &&
+                    tolower(tok.fText[1]) == 'b')
+                    tok.fValue = std::strtoull(tok.fText.data() + 2, nullptr, 2);
+                else
+                    tok.fValue = std::strtoull(tok.fText.data(), nullptr, 0);
+            }
+
+            tokens.push_back(std::move(tok));
+            continue;
+        }
+
+        if (ch == '\'')
+        {
+            ++i;
+
+            if (i >= text.size() ||
+                text[i] == '\'' ||
+                text[i] == '\n')
+            {
+                error("Empty character constant.");
+                continue;
+            }
+
+            tok.fKind = detail::kTokenNumber;
+            tok.fValue = (UInt8)cc_lex_escape(text, i);
+
+            if (i >= text.size() ||
+                text[i] != '\'')
             {
+                error("Missing terminating '.");
+                continue;
+            }
+
+            ++i;
+
+            tokens.push_back(std::move(tok));
+            continue;
+        }
+
+        if (ch == '"')
+        {
+            ++i;
+
+            tok.fKind = detail::kTokenString;
 
-                std::string cond = buf.substr(buf.find("(") + 1, buf.find(")") - 1);
-                cond.erase(cond.find("("));
+            std::string bytes;
 
-                std::string cond2 = buf.substr(buf.find("(") + 1, buf.find(")") - 1);
-                cond2.erase(cond2.find(")"));
+            while (i < text.size() &&
+                   text[i] != '"' &&
+                   text[i] != '\n')
+                bytes += cc_lex_escape(text, i);
 
-                substr.replace(substr.find("%s"), 2, cond);
-                substr.replace(substr.find("%s2"), 3, cond2);
+            tok.fText = kIdentifiers.Intern(bytes);
 
-                buf.replace(buf.find(cond), cond.size(), "r15");
-                buf.replace(buf.find(cond2), cond2.size(), "r16");
+            if (i >= text.size() ||
+                text[i] != '"')
+            {
+                error("Missing terminating \".");
+                continue;
+            }
 
-                substr += buf;
+            ++i;
 
-                syntax_tree.fUserValue = substr + "\n";
+            tokens.push_back(std::move(tok));
+            continue;
+        }
 
-                kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
+        tok.fKind = detail::kTokenPunct;
 
+        for (auto punct : kPunctuators)
+        {
+            if (text.compare(i, strlen(punct), punct) == 0)
+            {
+                tok.fText = punct;
                 break;
             }
+        }
+
+        if (tok.fText.empty())
+        {
+            if (strchr("()[]{}.,;:?~!+-*/%&|^<>=", ch) == nullptr)
+            {
+                error(std::string("Forbidden character detected: ") + ch);
+
+                ++i;
+                continue;
+            }
+
+            tok.fText = kIdentifiers.Intern(std::string_view(text).substr(i, 1));
+        }
+
+        i += tok.fText.size();
+        tokens.push_back(std::move(tok));
+    }
+
+    detail::CompilerToken eof;
+
+    eof.fLine = line;
+    eof.fFile = file;
+
+    tokens.push_back(eof);
+
+    return ok;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Recursive-descent parser, builds the typed syntax tree.
+// Names are resolved and expression types computed as the tree is built.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+    class CompilerParser final
+    {
+    public:
+        explicit CompilerParser(std::vector<CompilerToken>& tokens)
+            : fTokens(tokens)
+        {}
+
+        ~CompilerParser() = default;
+
+        CXXKIT_COPY_DELETE(CompilerParser);
+
+        std::vector<CompilerNode*> ParseTranslationUnit();
+
+    private:
+        const CompilerToken& Peek(SizeType ahead = 0);
+        const CompilerToken& Next();
+        bool Is(const char* text, SizeType ahead = 0);
+        bool Accept(const char* text);
+        void Expect(const char* text);
+        [[noreturn]] void Error(const CompilerToken& tok, const std::string& reason);
+        void Synchronize();
+
+        CompilerNode* NewNode(Int32 kind, const CompilerToken& tok);
+
+        bool IsTypeName(SizeType ahead = 0);
+        bool ParseDeclSpec(CompilerDeclSpec& spec);
+        CompilerDataType* ParseRecord();
+        CompilerDataType* ParseEnum();
+        CompilerDataType* ParseDeclarator(CompilerDataType* base, const CompilerToken** name);
+        CompilerDataType* ParseSuffix(CompilerDataType* base);
+        CompilerDataType* ParseTypeName();
+        Int64 ParseConstant();
+
+        void ParseExternal(std::vector<CompilerNode*>& unit);
+        CompilerSymbol* DeclareFunction(const CompilerToken& name, CompilerDataType* type, CompilerDeclSpec& spec);
+        CompilerSymbol* DeclareGlobal(const CompilerToken& name, CompilerDataType* type, CompilerDeclSpec& spec);
+        CompilerNode* ParseFunction(CompilerSymbol* function, const CompilerToken& name);
+        CompilerNode* ParseInitializer();
+        CompilerDataType* CompleteArray(CompilerDataType* type, CompilerNode* init);
+
+        CompilerNode* ParseBlock(bool new_scope);
+        void ParseLocalDeclaration(std::vector<CompilerNode*>& block);
+        CompilerNode* ParseStatement();
+
+        CompilerNode* ParseExpression();
+        CompilerNode* ParseAssignment();
+        CompilerNode* ParseConditional();
+        CompilerNode* ParseBinary(Int32 min_precedence);
+        CompilerNode* ParseCast();
+        CompilerNode* ParseUnary();
+        CompilerNode* ParsePostfix();
+        CompilerNode* ParsePrimary();
+
+        CompilerNode* MakeBinary(Int32 op, CompilerNode* lhs, CompilerNode* rhs, const CompilerToken& tok);
+        CompilerNode* MakeCall(CompilerNode* callee, std::vector<CompilerNode*>& args, const CompilerToken& tok);
+        CompilerNode* MakeMember(CompilerNode* base, bool arrow, const CompilerToken& tok);
+        void CheckLvalue(CompilerNode* node, const CompilerToken& tok);
+        void CheckScalar(CompilerNode* node, const CompilerToken& tok);
+
+    private:
+        std::vector<CompilerToken>& fTokens;
+        SizeType fPos{ 0 };
+        SizeType fErrorPos{ 0 }; // the token of the last error.
+        CompilerSymbol* fFunction{ nullptr };
+        Int32 fLoopDepth{ 0 };
+        std::vector<CompilerSwitch> fSwitches;
+        std::vector<CompilerNode*> fStatics;
+        SizeType fStaticCount{ 0 };
+        SizeType fDefinitions{ 0 };
+
+    };
+
+    const CompilerToken& CompilerParser::Peek(SizeType ahead)
+    {
+        return fTokens[std::min(fPos + ahead, fTokens.size() - 1)];
+    }
+
+    const CompilerToken& CompilerParser::Next()
+    {
+        auto& tok = fTokens[fPos];
+
+        if (fPos + 1 < fTokens.size())
+            ++fPos;
+
+        return tok;
+    }
+
+    bool CompilerParser::Is(const char* text, SizeType ahead)
+    {
+        auto& tok = Peek(ahead);
+
+        return (tok.fKind == kTokenPunct || tok.fKind == kTokenKeyword) &&
+            tok.fText == text;
+    }
+
+    bool CompilerParser::Accept(const char* text)
+    {
+        if (!Is(text))
+            return false;
+
+        Next();
+        return true;
+    }
+
+    void CompilerParser::Expect(const char* text)
+    {
+        if (Accept(text))
+            return;
+
+        auto& tok = Peek();
+
+        Error(tok, std::string("Missing '") + text + "', here -> " +
+            (tok.fKind == kTokenEof ? "end of file" : std::string(tok.fText)));
+    }
+
+    void CompilerParser::Error(const CompilerToken& tok, const std::string& reason)
+    {
+        detail::print_error(reason, kState.fFileNames[tok.fFile], tok.fLine);
+
+        fErrorPos = &tok >= fTokens.data() && &tok < fTokens.data() + fTokens.size() ? &tok - fTokens.data() : fPos;
+        throw CompilerParseError();
+    }
+
+    /// @brief skip to the end of the broken statement or declaration.
+    void CompilerParser::Synchronize()
+    {
+        SizeType depth = 0;
+
+        // a ';' the error is on, read already, ends the broken statement, not the next one.
+        if (fErrorPos < fPos &&
+            fTokens[fErrorPos].fText == ";")
+            fPos = fErrorPos;
+
+        while (Peek().fKind != kTokenEof)
+        {
+            if (Is(";") &&
+                depth == 0)
+            {
+                Next();
+                return;
+            }
+
+            if (Is("{"))
+            {
+                ++depth;
+            }
+            else if (Is("}"))
+            {
+                if (depth == 0)
+                    return;
+
+                --depth;
+
+                if (depth == 0)
+                {
+                    Next();
+                    return;
+                }
+            }
+
+            Next();
+        }
+    }
+
+    CompilerNode* CompilerParser::NewNode(Int32 kind, const CompilerToken& tok)
+    {
+        auto node = kArena.New<CompilerNode>();
+
+        node->fKind = kind;
+        node->fLine = tok.fLine;
+        node->fFile = tok.fFile;
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    // @brief Declarations.
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CompilerParser::IsTypeName(SizeType ahead)
+    {
+        static const std::unordered_set<std::string_view> kSpecifiers = {
+            "typedef", "static", "extern", "inline", "const", "volatile", "register",
+            "auto", "restrict", "unsigned", "signed", "short", "long", "struct",
+            "union", "enum",
+        };
+
+        auto& tok = Peek(ahead);
+
+        if (tok.fKind == kTokenKeyword)
+            return kSpecifiers.count(tok.fText) || cc_find_builtin(tok.fText);
+
+        if (tok.fKind == kTokenIdentifier)
+        {
+            auto symbol = cc_find_symbol(tok.fText);
+            return symbol && symbol->fKind == kSymbolTypedef;
+        }
+
+        return false;
+    }
+
+    bool CompilerParser::ParseDeclSpec(CompilerDeclSpec& spec)
+    {
+        bool any = false;
+        bool is_unsigned = false;
+        bool is_short = false;
+        Int32 longs = 0;
+        Int32 kind = -1;
+
+        CompilerDataType* type = nullptr;
+
+        while (true)
+        {
+            auto& tok = Peek();
+
+            if (tok.fKind == kTokenKeyword)
+            {
+                if (tok.fText == "typedef")
+                    spec.fTypedef = true;
+                else if (tok.fText == "static")
+                    spec.fStatic = true;
+                else if (tok.fText == "extern")
+                    spec.fExtern = true;
+                else if (tok.fText == "inline")
+                    spec.fInline = true;
+                else if (tok.fText == "unsigned")
+                    is_unsigned = true;
+                else if (tok.fText == "short")
+                    is_short = true;
+                else if (tok.fText == "long")
+                    ++longs;
+                else if (tok.fText == "struct" ||
+                         tok.fText == "union")
+                {
+                    type = ParseRecord();
+                    any = true;
+
+                    continue;
+                }
+                else if (tok.fText == "enum")
+                {
+                    type = ParseEnum();
+                    any = true;
+
+                    continue;
+                }
+                else if (auto builtin = cc_find_builtin(tok.fText))
+                    kind = builtin->fKind;
+                else if (tok.fText != "const" &&
+                         tok.fText != "volatile" &&
+                         tok.fText != "register" &&
+                         tok.fText != "auto" &&
+                         tok.fText != "restrict" &&
+                         tok.fText != "signed")
+                    break;
+
+                Next();
+                any = true;
+
+                continue;
+            }
+
+            // a typedef name, unless a type was already given.
+            if (tok.fKind == kTokenIdentifier &&
+                !type &&
+                kind < 0 &&
+                longs == 0 &&
+                !is_short &&
+                !is_unsigned)
+            {
+                auto symbol = cc_find_symbol(tok.fText);
+
+                if (symbol &&
+                    symbol->fKind == kSymbolTypedef)
+                {
+                    type = symbol->fType;
+                    any = true;
+
+                    Next();
+                    continue;
+                }
+            }
+
+            break;
+        }
+
+        if (!any)
+            return false;
+
+        if (!type)
+        {
+            // 'unsigned', 'long' and 'static' alone mean int.
+            if (kind < 0)
+                kind = kTypeInt;
+
+            if (kind == kTypeInt &&
+                longs > 0)
+                kind = kTypeLong;
+
+            if (kind == kTypeInt &&
+                is_short)
+                kind = kTypeShort;
+
+            type = cc_builtin_type(kind, is_unsigned);
+        }
+
+        spec.fType = type;
+
+        return true;
+    }
+
+    CompilerDataType* CompilerParser::ParseRecord()
+    {
+        auto& keyword = Next();
+        Int32 kind = keyword.fText == "union" ? kTypeUnion : kTypeStruct;
+
+        std::string tag;
+
+        if (Peek().fKind == kTokenIdentifier)
+            tag = Next().fText;
+
+        CompilerRecordInfo* record = nullptr;
+
+        if (!tag.empty())
+            record = cc_find_record(tag, kind);
+
+        // a body always declares a new record, unless it completes a forward declaration.
+        if (Is("{") &&
+            record &&
+            record->fComplete)
+            record = nullptr;
+
+        if (!record)
+        {
+            record = kArena.New<CompilerRecordInfo>();
+            record->fTag = tag;
+            record->fKind = kind;
+
+            cc_add_record(record);
+        }
+
+        if (Accept("{"))
+        {
+            while (!Is("}") &&
+                   Peek().fKind != kTokenEof)
+            {
+                CompilerDeclSpec spec;
+
+                if (!ParseDeclSpec(spec))
+                    Error(Peek(), "Missing type of field, here -> " + std::string(Peek().fText));
+
+                do
+                {
+                    const CompilerToken* name = nullptr;
+                    auto type = ParseDeclarator(spec.fType, &name);
+
+                    if (!name)
+                        Error(Peek(), "Missing field name, here -> " + std::string(Peek().fText));
+
+                    if (Is(":"))
+                        Error(Peek(), "Bit-fields are not supported.");
+
+                    if (!cc_is_complete(type))
+                        Error(*name, "Field '" + std::string(name->fText) + "' has an incomplete type.");
+
+                    for (auto& field : record->fFields)
+                    {
+                        if (field.fName == name->fText)
+                            Error(*name, "Duplicate field '" + std::string(name->fText) + "'.");
+                    }
+
+                    record->fFields.push_back({ .fName = name->fText, .fType = type });
+                }
+                while (Accept(","));
+
+                Expect(";");
+            }
+
+            Expect("}");
+
+            cc_layout_record(record);
+
+            if (kWarnPadded)
+                cc_report_padding(record, kState.fFileNames[keyword.fFile], keyword.fLine);
+        }
+
+        auto type = cc_new_type(kind);
+        type->fRecord = record;
+
+        return type;
+    }
+
+    CompilerDataType* CompilerParser::ParseEnum()
+    {
+        Next();
+
+        std::string tag;
+
+        if (Peek().fKind == kTokenIdentifier)
+            tag = Next().fText;
+
+        if (Accept("{"))
+        {
+            Int64 value = 0;
+
+            while (!Is("}"))
+            {
+                auto& name = Next();
+
+                if (name.fKind != kTokenIdentifier)
+                    Error(name, "Missing enumerator name, here -> " + std::string(name.fText));
+
+                if (Accept("="))
+                    value = ParseConstant();
+
+                if (cc_find_in_scope(name.fText))
+                    Error(name, "Redefinition of '" + std::string(name.fText) + "'.");
+
+                auto symbol = cc_new_symbol(name.fText, kSymbolConstant);
+
+                symbol->fType = cc_builtin_type(kTypeInt);
+                symbol->fValue = value++;
+
+                cc_add_symbol(symbol);
+
+                if (!Accept(","))
+                    break;
+            }
+
+            Expect("}");
+        }
+
+        if (!tag.empty() &&
+            !cc_find_record(tag, kTypeEnum))
+        {
+            auto record = kArena.New<CompilerRecordInfo>();
+
+            record->fTag = tag;
+            record->fKind = kTypeEnum;
+            record->fComplete = true;
+
+            cc_add_record(record);
+        }
+
+        return cc_builtin_type(kTypeEnum);
+    }
+
+    CompilerDataType* CompilerParser::ParseDeclarator(CompilerDataType* base, const CompilerToken** name)
+    {
+        while (Accept("*"))
+        {
+            while (Accept("const") ||
+                   Accept("volatile") ||
+                   Accept("restrict"));
+
+            base = cc_pointer_to(base);
+        }
+
+        // a parenthesized declarator, such as (*callback)(int).
+        if (Is("(") &&
+            (Is("*", 1) ||
+            Is("(", 1) ||
+            Is("[", 1) ||
+            (Peek(1).fKind == kTokenIdentifier && !IsTypeName(1))))
+        {
+            Next();
+
+            auto hole = cc_new_type(kTypeVoid);
+            auto inner = ParseDeclarator(hole, name);
+
+            Expect(")");
+
+            *hole = *ParseSuffix(base);
+
+            return inner;
+        }
+
+        if (Peek().fKind == kTokenIdentifier)
+        {
+            if (!name)
+                Error(Peek(), "Unexpected identifier '" + std::string(Peek().fText) + "' in type name.");
+
+            *name = &Next();
+        }
+
+        return ParseSuffix(base);
+    }
+
+    CompilerDataType* CompilerParser::ParseSuffix(CompilerDataType* base)
+    {
+        if (Accept("["))
+        {
+            SizeType count = 0;
+            bool complete = false;
+
+            if (!Is("]"))
+            {
+                auto& tok = Peek();
+                auto value = ParseConstant();
+
+                if (value < 0)
+                    Error(tok, "Array size is negative.");
+
+                count = value;
+                complete = true;
+            }
+
+            Expect("]");
+
+            return cc_array_of(ParseSuffix(base), count, complete);
+        }
+
+        if (Accept("("))
+        {
+            auto function = cc_new_type(kTypeFunction);
+
+            if (Is(")"))
+            {
+                function->fPrototype = false;
+            }
+            else if (Is("void") &&
+                     Is(")", 1))
+            {
+                Next();
+            }
+            else
+            {
+                do
+                {
+                    if (Accept("..."))
+                    {
+                        function->fVariadic = true;
+                        break;
+                    }
+
+                    CompilerDeclSpec spec;
+
+                    if (!ParseDeclSpec(spec))
+                        Error(Peek(), "Missing type of parameter, here -> " + std::string(Peek().fText));
+
+                    const CompilerToken* param = nullptr;
+                    auto type = cc_decay(ParseDeclarator(spec.fType, &param));
+
+                    function->fParams.push_back(type);
+                    function->fParamNames.push_back(param ? param->fText : "");
+                }
+                while (Accept(","));
+            }
+
+            Expect(")");
+
+            function->fBase = ParseSuffix(base);
+
+            if (function->fBase->fKind == kTypeFunction ||
+                function->fBase->fKind == kTypeArray)
+                Error(Peek(), "A function cannot return a function or an array.");
+
+            return function;
+        }
+
+        return base;
+    }
+
+    CompilerDataType* CompilerParser::ParseTypeName()
+    {
+        CompilerDeclSpec spec;
+
+        if (!ParseDeclSpec(spec))
+            Error(Peek(), "Missing type name, here -> " + std::string(Peek().fText));
+
+        return ParseDeclarator(spec.fType, nullptr);
+    }
+
+    Int64 CompilerParser::ParseConstant()
+    {
+        auto& tok = Peek();
+        auto expr = ParseConditional();
+
+        Int64 value = 0;
+
+        if (!cc_eval_constant(expr, value))
+            Error(tok, "Expected a constant expression, here -> " + std::string(tok.fText));
+
+        return value;
+    }
+
+    std::vector<CompilerNode*> CompilerParser::ParseTranslationUnit()
+    {
+        std::vector<CompilerNode*> unit;
+
+        while (Peek().fKind != kTokenEof)
+        {
+            try
+            {
+                ParseExternal(unit);
+            }
+            catch (CompilerParseError&)
+            {
+                while (kCompilerScopes.size() > 1)
+                    cc_pop_scope();
+
+                fFunction = nullptr;
+                fLoopDepth = 0;
+                fSwitches.clear();
+
+                Synchronize();
+
+                // a '}' closing no block, Synchronize leaves it to the block it closes.
+                Accept("}");
+            }
+        }
+
+        // function scope statics are emitted like globals.
+        unit.insert(unit.end(), fStatics.begin(), fStatics.end());
+
+        return unit;
+    }
+
+    void CompilerParser::ParseExternal(std::vector<CompilerNode*>& unit)
+    {
+        if (Accept(";"))
+            return;
+
+        auto& start = Peek();
+
+        CompilerDeclSpec spec;
+
+        if (!ParseDeclSpec(spec))
+            Error(start, "Missing ';' or type, here -> " + std::string(start.fText));
+
+        // only a tag was declared.
+        if (Accept(";"))
+            return;
+
+        while (true)
+        {
+            const CompilerToken* name = nullptr;
+            auto type = ParseDeclarator(spec.fType, &name);
+
+            if (!name)
+                Error(Peek(), "Missing identifier in declaration, here -> " + std::string(Peek().fText));
+
+            if (spec.fTypedef)
+            {
+                if (cc_find_in_scope(name->fText))
+                    Error(*name, "Redefinition of '" + std::string(name->fText) + "'.");
+
+                auto symbol = cc_new_symbol(name->fText, kSymbolTypedef);
+                symbol->fType = type;
+
+                cc_add_symbol(symbol);
+            }
+            else if (type->fKind == kTypeFunction)
+            {
+                auto function = DeclareFunction(*name, type, spec);
+
+                if (Is("{"))
+                {
+                    unit.push_back(ParseFunction(function, *name));
+                    return;
+                }
+            }
+            else
+            {
+                auto global = DeclareGlobal(*name, type, spec);
+                auto node = NewNode(kNodeGlobal, *name);
+
+                node->fSymbol = global;
+
+                if (Accept("="))
+                {
+                    if (global->fInitialized)
+                        Error(*name, "Redefinition of '" + std::string(name->fText) + "'.");
+
+                    node->fChildren.push_back(ParseInitializer());
+
+                    global->fType = CompleteArray(global->fType, node->fChildren[0]);
+                    global->fInitialized = true;
+                    global->fDefined = true;
+                    global->fExtern = false;
+                }
+
+                if (!global->fExtern &&
+                    !cc_is_complete(global->fType))
+                    Error(*name, "Variable '" + std::string(name->fText) + "' has an incomplete type.");
+
+                unit.push_back(node);
+            }
+
+            if (Accept(","))
+                continue;
+
+            Expect(";");
+            return;
+        }
+    }
+
+    CompilerSymbol* CompilerParser::DeclareFunction(const CompilerToken& name, CompilerDataType* type, CompilerDeclSpec& spec)
+    {
+        auto symbol = cc_find_symbol(name.fText);
+
+        if (symbol &&
+            symbol->fKind != kSymbolFunction)
+        {
+            if (cc_find_in_scope(name.fText))
+                Error(name, "'" + std::string(name.fText) + "' redeclared as a function.");
+
+            symbol = nullptr;
+        }
+
+        if (!symbol)
+        {
+            symbol = cc_new_symbol(name.fText, kSymbolFunction);
+            symbol->fType = type;
+
+            kCompilerFunctions.push_back(symbol);
+
+            // functions always live at file scope.
+            cc_add_symbol(symbol, true);
+        }
+        else if (type->fPrototype)
+        {
+            symbol->fType = type;
+        }
+
+        symbol->fStatic |= spec.fStatic;
+        symbol->fInline |= spec.fInline;
+
+        return symbol;
+    }
+
+    CompilerSymbol* CompilerParser::DeclareGlobal(const CompilerToken& name, CompilerDataType* type, CompilerDeclSpec& spec)
+    {
+        auto symbol = cc_find_in_scope(name.fText);
+
+        if (symbol)
+        {
+            if (symbol->fKind != kSymbolVariable)
+                Error(name, "Redefinition of '" + std::string(name.fText) + "' as a different kind of symbol.");
+
+            if (!cc_is_complete(symbol->fType))
+                symbol->fType = type;
+
+            symbol->fExtern &= spec.fExtern;
+            symbol->fDefined |= !spec.fExtern;
+
+            return symbol;
+        }
+
+        symbol = cc_new_symbol(name.fText, kSymbolVariable);
+
+        symbol->fType = type;
+        symbol->fStatic = spec.fStatic;
+        symbol->fExtern = spec.fExtern;
+        symbol->fDefined = !spec.fExtern;
+
+        cc_add_symbol(symbol);
+
+        return symbol;
+    }
+
+    CompilerNode* CompilerParser::ParseFunction(CompilerSymbol* function, const CompilerToken& name)
+    {
+        if (function->fDefined)
+            Error(name, "Redefinition of function '" + std::string(name.fText) + "'.");
+
+        function->fDefined = true;
+        function->fIndex = fDefinitions++;
+
+        fStaticCount = 0;
+
+        auto node = NewNode(kNodeFunction, name);
+        auto type = function->fType;
+
+        node->fSymbol = function;
+        node->fType = type;
+
+        fFunction = function;
+
+        cc_push_scope();
+
+        for (SizeType i = 0; i < type->fParams.size(); ++i)
+        {
+            if (type->fParamNames[i].empty())
+                Error(name, "Missing name of parameter " + std::to_string(i + 1) + " of '" + std::string(name.fText) + "'.");
+
+            if (cc_find_in_scope(type->fParamNames[i]))
+                Error(name, "Duplicate parameter '" + std::string(type->fParamNames[i]) + "'.");
+
+            auto param = cc_new_symbol(type->fParamNames[i], kSymbolVariable);
+
+            param->fType = type->fParams[i];
+            param->fStorage = kStorageParam;
+            param->fOffset = i;
+
+            cc_add_symbol(param);
+
+            auto decl = NewNode(kNodeDeclaration, name);
+            decl->fSymbol = param;
+
+            node->fChildren.push_back(decl);
+        }
+
+        // parameters and the outer block of the body share a scope.
+        node->fChildren.push_back(ParseBlock(false));
+
+        cc_pop_scope();
+
+        fFunction = nullptr;
+
+        return node;
+    }
+
+    CompilerNode* CompilerParser::ParseInitializer()
+    {
+        auto& tok = Peek();
+
+        if (!Accept("{"))
+            return ParseAssignment();
+
+        auto list = NewNode(kNodeInitList, tok);
+
+        while (!Is("}"))
+        {
+            if (Is("[") ||
+                Is("."))
+                Error(Peek(), "Designated initializers are not supported.");
+
+            list->fChildren.push_back(ParseInitializer());
+
+            if (!Accept(","))
+                break;
+        }
+
+        Expect("}");
+
+        return list;
+    }
+
+    /// @brief 'int a[] = { 1, 2 }' takes its size from the initializer.
+    CompilerDataType* CompilerParser::CompleteArray(CompilerDataType* type, CompilerNode* init)
+    {
+        if (type->fKind != kTypeArray ||
+            type->fComplete)
+            return type;
+
+        if (init->fKind == kNodeInitList)
+            return cc_array_of(type->fBase, init->fChildren.size(), true);
+
+        if (init->fKind == kNodeString)
+            return cc_array_of(type->fBase, init->fText.size() + 1, true);
+
+        return type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    // @brief Statements.
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    CompilerNode* CompilerParser::ParseBlock(bool new_scope)
+    {
+        auto& tok = Peek();
+
+        Expect("{");
+
+        auto block = NewNode(kNodeBlock, tok);
+
+        if (new_scope)
+            cc_push_scope();
+
+        auto scope_depth = kCompilerScopes.size();
+        auto loop_depth = fLoopDepth;
+        auto switch_depth = fSwitches.size();
+
+        while (!Is("}") &&
+               Peek().fKind != kTokenEof)
+        {
+            try
+            {
+                if (IsTypeName() &&
+                    !Is(":", 1))
+                    ParseLocalDeclaration(block->fChildren);
+                else
+                    block->fChildren.push_back(ParseStatement());
+            }
+            catch (CompilerParseError&)
+            {
+                while (kCompilerScopes.size() > scope_depth)
+                    cc_pop_scope();
+
+                fLoopDepth = loop_depth;
+                fSwitches.resize(switch_depth);
+
+                Synchronize();
+            }
+        }
+
+        Expect("}");
+
+        if (new_scope)
+            cc_pop_scope();
+
+        return block;
+    }
+
+    void CompilerParser::ParseLocalDeclaration(std::vector<CompilerNode*>& block)
+    {
+        CompilerDeclSpec spec;
+        ParseDeclSpec(spec);
+
+        if (Accept(";"))
+            return;
+
+        do
+        {
+            const CompilerToken* name = nullptr;
+            auto type = ParseDeclarator(spec.fType, &name);
+
+            if (!name)
+                Error(Peek(), "Missing identifier in declaration, here -> " + std::string(Peek().fText));
+
+            if (type->fKind == kTypeFunction &&
+                !spec.fTypedef)
+            {
+                DeclareFunction(*name, type, spec);
+                continue;
+            }
+
+            if (cc_find_in_scope(name->fText))
+                Error(*name, "Redefinition of '" + std::string(name->fText) + "'.");
+
+            if (spec.fTypedef)
+            {
+                auto symbol = cc_new_symbol(name->fText, kSymbolTypedef);
+                symbol->fType = type;
+
+                cc_add_symbol(symbol);
+                continue;
+            }
+
+            auto symbol = cc_new_symbol(name->fText, kSymbolVariable);
+
+            symbol->fType = type;
+            symbol->fStorage = spec.fStatic || spec.fExtern ? kStorageGlobal : kStorageLocal;
+            symbol->fStatic = spec.fStatic;
+            symbol->fExtern = spec.fExtern;
+            symbol->fDefined = !spec.fExtern;
+
+            if (spec.fStatic)
+                symbol->fAsmName = detail::local_symbol(fFunction->fIndex, std::string(name->fText) + std::to_string(fStaticCount++));
+
+            cc_add_symbol(symbol);
+
+            auto node = NewNode(spec.fStatic ? kNodeGlobal : kNodeDeclaration, *name);
+            node->fSymbol = symbol;
+
+            if (Accept("="))
+            {
+                if (spec.fExtern)
+                    Error(*name, "'extern' variable '" + std::string(name->fText) + "' has an initializer.");
+
+                node->fChildren.push_back(ParseInitializer());
+
+                symbol->fType = CompleteArray(symbol->fType, node->fChildren[0]);
+                symbol->fInitialized = true;
+            }
+
+            if (!spec.fExtern &&
+                !cc_is_complete(symbol->fType))
+                Error(*name, "Variable '" + std::string(name->fText) + "' has an incomplete type.");
+
+            if (spec.fStatic)
+                fStatics.push_back(node);
+            else if (!spec.fExtern)
+                block.push_back(node);
+        }
+        while (Accept(","));
+
+        Expect(";");
+    }
+
+    CompilerNode* CompilerParser::ParseStatement()
+    {
+        auto& tok = Peek();
+
+        if (Is("{"))
+            return ParseBlock(true);
+
+        if (Accept(";"))
+            return NewNode(kNodeEmpty, tok);
+
+        if (Accept("if"))
+        {
+            auto node = NewNode(kNodeIf, tok);
+
+            Expect("(");
+            node->fChildren.push_back(ParseExpression());
+            CheckScalar(node->fChildren[0], tok);
+            Expect(")");
+
+            node->fChildren.push_back(ParseStatement());
+
+            if (Accept("else"))
+                node->fChildren.push_back(ParseStatement());
+
+            return node;
+        }
+
+        if (Accept("while"))
+        {
+            auto node = NewNode(kNodeWhile, tok);
+
+            Expect("(");
+            node->fChildren.push_back(ParseExpression());
+            CheckScalar(node->fChildren[0], tok);
+            Expect(")");
+
+            ++fLoopDepth;
+            node->fChildren.push_back(ParseStatement());
+            --fLoopDepth;
+
+            return node;
+        }
+
+        if (Accept("do"))
+        {
+            auto node = NewNode(kNodeDoWhile, tok);
+
+            ++fLoopDepth;
+            node->fChildren.push_back(ParseStatement());
+            --fLoopDepth;
+
+            Expect("while");
+            Expect("(");
+            node->fChildren.push_back(ParseExpression());
+            CheckScalar(node->fChildren[1], tok);
+            Expect(")");
+            Expect(";");
+
+            return node;
+        }
+
+        if (Accept("for"))
+        {
+            auto node = NewNode(kNodeFor, tok);
+
+            Expect("(");
+
+            cc_push_scope();
+
+            if (IsTypeName())
+            {
+                auto init = NewNode(kNodeBlock, tok);
+
+                ParseLocalDeclaration(init->fChildren);
+                node->fChildren.push_back(init);
+            }
+            else
+            {
+                node->fChildren.push_back(Is(";") ? nullptr : ParseExpression());
+                Expect(";");
+            }
+
+            node->fChildren.push_back(Is(";") ? nullptr : ParseExpression());
+
+            if (node->fChildren[1])
+                CheckScalar(node->fChildren[1], tok);
+
+            Expect(";");
+
+            node->fChildren.push_back(Is(")") ? nullptr : ParseExpression());
+            Expect(")");
+
+            ++fLoopDepth;
+            node->fChildren.push_back(ParseStatement());
+            --fLoopDepth;
+
+            cc_pop_scope();
+
+            return node;
+        }
+
+        if (Accept("return"))
+        {
+            auto node = NewNode(kNodeReturn, tok);
+
+            if (!Is(";"))
+            {
+                node->fChildren.push_back(ParseExpression());
+
+                if (fFunction->fType->fBase->fKind == kTypeVoid)
+                    Error(tok, "Returning a value from void function '" + std::string(fFunction->fName) + "'.");
+            }
+
+            Expect(";");
+
+            return node;
+        }
+
+        if (Accept("switch"))
+        {
+            auto node = NewNode(kNodeSwitch, tok);
+
+            Expect("(");
+            node->fChildren.push_back(ParseExpression());
+            Expect(")");
+
+            if (!cc_is_integer(node->fChildren[0]->fType))
+                Error(tok, "Switch on a value that is not an integer.");
+
+            fSwitches.emplace_back();
+            node->fChildren.push_back(ParseStatement());
+            fSwitches.pop_back();
+
+            return node;
+        }
+
+        if (Accept("case") ||
+            Accept("default"))
+        {
+            if (fSwitches.empty())
+                Error(tok, "'" + std::string(tok.fText) + "' outside of a switch.");
+
+            auto node = NewNode(tok.fText == "case" ? kNodeCase : kNodeDefault, tok);
+            Int64 value = 0;
+
+            if (node->fKind == kNodeCase)
+            {
+                auto expr = ParseConditional();
+
+                if (!cc_is_integer(expr->fType) ||
+                    !cc_eval_constant(expr, value))
+                    Error(tok, "Case label is not an integer constant.");
+            }
+
+            Expect(":");
+
+            if (node->fKind == kNodeCase &&
+                !fSwitches.back().fCases.insert(value).second)
+                Error(tok, "Duplicate case value " + std::to_string(value) + ".");
+
+            if (node->fKind == kNodeDefault)
+            {
+                if (fSwitches.back().fDefault)
+                    Error(tok, "Duplicate default label.");
+
+                fSwitches.back().fDefault = true;
+            }
+
+            node->fValue = value;
+
+            // a label right before the closing brace labels nothing.
+            node->fChildren.push_back(Is("}") ? NewNode(kNodeEmpty, tok) : ParseStatement());
+
+            return node;
+        }
+
+        if (Accept("break") ||
+            Accept("continue"))
+        {
+            if (fLoopDepth == 0 &&
+                (tok.fText != "break" || fSwitches.empty()))
+                Error(tok, "'" + std::string(tok.fText) + (tok.fText == "break" ? "' outside of a loop or switch." : "' outside of a loop."));
+
+            auto node = NewNode(tok.fText == "break" ? kNodeBreak : kNodeContinue, tok);
+
+            Expect(";");
+
+            return node;
+        }
+
+        if (Is("goto"))
+            Error(tok, "'" + std::string(tok.fText) + "' is not supported.");
+
+        auto node = NewNode(kNodeExpression, tok);
+
+        node->fChildren.push_back(ParseExpression());
+        Expect(";");
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    // @brief Expressions, by increasing precedence.
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    CompilerNode* CompilerParser::ParseExpression()
+    {
+        auto expr = ParseAssignment();
+
+        while (Is(","))
+        {
+            auto& tok = Next();
+            auto node = NewNode(kNodeComma, tok);
+
+            node->fChildren.push_back(expr);
+            node->fChildren.push_back(ParseAssignment());
+            node->fType = node->fChildren[1]->fType;
+
+            expr = node;
+        }
+
+        return expr;
+    }
+
+    CompilerNode* CompilerParser::ParseAssignment()
+    {
+        static const std::pair<const char*, Int32> kAssignments[] = {
+            { "=", kOpNone }, { "+=", kOpAdd }, { "-=", kOpSub }, { "*=", kOpMul },
+            { "/=", kOpDiv }, { "%=", kOpMod }, { "&=", kOpAnd }, { "|=", kOpOr },
+            { "^=", kOpXor }, { "<<=", kOpShl }, { ">>=", kOpShr },
+        };
+
+        auto lhs = ParseConditional();
+
+        for (auto& assignment : kAssignments)
+        {
+            if (!Is(assignment.first))
+                continue;
+
+            auto& tok = Next();
+            auto rhs = ParseAssignment();
+
+            CheckLvalue(lhs, tok);
+
+            if (cc_is_record(lhs->fType))
+            {
+                if (assignment.second != kOpNone ||
+                    !cc_is_record(rhs->fType) ||
+                    rhs->fType->fRecord != lhs->fType->fRecord)
+                    Error(tok, "Incompatible types in assignment.");
+            }
+            else
+            {
+                CheckScalar(rhs, tok);
+
+                if (assignment.second != kOpNone)
+                {
+                    // reuse the checks of the binary operator.
+                    MakeBinary(assignment.second, lhs, rhs, tok);
+                }
+            }
+
+            auto node = NewNode(kNodeAssign, tok);
+
+            node->fOp = assignment.second;
+            node->fType = lhs->fType;
+            node->fChildren = { lhs, rhs };
+
+            return node;
+        }
+
+        return lhs;
+    }
+
+    CompilerNode* CompilerParser::ParseConditional()
+    {
+        auto cond = ParseBinary(1);
+
+        if (!Is("?"))
+            return cond;
+
+        auto& tok = Next();
+
+        CheckScalar(cond, tok);
+
+        auto lhs = ParseExpression();
+        Expect(":");
+        auto rhs = ParseConditional();
+
+        auto node = NewNode(kNodeTernary, tok);
+
+        node->fChildren = { cond, lhs, rhs };
+
+        if ((cc_is_integer(lhs->fType) &&
+            cc_is_integer(rhs->fType)) ||
+            cc_is_float(lhs->fType) ||
+            cc_is_float(rhs->fType))
+            node->fType = cc_common_type(lhs->fType, rhs->fType);
+        else if (cc_is_integer(lhs->fType))
+            node->fType = cc_decay(rhs->fType);
+        else
+            node->fType = cc_decay(lhs->fType);
+
+        return node;
+    }
+
+    CompilerNode* CompilerParser::ParseBinary(Int32 min_precedence)
+    {
+        struct CompilerOperator final
+        {
+            const char* fText;
+            Int32 fOp;
+            Int32 fPrecedence;
+        };
+
+        static const CompilerOperator kOperators[] = {
+            { "||", kOpLogicalOr, 1 }, { "&&", kOpLogicalAnd, 2 }, { "|", kOpOr, 3 },
+            { "^", kOpXor, 4 }, { "&", kOpAnd, 5 }, { "==", kOpEq, 6 }, { "!=", kOpNe, 6 },
+            { "<", kOpLt, 7 }, { ">", kOpGt, 7 }, { "<=", kOpLe, 7 }, { ">=", kOpGe, 7 },
+            { "<<", kOpShl, 8 }, { ">>", kOpShr, 8 }, { "+", kOpAdd, 9 }, { "-", kOpSub, 9 },
+            { "*", kOpMul, 10 }, { "/", kOpDiv, 10 }, { "%", kOpMod, 10 },
+        };
+
+        auto lhs = ParseCast();
+
+        while (true)
+        {
+            const CompilerOperator* found = nullptr;
+
+            if (Peek().fKind == kTokenPunct)
+            {
+                for (auto& op : kOperators)
+                {
+                    if (Peek().fText == op.fText)
+                    {
+                        found = &op;
+                        break;
+                    }
+                }
+            }
+
+            if (!found ||
+                found->fPrecedence < min_precedence)
+                return lhs;
+
+            auto& tok = Next();
+            auto rhs = ParseBinary(found->fPrecedence + 1);
+
+            lhs = MakeBinary(found->fOp, lhs, rhs, tok);
+        }
+    }
+
+    CompilerNode* CompilerParser::MakeBinary(Int32 op, CompilerNode* lhs, CompilerNode* rhs, const CompilerToken& tok)
+    {
+        CheckScalar(lhs, tok);
+        CheckScalar(rhs, tok);
+
+        auto lhs_type = cc_decay(lhs->fType);
+        auto rhs_type = cc_decay(rhs->fType);
+
+        auto node = NewNode(op == kOpLogicalAnd || op == kOpLogicalOr ? kNodeLogical : kNodeBinary, tok);
+
+        node->fOp = op;
+        node->fChildren = { lhs, rhs };
+
+        auto invalid = [&]() {
+            Error(tok, "Invalid operands to binary '" + std::string(tok.fText) + "'.");
+        };
+
+        switch (op)
+        {
+        case kOpLogicalAnd:
+        case kOpLogicalOr:
+        case kOpEq:
+        case kOpNe:
+        case kOpLt:
+        case kOpGt:
+        case kOpLe:
+        case kOpGe:
+        {
+            node->fType = cc_builtin_type(kTypeInt);
+            break;
+        }
+        case kOpAdd:
+        {
+            if (cc_is_pointer(lhs_type) &&
+                cc_is_pointer(rhs_type))
+                invalid();
+
+            if (cc_is_pointer(lhs_type))
+                node->fType = lhs_type;
+            else if (cc_is_pointer(rhs_type))
+                node->fType = rhs_type;
+            else
+                node->fType = cc_common_type(lhs_type, rhs_type);
+
+            break;
+        }
+        case kOpSub:
+        {
+            if (cc_is_pointer(lhs_type) &&
+                cc_is_pointer(rhs_type))
+                node->fType = cc_builtin_type(kTypeLong);
+            else if (cc_is_pointer(rhs_type))
+                invalid();
+            else if (cc_is_pointer(lhs_type))
+                node->fType = lhs_type;
+            else
+                node->fType = cc_common_type(lhs_type, rhs_type);
+
+            break;
+        }
+        case kOpMul:
+        case kOpDiv:
+        {
+            if (cc_is_pointer(lhs_type) ||
+                cc_is_pointer(rhs_type))
+                invalid();
+
+            node->fType = cc_common_type(lhs_type, rhs_type);
+            break;
+        }
+        default:
+        {
+            if (!cc_is_integer(lhs_type) ||
+                !cc_is_integer(rhs_type))
+                invalid();
+
+            node->fType = op == kOpShl || op == kOpShr ?
+                cc_common_type(lhs_type, lhs_type) : cc_common_type(lhs_type, rhs_type);
+
+            break;
+        }
+        }
+
+        return node;
+    }
+
+    CompilerNode* CompilerParser::ParseCast()
+    {
+        if (Is("(") &&
+            IsTypeName(1))
+        {
+            auto& tok = Next();
+            auto type = ParseTypeName();
+
+            Expect(")");
+
+            if (Is("{"))
+                Error(tok, "Compound literals are not supported.");
+
+            auto operand = ParseCast();
+
+            if (type->fKind != kTypeVoid)
+            {
+                CheckScalar(operand, tok);
+
+                if (!cc_is_scalar(type))
+                    Error(tok, "Cannot cast to a non-scalar type.");
+            }
+
+            auto node = NewNode(kNodeCast, tok);
+
+            node->fType = type;
+            node->fChildren.push_back(operand);
+
+            return node;
+        }
+
+        return ParseUnary();
+    }
+
+    CompilerNode* CompilerParser::ParseUnary()
+    {
+        auto& tok = Peek();
+
+        if (Accept("++") ||
+            Accept("--"))
+        {
+            auto operand = ParseUnary();
+
+            CheckLvalue(operand, tok);
+            CheckScalar(operand, tok);
+
+            auto node = NewNode(kNodeIncrement, tok);
+
+            node->fOp = tok.fText == "++" ? kOpAdd : kOpSub;
+            node->fType = operand->fType;
+            node->fChildren.push_back(operand);
+
+            return node;
+        }
+
+        if (Accept("&"))
+        {
+            auto operand = ParseCast();
+
+            if (!(operand->fKind == kNodeVariable && operand->fSymbol->fKind == kSymbolFunction))
+                CheckLvalue(operand, tok);
+
+            auto node = NewNode(kNodeAddress, tok);
+
+            node->fType = cc_pointer_to(operand->fType);
+            node->fChildren.push_back(operand);
+
+            return node;
+        }
+
+        if (Accept("*"))
+        {
+            auto operand = ParseCast();
+            auto type = cc_decay(operand->fType);
+
+            if (!cc_is_pointer(type))
+                Error(tok, "Cannot dereference a non-pointer value.");
+
+            if (type->fBase->fKind == kTypeVoid)
+                Error(tok, "Cannot dereference a void pointer.");
+
+            auto node = NewNode(kNodeDeref, tok);
+
+            node->fType = type->fBase;
+            node->fChildren.push_back(operand);
+
+            return node;
+        }
+
+        if (Is("-") ||
+            Is("+") ||
+            Is("~") ||
+            Is("!"))
+        {
+            Next();
+
+            auto operand = ParseCast();
+
+            CheckScalar(operand, tok);
+
+            auto node = NewNode(kNodeUnary, tok);
+
+            node->fChildren.push_back(operand);
+
+            switch (tok.fText[0])
+            {
+            case '-': node->fOp = kOpNeg; break;
+            case '+': node->fOp = kOpPlus; break;
+            case '~': node->fOp = kOpNot; break;
+            default: node->fOp = kOpLogicalNot; break;
+            }
+
+            if (node->fOp == kOpLogicalNot)
+            {
+                node->fType = cc_builtin_type(kTypeInt);
+            }
+            else
+            {
+                if (!cc_is_integer(operand->fType) &&
+                    !(cc_is_float(operand->fType) && node->fOp != kOpNot))
+                    Error(tok, "Invalid operand to unary '" + std::string(tok.fText) + "'.");
+
+                node->fType = cc_common_type(operand->fType, operand->fType);
+            }
+
+            return node;
+        }
+
+        if (Accept("sizeof"))
+        {
+            CompilerDataType* type = nullptr;
+
+            if (Is("(") &&
+                IsTypeName(1))
+            {
+                Next();
+                type = ParseTypeName();
+                Expect(")");
+            }
+            else
+            {
+                type = ParseUnary()->fType;
+            }
+
+            if (type->fKind == kTypeFunction ||
+                (!cc_is_complete(type) && type->fKind != kTypeVoid))
+                Error(tok, "Invalid application of 'sizeof' to an incomplete type.");
+
+            auto node = NewNode(kNodeNumber, tok);
+
+            node->fType = cc_builtin_type(kTypeLong, true);
+            node->fValue = cc_type_size(type);
+
+            return node;
+        }
+
+        return ParsePostfix();
+    }
+
+    CompilerNode* CompilerParser::ParsePostfix()
+    {
+        auto expr = ParsePrimary();
+
+        while (true)
+        {
+            auto& tok = Peek();
+
+            if (Accept("["))
+            {
+                auto index = ParseExpression();
+                Expect("]");
+
+                auto sum = MakeBinary(kOpAdd, expr, index, tok);
+
+                if (!cc_is_pointer(sum->fType))
+                    Error(tok, "Subscripted value is not an array or a pointer.");
+
+                expr = NewNode(kNodeDeref, tok);
+
+                expr->fType = sum->fType->fBase;
+                expr->fChildren.push_back(sum);
+            }
+            else if (Accept("("))
+            {
+                std::vector<CompilerNode*> args;
+
+                if (!Is(")"))
+                {
+                    do
+                    {
+                        args.push_back(ParseAssignment());
+                    }
+                    while (Accept(","));
+                }
+
+                Expect(")");
+
+                expr = MakeCall(expr, args, tok);
+            }
+            else if (Accept("."))
+            {
+                expr = MakeMember(expr, false, tok);
+            }
+            else if (Accept("->"))
+            {
+                expr = MakeMember(expr, true, tok);
+            }
+            else if (Accept("++") ||
+                     Accept("--"))
+            {
+                CheckLvalue(expr, tok);
+                CheckScalar(expr, tok);
+
+                auto node = NewNode(kNodeIncrement, tok);
+
+                node->fOp = tok.fText == "++" ? kOpAdd : kOpSub;
+                node->fValue = 1;
+                node->fType = expr->fType;
+                node->fChildren.push_back(expr);
+
+                expr = node;
+            }
+            else
+            {
+                return expr;
+            }
+        }
+    }
+
+    CompilerNode* CompilerParser::MakeCall(CompilerNode* callee, std::vector<CompilerNode*>& args, const CompilerToken& tok)
+    {
+        auto type = callee->fType;
+
+        if (cc_is_pointer(type))
+            type = type->fBase;
+
+        if (type->fKind != kTypeFunction)
+            Error(tok, "Called object is not a function.");
+
+        std::string name = callee->fKind == kNodeVariable ? "'" + std::string(callee->fSymbol->fName) + "'" : "call";
+
+        if (type->fPrototype)
+        {
+            if (args.size() < type->fParams.size())
+                Error(tok, "Too few arguments to function " + name + ".");
+
+            if (args.size() > type->fParams.size() &&
+                !type->fVariadic)
+                Error(tok, "Too many arguments to function " + name + ".");
+        }
+
+        auto node = NewNode(kNodeCall, tok);
+
+        node->fType = type->fBase;
+        node->fChildren.push_back(callee);
+
+        for (SizeType i = 0; i < args.size(); ++i)
+        {
+            if (cc_is_record(args[i]->fType))
+                Error(tok, "Passing a struct by value to " + name + " is not supported.");
+
+            CheckScalar(args[i], tok);
+
+            node->fChildren.push_back(args[i]);
+        }
+
+        return node;
+    }
+
+    CompilerNode* CompilerParser::MakeMember(CompilerNode* base, bool arrow, const CompilerToken& tok)
+    {
+        auto& name = Next();
+
+        if (name.fKind != kTokenIdentifier)
+            Error(name, "Missing field name after '" + std::string(tok.fText) + "'.");
+
+        auto type = base->fType;
+
+        if (arrow)
+        {
+            type = cc_decay(type);
+
+            if (!cc_is_pointer(type))
+                Error(tok, "Left operand of '->' is not a pointer.");
+
+            type = type->fBase;
+        }
+
+        if (!cc_is_record(type))
+            Error(tok, "Left operand of '" + std::string(tok.fText) + "' is not a struct or a union.");
+
+        if (!cc_is_complete(type))
+            Error(tok, "Access to a field of an incomplete type.");
+
+        for (auto& field : type->fRecord->fFields)
+        {
+            if (field.fName == name.fText)
+            {
+                auto node = NewNode(kNodeMember, tok);
+
+                node->fValue = arrow;
+                node->fField = &field;
+                node->fType = field.fType;
+                node->fChildren.push_back(base);
+
+                return node;
+            }
+        }
+
+        Error(name, "No field named '" + std::string(name.fText) + "'.");
+    }
+
+    CompilerNode* CompilerParser::ParsePrimary()
+    {
+        auto& tok = Next();
+
+        switch (tok.fKind)
+        {
+        case kTokenNumber:
+        {
+            auto node = NewNode(kNodeNumber, tok);
+
+            node->fValue = tok.fValue;
+            node->fType = cc_builtin_type(tok.fValue > INT32_MAX ? kTypeLong : kTypeInt);
+
+            return node;
+        }
+        case kTokenFloat:
+        {
+            auto node = NewNode(kNodeNumber, tok);
+
+            node->fText = tok.fText;
+            node->fType = cc_builtin_type(kTypeDouble);
+
+            return node;
+        }
+        case kTokenString:
+        {
+            auto node = NewNode(kNodeString, tok);
+
+            node->fText = tok.fText;
+
+            // adjacent literals are one string.
+            if (Peek().fKind == kTokenString)
+            {
+                std::string bytes(tok.fText);
+
+                while (Peek().fKind == kTokenString)
+                    bytes += Next().fText;
+
+                node->fText = kIdentifiers.Intern(bytes);
+            }
+
+            node->fType = cc_array_of(cc_builtin_type(kTypeChar), node->fText.size() + 1, true);
+
+            return node;
+        }
+        case kTokenIdentifier:
+        {
+            auto symbol = cc_find_symbol(tok.fText);
+
+            if (!symbol)
+            {
+                if (!Is("("))
+                    Error(tok, "Undefined value: " + std::string(tok.fText));
+
+                // implicit declaration, 'int name()'.
+                auto type = cc_new_type(kTypeFunction);
+
+                type->fBase = cc_builtin_type(kTypeInt);
+                type->fPrototype = false;
+
+                CompilerDeclSpec spec;
+                symbol = DeclareFunction(tok, type, spec);
+            }
+
+            if (symbol->fKind == kSymbolTypedef)
+                Error(tok, "Unexpected type name '" + std::string(tok.fText) + "'.");
+
+            if (symbol->fKind == kSymbolConstant)
+            {
+                auto node = NewNode(kNodeNumber, tok);
+
+                node->fValue = symbol->fValue;
+                node->fType = symbol->fType;
+
+                return node;
+            }
+
+            auto node = NewNode(kNodeVariable, tok);
+
+            node->fSymbol = symbol;
+            node->fType = symbol->fType;
+
+            return node;
+        }
+        default:
+            break;
+        }
+
+        if (tok.fKind == kTokenPunct &&
+            tok.fText == "(")
+        {
+            auto expr = ParseExpression();
+            Expect(")");
+
+            return expr;
+        }
+
+        Error(tok, "Unexpected '" + (tok.fKind == kTokenEof ? std::string("end of file") : std::string(tok.fText)) + "' in expression.");
+    }
+
+    void CompilerParser::CheckLvalue(CompilerNode* node, const CompilerToken& tok)
+    {
+        bool lvalue = false;
+
+        switch (node->fKind)
+        {
+        case kNodeVariable:
+            lvalue = node->fSymbol->fKind == kSymbolVariable;
+            break;
+        case kNodeDeref:
+            lvalue = true;
+            break;
+        case kNodeMember:
+            lvalue = node->fValue ||
+                node->fChildren[0]->fKind != kNodeCall;
+            break;
+        default:
+            break;
+        }
+
+        if (node->fType->fKind == kTypeArray ||
+            node->fType->fKind == kTypeFunction)
+            lvalue = false;
+
+        if (!lvalue)
+            Error(tok, "Expression is not assignable, here -> " + std::string(tok.fText));
+    }
+
+    void CompilerParser::CheckScalar(CompilerNode* node, const CompilerToken& tok)
+    {
+        auto type = cc_decay(node->fType);
+
+        if (!cc_is_scalar(type))
+            Error(tok, "Expected a scalar value, here -> " + std::string(tok.fText));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Semantic checks left once the whole tree is built.
+//
+// The parser types every expression as it goes, what remains is what the NewCPU
+// backend cannot lower: initializers, floating point values, struct returns.
+// A tree that passes here is lowered without further checks.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+    class CompilerSema final
+    {
+    public:
+        explicit CompilerSema() = default;
+        ~CompilerSema() = default;
+
+        CXXKIT_COPY_DELETE(CompilerSema);
+
+        void Check(const std::vector<CompilerNode*>& unit);
+
+    private:
+        void Error(CompilerNode* node, const std::string& reason);
+
+        void CheckNode(CompilerNode* node);
+        void CheckExpr(CompilerNode* expr);
+        void CheckAddr(CompilerNode* expr);
+        void CheckInit(CompilerDataType* type, CompilerNode* init, bool constant);
+
+    };
+
+    void CompilerSema::Check(const std::vector<CompilerNode*>& unit)
+    {
+        for (auto node : unit)
+            CheckNode(node);
+    }
+
+    void CompilerSema::Error(CompilerNode* node, const std::string& reason)
+    {
+        detail::print_error(reason, kState.fFileNames[node->fFile], node->fLine);
+    }
+
+    void CompilerSema::CheckNode(CompilerNode* node)
+    {
+        if (!node)
+            return;
+
+        if (node->fKind < kNodeBlock)
+        {
+            CheckExpr(node);
+            return;
+        }
+
+        switch (node->fKind)
+        {
+        case kNodeFunction:
+        {
+            CheckNode(node->fChildren.back());
+            break;
+        }
+        case kNodeGlobal:
+        case kNodeDeclaration:
+        {
+            if (!node->fChildren.empty())
+                CheckInit(node->fSymbol->fType, node->fChildren[0], node->fKind == kNodeGlobal);
+
+            break;
+        }
+        case kNodeReturn:
+        {
+            if (!node->fChildren.empty() &&
+                cc_is_record(node->fChildren[0]->fType))
+            {
+                Error(node, "Returning a struct by value is not supported.");
+                break;
+            }
+
+            [[fallthrough]];
+        }
+        default:
+        {
+            for (auto child : node->fChildren)
+                CheckNode(child);
+
+            break;
+        }
+        }
+    }
+
+    /// @brief an expression evaluated at run time.
+    void CompilerSema::CheckExpr(CompilerNode* expr)
+    {
+        if (cc_is_float(expr->fType))
+        {
+            Error(expr, "Floating point arithmetic is not supported by the NewCPU backend.");
+            return;
+        }
+
+        switch (expr->fKind)
+        {
+        case kNodeNumber:
+            break;
+        case kNodeString:
+        case kNodeVariable:
+        case kNodeMember:
+        {
+            CheckAddr(expr);
+            break;
+        }
+        case kNodeDeref:
+        case kNodeUnary:
+        case kNodeBinary:
+        case kNodeLogical:
+        case kNodeTernary:
+        case kNodeCast:
+        case kNodeComma:
+        case kNodeCall:
+        {
+            for (auto child : expr->fChildren)
+                CheckExpr(child);
+
+            break;
+        }
+        case kNodeAddress:
+        {
+            if (expr->fChildren[0]->fKind == kNodeDeref)
+                CheckExpr(expr->fChildren[0]->fChildren[0]);
+            else
+                CheckAddr(expr->fChildren[0]);
+
+            break;
+        }
+        case kNodeAssign:
+        {
+            CheckExpr(expr->fChildren[1]);
+            CheckAddr(expr->fChildren[0]);
+
+            break;
+        }
+        case kNodeIncrement:
+        {
+            CheckAddr(expr->fChildren[0]);
+            break;
+        }
+        default:
+        {
+            Error(expr, "Unsupported expression.");
+            break;
+        }
+        }
+    }
+
+    /// @brief an expression whose address is taken.
+    void CompilerSema::CheckAddr(CompilerNode* expr)
+    {
+        switch (expr->fKind)
+        {
+        case kNodeVariable:
+        case kNodeString:
+            break;
+        case kNodeDeref:
+        {
+            CheckExpr(expr->fChildren[0]);
+            break;
+        }
+        case kNodeMember:
+        {
+            // 'p->x' reads p, 's.x' needs the address of s.
+            if (expr->fValue)
+                CheckExpr(expr->fChildren[0]);
+            else
+                CheckAddr(expr->fChildren[0]);
+
+            break;
+        }
+        default:
+        {
+            Error(expr, "Expression is not addressable.");
+            break;
+        }
+        }
+    }
+
+    /// @brief initializer of a local, or of a global when constant is set.
+    void CompilerSema::CheckInit(CompilerDataType* type, CompilerNode* init, bool constant)
+    {
+        if (init->fKind == kNodeInitList)
+        {
+            if (type->fKind == kTypeArray)
+            {
+                if (init->fChildren.size() > type->fCount)
+                    Error(init, "Too many initializers for array.");
+
+                for (SizeType i = 0; i < init->fChildren.size() && i < type->fCount; ++i)
+                    CheckInit(type->fBase, init->fChildren[i], constant);
+            }
+            else if (cc_is_record(type))
+            {
+                auto& fields = type->fRecord->fFields;
+                auto count = type->fKind == kTypeUnion ? std::min<SizeType>(1, fields.size()) : fields.size();
+
+                if (init->fChildren.size() > count)
+                    Error(init, "Too many initializers for struct.");
+
+                for (SizeType i = 0; i < init->fChildren.size() && i < count; ++i)
+                    CheckInit(fields[i].fType, init->fChildren[i], constant);
+            }
+            else if (!init->fChildren.empty())
+            {
+                CheckInit(type, init->fChildren[0], constant);
+            }
+
+            return;
+        }
+
+        if (init->fKind == kNodeString &&
+            type->fKind == kTypeArray)
+            return;
+
+        if (!constant)
+        {
+            CheckExpr(init);
+            return;
+        }
+
+        if (!cc_is_scalar(type))
+        {
+            Error(init, "Invalid initializer.");
+            return;
+        }
+
+        Int64 value = 0;
+        CompilerNode* base = nullptr;
+
+        if (!cc_eval_constant(init, value) &&
+            !(cc_type_size(type) == kWordSize && cc_address_constant(init, base)))
+            Error(init, "Initializer element is not constant.");
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief MASM generator, walks the typed syntax tree.
+//
+// Functions are lowered to the AsmKit IR over virtual registers, which are then
+// mapped on kStartUsable..kUsableLimit by the linear scan allocator. Locals live
+// in stack slots, r31 holds return values. Calls follow the NewCPU convention of
+// AsmKit/Arch/NewCPU.hpp, the first arguments go in r17..r22 and the rest are pushed
+// right to left, 'jlr' pushes the return address and 'jrl' pops it. From -O1 a call
+// whose result is returned as is becomes a 'jb' once the frame is torn down.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+    /// @brief a memory operand, base register plus displacement.
+    /// The base may be kIRFrameRegister for locals and kIRArgRegister for parameters passed on the stack.
+    struct CompilerAddress final
+    {
+        Int32 fBase{ kIRFrameRegister };
+        Int64 fOffset{ 0 };
+    };
+
+    /// @brief text and data records a function or a global lowers to.
+    struct CompilerChunk final
+    {
+        std::vector<CxxKit::AsmLine> fText;
+        std::vector<CxxKit::AsmLine> fData;
+    };
+
+    class CompilerGenerator final
+    {
+    public:
+        explicit CompilerGenerator()
+        {
+            CxxKit::ir_add_passes(fPasses, kOptimizationLevel);
+        }
+
+        ~CompilerGenerator() = default;
+
+        CXXKIT_COPY_DELETE(CompilerGenerator);
+
+        void Generate(const std::vector<CompilerNode*>& unit);
+
+    private:
+        void Emit(CxxKit::AsmLine line);
+        void TakeChunk(CompilerChunk& chunk);
+        std::string MakeLabel();
+        const std::string& UseLabel(std::string& label);
+        void PlaceLabel(const std::string& label);
+
+        Int32 NewReg();
+
+        void GenerateFunction(CompilerNode* function, CxxKit::IRFunction& code);
+        void LowerFunction(CxxKit::IRFunction& code);
+        void GenerateGlobal(CompilerNode* global);
+        void GenerateStatement(CompilerNode* stmt);
+        void AssignSlots(CompilerNode* node);
+
+        Int32 GenExpr(CompilerNode* expr);
+        Int32 GenConstant(Int64 value);
+        Int32 GenBinary(CompilerNode* expr);
+        Int32 GenAssign(CompilerNode* expr);
+        Int32 GenIncrement(CompilerNode* expr);
+        Int32 GenCall(CompilerNode* expr);
+        Int32 GenCompare(Int32 op, Int32 lhs, Int32 rhs);
+        void GenBranch(CompilerNode* cond, std::string& label, bool jump_if);
+        void GenSwitch(Int32 value, const std::vector<std::pair<Int64, std::string>>& cases, SizeType first, SizeType last,
+                       const std::string& fallback, Int64 low, Int64 high);
+        CompilerAddress GenAddr(CompilerNode* expr);
+        Int32 GenMaterialize(const CompilerAddress& addr);
+        Int32 GenLoad(CompilerDataType* type, const CompilerAddress& addr);
+        void GenStore(CompilerDataType* type, Int32 value, const CompilerAddress& addr);
+        void GenCopy(SizeType size, const CompilerAddress& dst, Int32 src);
+        void GenZero(Int64 offset, SizeType size);
+        Int32 GenScale(Int32 reg, SizeType size);
+        void GenLocalInit(CompilerDataType* type, CompilerNode* init, Int64 offset, bool zeroed = false);
+
+        std::string StringLabel(std::string_view bytes);
+        void BuildImage(CompilerDataType* type, CompilerNode* init, SizeType offset,
+                        std::vector<UInt8>& image, std::vector<std::pair<SizeType, std::string>>& relocs);
+        void EmitImage(const std::string& section, const std::string& symbol, std::vector<UInt8>& image,
+                       std::vector<std::pair<SizeType, std::string>>& relocs);
+
+    private:
+        std::vector<CxxKit::AsmLine> fText;
+        std::vector<CxxKit::AsmLine> fData;
+        std::vector<std::string> fBreakLabels;
+        std::vector<std::string> fContinueLabels;
+        std::unordered_set<CompilerSymbol*> fEmitted;
+        std::unordered_map<CompilerNode*, std::string> fCaseLabels;
+        CxxKit::IRPassManager fPasses;
+        CompilerSymbol* fFunction{ nullptr };
+        CxxKit::IRFunction* fCode{ nullptr };
+        SizeType fLabelCount{ 0 };
+        SizeType fDataLabelCount{ 0 };
+        SizeType fFrameSize{ 0 };
+
+    };
+
+    /// @brief how a symbol is referred to, symbols defined elsewhere are imported.
+    static std::string symbol_ref(CompilerSymbol* symbol)
+    {
+        if (symbol->fDefined &&
+            !symbol->fExtern)
+            return symbol->fAsmName;
+
+        return "__import " + symbol->fAsmName;
+    }
+
+    static const char* op_mnemonic(Int32 op)
+    {
+        switch (op)
+        {
+        case kOpAdd: return "add";
+        case kOpSub: return "sub";
+        case kOpMul: return "mul";
+        case kOpDiv: return "div";
+        case kOpMod: return "mod";
+        case kOpAnd: return "and";
+        case kOpOr: return "or";
+        case kOpXor: return "xor";
+        case kOpShl: return "shl";
+        case kOpShr: return "shr";
+        default: return "nop";
+        }
+    }
+
+    /// @brief branch taken when the comparison holds.
+    static const char* branch_mnemonic(Int32 op, bool negate)
+    {
+        switch (op)
+        {
+        case kOpEq: return negate ? "bne" : "beq";
+        case kOpNe: return negate ? "beq" : "bne";
+        case kOpLt: return negate ? "bge" : "bl";
+        case kOpGt: return negate ? "ble" : "bg";
+        case kOpLe: return negate ? "bg" : "ble";
+        case kOpGe: return negate ? "bl" : "bge";
+        default: return "bne";
+        }
+    }
+
+    static bool is_comparison(Int32 op)
+    {
+        return op >= kOpEq && op <= kOpGe;
+    }
+
+    static Int32 type_width(CompilerDataType* type)
+    {
+        return cc_type_size(type) == 1 ? 1 : kWordSize;
+    }
+
+    /// @brief pointers, and arrays and functions which decay to one.
+    /// cc_decay makes a new type, which the generator must not do from several threads.
+    static bool is_address(CompilerDataType* type)
+    {
+        return cc_is_pointer(type) ||
+            type->fKind == kTypeArray ||
+            type->fKind == kTypeFunction;
+    }
+
+    /// @brief what a pointer, or the pointer an array or function decays to, steps over.
+    static SizeType step_size(CompilerDataType* type)
+    {
+        return type->fKind == kTypeFunction ? cc_type_size(type) : cc_element_size(type);
+    }
+
+    /// @brief case and default labels of a switch body, those of nested switches excluded.
+    static void collect_cases(CompilerNode* node, std::vector<CompilerNode*>& labels)
+    {
+        if (!node ||
+            node->fKind < kNodeBlock ||
+            node->fKind == kNodeSwitch)
+            return;
+
+        if (node->fKind == kNodeCase ||
+            node->fKind == kNodeDefault)
+            labels.push_back(node);
+
+        for (auto child : node->fChildren)
+            collect_cases(child, labels);
+    }
+
+    void CompilerGenerator::Emit(CxxKit::AsmLine line)
+    {
+        fText.push_back(std::move(line));
+    }
+
+    /// @brief move what was generated since the last call to the end of chunk.
+    void CompilerGenerator::TakeChunk(CompilerChunk& chunk)
+    {
+        std::move(fText.begin(), fText.end(), std::back_inserter(chunk.fText));
+        std::move(fData.begin(), fData.end(), std::back_inserter(chunk.fData));
+
+        fText.clear();
+        fData.clear();
+    }
+
+    /// @brief labels are numbered per function, in the namespace of their function.
+    /// Data made outside of any function goes in the namespace after the last function.
+    std::string CompilerGenerator::MakeLabel()
+    {
+        if (!fFunction)
+            return local_symbol(kCompilerFunctions.size(), "L" + std::to_string(fDataLabelCount++));
+
+        return local_symbol(fFunction->fIndex, "L" + std::to_string(fLabelCount++));
+    }
+
+    /// @brief the label a jump goes to, made on first use.
+    const std::string& CompilerGenerator::UseLabel(std::string& label)
+    {
+        if (label.empty())
+            label = MakeLabel();
+
+        return label;
+    }
+
+    /// @brief define a label, unless nothing jumps to it.
+    void CompilerGenerator::PlaceLabel(const std::string& label)
+    {
+        if (!label.empty())
+            fCode->Label(label);
+    }
+
+    Int32 CompilerGenerator::NewReg()
+    {
+        return fCode->NewRegister();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    // @brief Translation unit, functions and data.
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    /// @brief run job 0..count-1 on up to jobs threads, each worker takes the next
+    /// job left as soon as it is done with one.
+    template <typename Fn>
+    static void run_jobs(SizeType count, SizeType jobs, Fn fn)
+    {
+        std::atomic<SizeType> next{ 0 };
+        std::vector<std::thread> workers;
+
+        for (SizeType worker = 0; worker < std::min(jobs, count); ++worker)
+        {
+            workers.emplace_back([&, worker]() {
+                for (auto job = next++; job < count; job = next++)
+                    fn(job, worker);
+            });
+        }
+
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    /// @brief functions only read the tree and write their own chunk, with -j they
+    /// are lowered on a pool of generators and put back in source order.
+    /// Every function is turned into IR before any is lowered, so that the
+    /// inliner may copy any of them while they are all being lowered.
+    void CompilerGenerator::Generate(const std::vector<CompilerNode*>& unit)
+    {
+        std::vector<CompilerChunk> chunks(unit.size());
+        std::vector<SizeType> functions;
+
+        for (SizeType index = 0; index < unit.size(); ++index)
+        {
+            if (unit[index]->fKind == kNodeFunction)
+            {
+                functions.push_back(index);
+                continue;
+            }
+
+            GenerateGlobal(unit[index]);
+            TakeChunk(chunks[index]);
+        }
+
+        std::vector<CxxKit::IRFunction> bodies(functions.size());
+        std::unordered_map<std::string, SizeType> names;
+
+        for (SizeType job = 0; job < functions.size(); ++job)
+            names[unit[functions[job]]->fSymbol->fAsmName] = job;
+
+        bool inline_calls = kOptimizationLevel > 0 &&
+                            kInlineLimit > 0 &&
+                            !kLinkTimeOptimization;
+
+        auto build = [&](CompilerGenerator& generator, SizeType job) {
+            generator.GenerateFunction(unit[functions[job]], bodies[job]);
+            generator.TakeChunk(chunks[functions[job]]);
+        };
+
+        // the bodies are only read once they are all built, each one is lowered from a copy.
+        auto lower = [&](CompilerGenerator& generator, SizeType job) {
+            auto code = inline_calls ? bodies[job] : std::move(bodies[job]);
+
+            if (inline_calls)
+                CxxKit::ir_inline_calls(code, bodies, names, kInlineLimit);
+
+            generator.LowerFunction(code);
+            generator.TakeChunk(chunks[functions[job]]);
+        };
+
+        if (kJobs > 1 &&
+            functions.size() > 1)
+        {
+            std::vector<std::unique_ptr<CompilerGenerator>> pool(std::min(kJobs, functions.size()));
+
+            for (auto& generator : pool)
+                generator = std::make_unique<CompilerGenerator>();
+
+            run_jobs(functions.size(), pool.size(), [&](SizeType job, SizeType worker) { build(*pool[worker], job); });
+
+            if (!kLinkTimeOptimization)
+                run_jobs(functions.size(), pool.size(), [&](SizeType job, SizeType worker) { lower(*pool[worker], job); });
+        }
+        else
+        {
+            for (SizeType job = 0; job < functions.size(); ++job)
+                build(*this, job);
+
+            for (SizeType job = 0; job < functions.size() && !kLinkTimeOptimization; ++job)
+                lower(*this, job);
+        }
+
+        // with -flto the bodies go as generated, ld inlines and lowers them with those of the other units.
+        if (kLinkTimeOptimization)
+        {
+            kState.fModule.fLevel = kOptimizationLevel;
+            kState.fModule.fInlineLimit = kOptimizationLevel > 0 ? kInlineLimit : 0;
+            kState.fModule.fFunctions = std::move(bodies);
+
+            for (auto node : unit)
+            {
+                if (node->fSymbol &&
+                    node->fSymbol->fStatic)
+                    kState.fModule.fLocals.push_back(node->fSymbol->fAsmName);
+            }
+        }
+
+        // a static function left without callers once inlined is not written out,
+        // its data stays, as the copies may still refer to it.
+        std::unordered_map<std::string, SizeType> unused;
+
+        for (SizeType job = 0; inline_calls && job < functions.size(); ++job)
+        {
+            if (unit[functions[job]]->fSymbol->fStatic)
+                unused[unit[functions[job]]->fSymbol->fAsmName] = functions[job];
+        }
+
+        for (SizeType index = 0; index < chunks.size() && !unused.empty(); ++index)
+        {
+            for (auto text : { &chunks[index].fText, &chunks[index].fData })
+            {
+                for (auto& line : *text)
+                {
+                    for (auto& operand : line.fOperands)
+                    {
+                        if (operand.fKind != CxxKit::kAsmOperandSymbol)
+                            continue;
+
+                        auto symbol = std::string_view(operand.fSymbol);
+
+                        if (symbol.starts_with(kAsmImport " "))
+                            symbol.remove_prefix(sizeof(kAsmImport));
+
+                        auto it = unused.find(std::string(symbol));
+
+                        if (it != unused.end() &&
+                            it->second != index)
+                            unused.erase(it);
+                    }
+                }
+            }
+        }
+
+        for (auto& [name, index] : unused)
+            chunks[index].fText.clear();
+
+        auto& lines = kState.fAssembly;
+
+        for (auto& chunk : chunks)
+            std::move(chunk.fText.begin(), chunk.fText.end(), std::back_inserter(lines));
+
+        // data goes after the code, so that no record cuts a function in two.
+        // A pool record is written once, in the first chunk that has it, whatever -j did.
+        std::unordered_set<std::string> pooled;
+
+        for (auto& chunk : chunks)
+        {
+            bool skip = false;
+
+            for (auto& line : chunk.fData)
+            {
+                if (line.fKind == CxxKit::kAsmLineExport)
+                {
+                    auto& symbol = line.fOperands[0].fSymbol;
+                    skip = symbol.starts_with(kAEPoolPrefix) && !pooled.insert(symbol).second;
+                }
+
+                if (!skip)
+                    lines.push_back(std::move(line));
+            }
+        }
+    }
+
+    void CompilerGenerator::AssignSlots(CompilerNode* node)
+    {
+        if (!node)
+            return;
+
+        if (node->fKind == kNodeDeclaration &&
+            node->fSymbol->fStorage == kStorageLocal)
+        {
+            node->fSymbol->fOffset = fFrameSize;
+            fFrameSize += cc_round_word(cc_type_size(node->fSymbol->fType));
+
+            fCode->Local(node->fSymbol->fOffset, cc_type_size(node->fSymbol->fType));
+        }
+
+        for (auto child : node->fChildren)
+            AssignSlots(child);
+    }
+
+    void CompilerGenerator::GenerateFunction(CompilerNode* function, CxxKit::IRFunction& code)
+    {
+        auto body = function->fChildren.back();
+
+        fFunction = function->fSymbol;
+        fCode = &code;
+        fLabelCount = 0;
+
+        // the first parameters come in registers, each gets a home slot first thing.
+        auto params = std::min<SizeType>(fFunction->fType->fParams.size(), kAsmArgRegisterCount);
+
+        fFrameSize = params * kWordSize;
+
+        for (SizeType param = 0; param < params; ++param)
+            code.Local(param * kWordSize, kWordSize);
+
+        AssignSlots(body);
+
+        code.fName = fFunction->fAsmName;
+        code.fInline = fFunction->fInline;
+        code.fUnroll = kUnrollFactor;
+        code.fLocalSize = fFrameSize;
+        code.fLabelPrefix = local_symbol(fFunction->fIndex, "S");
+
+        for (SizeType param = 0; param < params; ++param)
+            code.Store(kAsmArgRegister + param, kIRFrameRegister, param * kWordSize, kWordSize);
+
+        GenerateStatement(body);
+
+        if (body->fChildren.empty() ||
+            body->fChildren.back()->fKind != kNodeReturn)
+        {
+            // falling off main returns 0.
+            if (fFunction->fName == "main")
+                code.Move(kAsmRetRegister, kAsmZeroRegister);
+
+            code.Return();
+        }
+
+        fFunction = nullptr;
+        fCode = nullptr;
+    }
+
+    void CompilerGenerator::LowerFunction(CxxKit::IRFunction& code)
+    {
+        if (kOptimizationLevel > 0)
+            CxxKit::ir_optimize(code, fPasses);
+
+        code.Allocate(kStartUsable, kUsableLimit);
+
+        std::vector<CxxKit::AsmLine> lines;
+        code.Lower(lines);
+
+        // jump tables, with the labels they were left with once optimized.
+        for (auto& instr : code.fCode)
+        {
+            if (instr.fOpcode != CxxKit::kIRJumpTable)
+                continue;
+
+            std::vector<UInt8> image(instr.fTargets.size() * kWordSize, 0);
+            std::vector<std::pair<SizeType, std::string>> relocs;
+
+            for (SizeType index = 0; index < instr.fTargets.size(); ++index)
+                relocs.emplace_back(index * kWordSize, instr.fTargets[index]);
+
+            EmitImage(".data", instr.fSymbol, image, relocs);
+        }
+
+        Emit(CxxKit::AsmLine::Export(".text", code.fName));
+        Emit(CxxKit::AsmLine::Begin());
+
+        for (auto& line : lines)
+            Emit(std::move(line));
+
+        Emit(CxxKit::AsmLine::End());
+        Emit(CxxKit::AsmLine::Blank());
+    }
+
+    void CompilerGenerator::GenerateGlobal(CompilerNode* global)
+    {
+        auto symbol = global->fSymbol;
+
+        if (symbol->fExtern ||
+            fEmitted.count(symbol))
+            return;
+
+        // a tentative definition, the initialized one is emitted instead.
+        if (global->fChildren.empty() &&
+            symbol->fInitialized)
+            return;
+
+        fEmitted.insert(symbol);
+
+        std::vector<UInt8> image(cc_type_size(symbol->fType), 0);
+        std::vector<std::pair<SizeType, std::string>> relocs;
+
+        if (global->fChildren.empty())
+        {
+            EmitImage(".page_zero", symbol->fAsmName, image, relocs);
+            return;
+        }
+
+        BuildImage(symbol->fType, global->fChildren[0], 0, image, relocs);
+        EmitImage(".data", symbol->fAsmName, image, relocs);
+    }
+
+    /// @brief string literals go to the constant pool, each use writes the record,
+    /// Generate keeps the first one of the unit.
+    std::string CompilerGenerator::StringLabel(std::string_view bytes)
+    {
+        std::vector<UInt8> image(bytes.begin(), bytes.end());
+        std::vector<std::pair<SizeType, std::string>> relocs;
+
+        image.push_back(0);
+
+        auto label = pool_symbol(image);
+
+        EmitImage(".data", label, image, relocs);
+
+        return label;
+    }
+
+    void CompilerGenerator::BuildImage(CompilerDataType* type, CompilerNode* init, SizeType offset,
+                                       std::vector<UInt8>& image, std::vector<std::pair<SizeType, std::string>>& relocs)
+    {
+        if (init->fKind == kNodeInitList)
+        {
+            if (type->fKind == kTypeArray)
+            {
+                auto elem_size = cc_type_size(type->fBase);
+
+                for (SizeType i = 0; i < init->fChildren.size() && i < type->fCount; ++i)
+                    BuildImage(type->fBase, init->fChildren[i], offset + i * elem_size, image, relocs);
+            }
+            else if (cc_is_record(type))
+            {
+                auto& fields = type->fRecord->fFields;
+                auto count = type->fKind == kTypeUnion ? std::min<SizeType>(1, fields.size()) : fields.size();
+
+                for (SizeType i = 0; i < init->fChildren.size() && i < count; ++i)
+                    BuildImage(fields[i].fType, init->fChildren[i], offset + fields[i].fOffset, image, relocs);
+            }
+            else if (!init->fChildren.empty())
+            {
+                BuildImage(type, init->fChildren[0], offset, image, relocs);
+            }
+
+            return;
+        }
+
+        if (init->fKind == kNodeString &&
+            type->fKind == kTypeArray)
+        {
+            for (SizeType i = 0; i < init->fText.size() && i < type->fCount; ++i)
+                image[offset + i] = init->fText[i];
+
+            return;
+        }
+
+        Int64 value = 0;
+
+        if (cc_eval_constant(init, value))
+        {
+            for (SizeType i = 0; i < cc_type_size(type); ++i)
+                image[offset + i] = (value >> (i * 8)) & 0xFF;
+
+            return;
+        }
+
+        // CompilerSema made sure it is an address constant otherwise.
+        CompilerNode* base = nullptr;
+        cc_address_constant(init, base);
+
+        relocs.emplace_back(offset, base->fKind == kNodeString ? StringLabel(base->fText) : base->fSymbol->fAsmName);
+    }
+
+    /// @brief write a data record, whole words as qword, labels as relocations.
+    void CompilerGenerator::EmitImage(const std::string& section, const std::string& symbol, std::vector<UInt8>& image,
+                                      std::vector<std::pair<SizeType, std::string>>& relocs)
+    {
+        fData.push_back(CxxKit::AsmLine::Export(section, symbol));
+
+        std::sort(relocs.begin(), relocs.end());
+
+        SizeType reloc = 0;
+        SizeType offset = 0;
+
+        CxxKit::AsmLine line;
+
+        auto flush = [&]() {
+            if (!line.fOperands.empty())
+                fData.push_back(std::move(line));
+
+            line = CxxKit::AsmLine();
+        };
+
+        auto add = [&](const char* width, UInt64 value) {
+            if (line.fName != width)
+            {
+                flush();
+                line = CxxKit::AsmLine::Data(width);
+            }
+
+            line.fOperands.push_back(CxxKit::AsmOperand::Immediate(value));
+        };
+
+        while (offset < image.size())
+        {
+            if (reloc < relocs.size() &&
+                relocs[reloc].first == offset)
+            {
+                flush();
+                fData.push_back(CxxKit::AsmLine::Data("qword"));
+                fData.back().fOperands.push_back(CxxKit::AsmOperand::Symbol(relocs[reloc].second));
+
+                offset += kWordSize;
+                ++reloc;
+
+                continue;
+            }
+
+            bool whole_word = offset % kWordSize == 0 &&
+                offset + kWordSize <= image.size() &&
+                (reloc >= relocs.size() || relocs[reloc].first >= offset + kWordSize);
+
+            if (whole_word)
+            {
+                UInt64 word = 0;
+
+                for (SizeType i = 0; i < kWordSize; ++i)
+                    word |= (UInt64)image[offset + i] << (i * 8);
+
+                add("qword", word);
+                offset += kWordSize;
+            }
             else
             {
-                continue;
-            }
-
-            // dealing with pointer
-            if (buf.find("*") != std::string::npos)
-            {
-                buf.erase(buf.find("*"), 1);
+                add("byte", image[offset]);
+                ++offset;
             }
 
-            std::string cond = buf.substr(buf.find("(") + 1, buf.find(",") - 1);
-            cond.erase(cond.find(","));
+            // keep lines short.
+            if (line.fOperands.size() >= 8)
+                flush();
+        }
 
-            std::string cond2 = buf.substr(buf.find(",") + 1, buf.find(")") - 1);
-            cond2.erase(cond2.find(")"));
+        flush();
+        fData.push_back(CxxKit::AsmLine::Blank());
+    }
 
-            substr.replace(substr.find("%s"), 2, cond);
-            substr.replace(substr.find("%s2"), 3, cond2);
-            
-            buf.replace(buf.find(cond), cond.size(), "r15");
-            buf.replace(buf.find(cond2), cond2.size(), "r16");
+    /////////////////////////////////////////////////////////////////////////////////////////
 
-            substr += buf;
+    // @brief Statements.
 
-            syntax_tree.fUserValue = substr + "\n";
+    /////////////////////////////////////////////////////////////////////////////////////////
 
-            kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
+    void CompilerGenerator::GenerateStatement(CompilerNode* stmt)
+    {
+        switch (stmt->fKind)
+        {
+        case kNodeBlock:
+        {
+            for (auto child : stmt->fChildren)
+                GenerateStatement(child);
 
             break;
         }
-
-        // Parse expressions and instructions here.
-        // what does this mean?
-        // we encounter an assignment, or we reached the end of an expression.
-        if (_text[text_index] == '=' ||
-            _text[text_index] == ';')
+        case kNodeDeclaration:
         {
-            if (function_found)
-                continue;
-
-            if (_text[text_index] == ';' &&
-                kInStruct)
-                continue;
+            if (!stmt->fChildren.empty())
+                GenLocalInit(stmt->fSymbol->fType, stmt->fChildren[0], stmt->fSymbol->fOffset);
 
-            if (_text.find("typedef ") != std::string::npos)
-                continue;
+            break;
+        }
+        case kNodeExpression:
+        {
+            GenExpr(stmt->fChildren[0]);
+            break;
+        }
+        case kNodeIf:
+        {
+            std::string else_label;
 
-            if (_text[text_index] == '=' &&
-                kInStruct)
-            {
-                continue;
-            }
+            GenBranch(stmt->fChildren[0], else_label, false);
+            GenerateStatement(stmt->fChildren[1]);
 
-            if (_text[text_index+1] == '=' ||
-                _text[text_index-1] == '!' ||
-                _text[text_index-1] == '<' ||
-                _text[text_index-1] == '>')
+            if (stmt->fChildren.size() > 2)
             {
-                continue;
-            }
-
-            std::string substr;
+                std::string end_label;
 
-            if (_text.find('=') != std::string::npos &&
-                kInBraces)
-            {
-                if (_text.find("*") != std::string::npos)
-                {
-                    if (_text.find("=") > _text.find("*"))
-                        substr += "\tlda ";
-                    else
-                        substr += "\tldw ";
-                }
-                else
-                {
-                    substr += "\tldw ";
-                }
+                fCode->Jump(UseLabel(end_label));
+                PlaceLabel(else_label);
+                GenerateStatement(stmt->fChildren[2]);
+                PlaceLabel(end_label);
             }
-            else if (_text.find('=') != std::string::npos &&
-                !kInBraces)
+            else
             {
-                substr += "stw __export .data ";
+                PlaceLabel(else_label);
             }
 
-            int first_encountered = 0;
-
-            std::string str_name;
+            break;
+        }
+        case kNodeWhile:
+        {
+            auto cond_label = MakeLabel();
 
-            for (size_t text_index_2 = 0; text_index_2 < _text.size(); ++text_index_2)
-            {
-                if (_text[text_index_2] == '\"')
-                {
-                    ++text_index_2;
+            fCode->Label(cond_label);
 
-                    // want to add this, so that the parser recognizes that this is a string.
-                    substr += '"';
+            // the exit label is shared by the condition and by 'break'.
+            fBreakLabels.emplace_back();
+            fContinueLabels.push_back(cond_label);
 
-                    for (; text_index_2 < _text.size(); ++text_index_2)
-                    {
-                        if (_text[text_index_2] == '\"')
-                            break;
+            GenBranch(stmt->fChildren[0], fBreakLabels.back(), false);
+            GenerateStatement(stmt->fChildren[1]);
 
-                        kLatestVar += _text[text_index_2];
-                        substr += _text[text_index_2];
-                    }
-                }
+            fCode->Jump(cond_label);
+            PlaceLabel(fBreakLabels.back());
 
-                if (_text[text_index_2] == '{' ||
-                    _text[text_index_2] == '}')
-                    continue;
+            fBreakLabels.pop_back();
+            fContinueLabels.pop_back();
 
-                if (_text[text_index_2] == ';')
-                {
-                    break;
-                }
+            break;
+        }
+        case kNodeDoWhile:
+        {
+            auto body_label = MakeLabel();
 
-                if (_text[text_index_2] == ' ' ||
-                    _text[text_index_2] == '\t')
-                {
-                    if (first_encountered != 2)
-                    {
-                        if (_text[text_index] != '=' &&
-                            substr.find("__export .data") == std::string::npos &&
-                            !kInStruct &&
-                            _text.find("struct") == std::string::npos &&
-                            _text.find("extern") == std::string::npos &&
-                             _text.find("union") == std::string::npos &&
-                             _text.find("typedef") == std::string::npos)
-                            substr += "__export .data ";
-                    }
+            fCode->Label(body_label);
 
-                    ++first_encountered;
+            fBreakLabels.emplace_back();
+            fContinueLabels.emplace_back();
 
-                    continue;
-                }
+            GenerateStatement(stmt->fChildren[0]);
 
-                if (_text[text_index_2] == '=')
-                {
-                    if (!kInBraces)
-                    {
-                        substr.replace(substr.find("__export .data"), strlen("__export .data"), "__export .page_zero ");
-                    }
+            PlaceLabel(fContinueLabels.back());
+            GenBranch(stmt->fChildren[1], body_label, true);
+            PlaceLabel(fBreakLabels.back());
 
-                    substr += ",";
-                    continue;
-                }
+            fBreakLabels.pop_back();
+            fContinueLabels.pop_back();
 
-                kLatestVar += _text[text_index_2];
-                substr += _text[text_index_2];
+            break;
+        }
+        case kNodeFor:
+        {
+            if (auto init = stmt->fChildren[0])
+            {
+                if (init->fKind == kNodeBlock)
+                    GenerateStatement(init);
+                else
+                    GenExpr(init);
             }
 
-            for (auto& clType : kCompilerTypes)
-            {
-                if (substr.find(clType.fName) != std::string::npos)
-                {
-                    if (substr.find(clType.fName) > substr.find('"'))
-                        continue;
+            auto cond_label = MakeLabel();
 
-                    substr.erase(substr.find(clType.fName), clType.fName.size());
-                }
-                else if (substr.find(clType.fValue) != std::string::npos)
-                {
-                    if (substr.find(clType.fValue) > substr.find('"'))
-                        continue;
+            fCode->Label(cond_label);
 
-                    if (clType.fName == "const")
-                        continue;
+            fBreakLabels.emplace_back();
+            fContinueLabels.emplace_back();
 
-                    substr.erase(substr.find(clType.fValue), clType.fValue.size());
-                }
-            }
+            if (stmt->fChildren[1])
+                GenBranch(stmt->fChildren[1], fBreakLabels.back(), false);
 
-            if (substr.find("struct") != std::string::npos)
-            {
-                substr.replace(substr.find("struct"), strlen("struct"), "ldw ");
-                substr += ", 0";
-            }
+            GenerateStatement(stmt->fChildren[3]);
 
-            if (substr.find("union") != std::string::npos)
-            {
-                substr.replace(substr.find("union"), strlen("union"), "ldw ");
-                substr += ", 0";
-            }
+            PlaceLabel(fContinueLabels.back());
 
-            if (substr.find("static") != std::string::npos)
-            {
-                substr.replace(substr.find("static"), strlen("static"), "__export .data ");
-            }
-            else if (substr.find("extern") != std::string::npos)
-            {
-                substr.replace(substr.find("extern"), strlen("extern"), "__import ");
+            if (stmt->fChildren[2])
+                GenExpr(stmt->fChildren[2]);
 
-                if (substr.find("__export .data") != std::string::npos)
-                    substr.erase(substr.find("__export .data"), strlen("__export .data"));
-            }
-            
-            auto var_to_find = std::find_if(kCompilerVariables.cbegin(), kCompilerVariables.cend(), [&](detail::CompilerType type) {
-                return type.fName.find(substr) != std::string::npos;
-            });
+            fCode->Jump(cond_label);
+            PlaceLabel(fBreakLabels.back());
 
-            std::string reg = kAsmRegisterPrefix;
-            reg += std::to_string(kRegisterCounter);
+            fBreakLabels.pop_back();
+            fContinueLabels.pop_back();
 
-            if (var_to_find == kCompilerVariables.cend())
+            break;
+        }
+        case kNodeReturn:
+        {
+            if (!stmt->fChildren.empty())
             {
-                ++kRegisterCounter;
+                auto value = stmt->fChildren[0];
+                Int64 constant = 0;
 
-                kState.kStackFrame.push_back({ .fName = substr, .fRegister = reg });
-                kCompilerVariables.push_back({ .fName = substr });
+                if (cc_eval_constant(value, constant))
+                    fCode->Constant(kAsmRetRegister, constant);
+                else
+                    fCode->Move(kAsmRetRegister, GenExpr(value));
             }
-            
-            syntax_tree.fUserValue += substr;
-            kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
 
-            if (_text[text_index] == '=')
-                break;
+            fCode->Return();
+            break;
         }
-
-        // function handler.
-
-        if (_text[text_index] == '(' &&
-            !function_found)
+        case kNodeBreak:
         {
-            std::string substr;
-            std::string args_buffer;
-            std::string args;
-
-            bool type_crossed = false;
+            fCode->Jump(UseLabel(fBreakLabels.back()));
+            break;
+        }
+        case kNodeContinue:
+        {
+            fCode->Jump(UseLabel(fContinueLabels.back()));
+            break;
+        }
+        case kNodeSwitch:
+        {
+            auto value = GenExpr(stmt->fChildren[0]);
 
-            for (size_t idx = _text.find('(') + 1; idx < _text.size(); ++idx)
-            {
-                if (_text[idx] == ',')
-                    continue;
+            std::vector<CompilerNode*> labels;
+            collect_cases(stmt->fChildren[1], labels);
 
-                if (_text[idx] == ' ')
-                    continue;
+            fBreakLabels.emplace_back();
 
-                if (_text[idx] == ')')
-                    break;
-            }
+            std::vector<std::pair<Int64, std::string>> cases;
+            std::string fallback;
 
-            for (char substr_first_index : _text)
+            for (auto label : labels)
             {
-                args_buffer += substr_first_index;
-
-                if (substr_first_index == ';')
-                {
-                    args_buffer = args_buffer.erase(0, args_buffer.find('('));
-                    args_buffer = args_buffer.erase(args_buffer.find(';'), 1);
-                    args_buffer = args_buffer.erase(args_buffer.find(')'), 1);
-                    args_buffer = args_buffer.erase(args_buffer.find('('), 1);
+                auto& name = fCaseLabels[label] = MakeLabel();
 
-                    if (!args_buffer.empty())
-                        args += "\tpsh ";
-
-                    while (args_buffer.find(',') != std::string::npos)
-                    {
-                        args_buffer.replace(args_buffer.find(','), 1, "\n\tpsh ");
-                    }
-
-                    args += args_buffer;
-                    args += "\n\tjlr __import ";
-                }
+                if (label->fKind == kNodeDefault)
+                    fallback = name;
+                else
+                    cases.emplace_back(label->fValue, name);
             }
 
-            for (char _text_i : _text)
-            {
-                if (_text_i == '\t' ||
-                    _text_i == ' ')
-                {
-                    if (!type_crossed)
-                    {
-                        substr.clear();
-                        type_crossed = true;
-                    }
-
-                    continue;
-                }
-
-                if (_text_i == '(')
-                    break;
+            // without a default, no case matching leaves the switch.
+            if (fallback.empty())
+                fallback = UseLabel(fBreakLabels.back());
 
-                substr += _text_i;
-            }
-            
-            if (kInBraces)
-            {
-                syntax_tree.fUserValue = args;
+            std::sort(cases.begin(), cases.end());
 
-                syntax_tree.fUserValue += substr;
+            GenSwitch(value, cases, 0, cases.size(), fallback, INT64_MIN, INT64_MAX);
+            GenerateStatement(stmt->fChildren[1]);
 
-                kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
+            PlaceLabel(fBreakLabels.back());
+            fBreakLabels.pop_back();
 
-                function_found = true;
-            }
-            else
-            {
-                syntax_tree.fUserValue.clear();
+            break;
+        }
+        case kNodeCase:
+        case kNodeDefault:
+        {
+            fCode->Label(fCaseLabels[stmt]);
+            GenerateStatement(stmt->fChildren[0]);
 
-                syntax_tree.fUserValue += "__export .text ";
+            break;
+        }
+        default:
+            break;
+        }
+    }
 
-                syntax_tree.fUserValue += substr;
-                syntax_tree.fUserValue += "\n";
+    /// @brief jump to the label of cases[first, last) value matches, or to fallback.
+    /// value is known to lie in [low, high], so that checks the path already made are not made again.
+    void CompilerGenerator::GenSwitch(Int32 value, const std::vector<std::pair<Int64, std::string>>& cases, SizeType first,
+                                      SizeType last, const std::string& fallback, Int64 low, Int64 high)
+    {
+        auto count = last - first;
 
-                kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
+        if (count == 0)
+        {
+            fCode->Jump(fallback);
+            return;
+        }
 
-                function_found = true;
-            }
+        auto min = cases[first].first;
+        auto max = cases[last - 1].first;
 
-            kCompilerFunctions.push_back(_text);
+        if (count == 1 &&
+            low == min &&
+            high == max)
+        {
+            fCode->Jump(cases[first].second);
+            return;
         }
 
-        if (_text[text_index] == 's')
+        if (count <= kSwitchLinear)
         {
-            if (_text.find("struct") != text_index)
-                continue;
+            for (auto index = first; index < last; ++index)
+                fCode->Branch("beq", value, GenConstant(cases[index].first), cases[index].second);
 
-            if (_text.find(";") == std::string::npos)
-                kInStruct = true;
+            fCode->Jump(fallback);
+            return;
         }
 
-        if (_text[text_index] == 'u')
+        auto span = (UInt64)max - (UInt64)min;
+
+        if (count < kSwitchTable ||
+            span >= count * kSwitchDensity)
         {
-            if (_text.find("union") != text_index)
-                continue;
+            // a decision tree, the right half takes the middle case.
+            auto middle = first + count / 2;
+            auto pivot = cases[middle].first;
+            auto right = MakeLabel();
 
-            if (_text.find(";") == std::string::npos)
-                kInStruct = true;
-        }
+            fCode->Branch("bge", value, GenConstant(pivot), right);
+            GenSwitch(value, cases, first, middle, fallback, low, pivot - 1);
 
-        if (_text[text_index] == 'e')
-        {
-            if (_text.find("enum") != text_index)
-                continue;
+            fCode->Label(right);
+            GenSwitch(value, cases, middle, last, fallback, pivot, high);
 
-            if (_text.find(";") == std::string::npos)
-                kInStruct = true;
+            return;
         }
 
-        if (_text[text_index] == '-' &&
-            _text[text_index+1] == '-')
-        {
-            _text = _text.replace(_text.find("--"), strlen("--"), "");
+        // a jump table, entries no case has go to fallback.
+        if (low < min)
+            fCode->Branch("bl", value, GenConstant(min), fallback);
 
-            for (int _text_i = 0; _text_i < _text.size(); ++_text_i)
-            {
-                if (_text[_text_i] == '\t' ||
-                    _text[_text_i] == ' ')
-                    _text.erase(_text_i, 1);
-            }
+        if (high > max)
+            fCode->Branch("bg", value, GenConstant(max), fallback);
 
-            syntax_tree.fUserValue += "dec ";
-            syntax_tree.fUserValue += _text;
+        std::vector<std::string> targets(span + 1, fallback);
 
-            kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-            break;
-        }
+        for (auto index = first; index < last; ++index)
+            targets[(UInt64)cases[index].first - (UInt64)min] = cases[index].second;
 
-        // while loop
-        if (_text[text_index] == 'w')
+        auto index = value;
+
+        if (min != 0)
         {
-            if (_text.find("while") == std::string::npos)
-                continue;
+            index = NewReg();
+            // wraps for a min of INT64_MIN, which the subtraction does as well.
+            fCode->ArithImm(index, value, (Int64)(0ULL - (UInt64)min));
+        }
 
-            if (_text.find("while") != text_index)
-                continue;
+        auto offset = NewReg();
+        fCode->Arith("shl", offset, index, GenConstant(3));
 
-            syntax_tree.fUserValue = "jrl [r32+0x01]";
+        auto table = MakeLabel();
+        auto base = NewReg();
+        fCode->Address(base, table);
 
-            std::string symbol_loop = "_loop_while_";
-            symbol_loop += std::to_string(time_off.raw);
-            symbol_loop += " ";
+        auto entry = NewReg();
+        fCode->Arith("add", entry, base, offset);
 
-            syntax_tree.fUserValue = "beq ";
-            syntax_tree.fUserValue += kState.kStackFrame[kState.kStackFrame.size() - 2].fRegister;
-            syntax_tree.fUserValue += ",";
-            syntax_tree.fUserValue += kState.kStackFrame[kState.kStackFrame.size() - 1].fRegister;
-            syntax_tree.fUserValue += ", __end%s\njb __continue%s\n__export .text __end%s\nbegin\njlr r31\nend\nvoid __export .text __continue%s\nbegin\njb _L";
-            syntax_tree.fUserValue += std::to_string(kBracesCount + 1) + "_" + std::to_string(time_off.raw);
-            syntax_tree.fUserValue += "\nend\nend";
+        auto target = NewReg();
+        fCode->Load(target, entry, 0, kWordSize);
 
-            while (syntax_tree.fUserValue.find("%s") != std::string::npos)
-            {
-                syntax_tree.fUserValue.replace(syntax_tree.fUserValue.find("%s"), strlen("%s"), symbol_loop);
-            }
+        fCode->JumpTable(target, table, std::move(targets));
+    }
 
-            kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
+    void CompilerGenerator::GenZero(Int64 offset, SizeType size)
+    {
+        SizeType done = 0;
 
-            kOnWhileLoop = true;
+        for (; done + kWordSize <= size; done += kWordSize)
+            fCode->Store(kAsmZeroRegister, kIRFrameRegister, offset + done, kWordSize);
 
-            break;
-        }
+        for (; done < size; ++done)
+            fCode->Store(kAsmZeroRegister, kIRFrameRegister, offset + done, 1);
+    }
 
-        if (_text[text_index] == 'f')
+    void CompilerGenerator::GenLocalInit(CompilerDataType* type, CompilerNode* init, Int64 offset, bool zeroed)
+    {
+        if (init->fKind == kNodeInitList ||
+            (init->fKind == kNodeString && type->fKind == kTypeArray))
         {
-            if (_text.find("for") == std::string::npos)
-                continue;
+            // everything not listed is zero.
+            if (!zeroed)
+                GenZero(offset, cc_type_size(type));
 
-            if (_text.find("for") != text_index)
-                continue;
+            if (init->fKind == kNodeString)
+            {
+                for (SizeType i = 0; i < init->fText.size() && i < type->fCount; ++i)
+                {
+                    if (init->fText[i] == 0)
+                        continue;
 
-            syntax_tree.fUserValue = "jrl [r32+0x1]\n";
+                    fCode->Store(GenConstant((UInt8)init->fText[i]), kIRFrameRegister, offset + i, 1);
+                }
 
-            // actually set registers now.
+                return;
+            }
 
-            auto expr = _text.substr(_text.find("for") + strlen("for"));
+            if (type->fKind == kTypeArray)
+            {
+                auto elem_size = cc_type_size(type->fBase);
 
-            kLatestVar.clear();
+                for (SizeType i = 0; i < init->fChildren.size() && i < type->fCount; ++i)
+                    GenLocalInit(type->fBase, init->fChildren[i], offset + i * elem_size, true);
+            }
+            else if (cc_is_record(type))
+            {
+                auto& fields = type->fRecord->fFields;
+                auto count = type->fKind == kTypeUnion ? std::min<SizeType>(1, fields.size()) : fields.size();
 
-            kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
+                for (SizeType i = 0; i < init->fChildren.size() && i < count; ++i)
+                    GenLocalInit(fields[i].fType, init->fChildren[i], offset + fields[i].fOffset, true);
+            }
+            else if (!init->fChildren.empty())
+            {
+                GenLocalInit(type, init->fChildren[0], offset, true);
+            }
 
-            kOnForLoop = true;
-            break;
+            return;
         }
 
-        if (_text[text_index] == '+' &&
-            _text[text_index+1] == '+')
-        {
-            _text = _text.replace(_text.find("++"), strlen("++"), "");
+        auto value = GenExpr(init);
 
-            for (int _text_i = 0; _text_i < _text.size(); ++_text_i)
-            {
-                if (_text[_text_i] == '\t' ||
-                    _text[_text_i] == ' ')
-                    _text.erase(_text_i, 1);
-            }
+        if (cc_is_record(type))
+            GenCopy(cc_type_size(type), { kIRFrameRegister, offset }, value);
+        else
+            GenStore(type, value, { kIRFrameRegister, offset });
+    }
 
-            syntax_tree.fUserValue += "add ";
-            syntax_tree.fUserValue += _text;
+    /////////////////////////////////////////////////////////////////////////////////////////
 
-            if (syntax_tree.fUserValue.find(";") != std::string::npos)
-                syntax_tree.fUserValue.erase(syntax_tree.fUserValue.find(";"), 1);
+    // @brief Expressions, each value is computed in a fresh virtual register.
 
-            kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////
 
-        if (_text[text_index] == '}')
+    CompilerAddress CompilerGenerator::GenAddr(CompilerNode* expr)
+    {
+        switch (expr->fKind)
+        {
+        case kNodeVariable:
         {
-            kRegisterCounter = kStartUsable;
+            auto symbol = expr->fSymbol;
 
-            --kBracesCount;
+            if (symbol->fStorage == kStorageLocal)
+                return { kIRFrameRegister, (Int64)symbol->fOffset };
 
-            if (kBracesCount < 1)
+            // parameters passed in registers live in their home slot.
+            if (symbol->fStorage == kStorageParam)
             {
-                kInBraces = false;
-                kBracesCount = 0;
+                if (symbol->fOffset < kAsmArgRegisterCount)
+                    return { kIRFrameRegister, (Int64)symbol->fOffset * kWordSize };
+
+                return { kIRArgRegister, (Int64)(symbol->fOffset - kAsmArgRegisterCount) * kWordSize };
             }
 
-            if (kInStruct)
-                kInStruct = false;
+            auto reg = NewReg();
+            fCode->Address(reg, symbol_ref(symbol));
 
-            if (!kInBraces)
-            {
-                syntax_tree.fUserValue += kAddIfAnyEnd;
-                syntax_tree.fUserValue = "\nend ";
+            return { reg, 0 };
+        }
+        case kNodeString:
+        {
+            auto reg = NewReg();
+            fCode->Address(reg, StringLabel(expr->fText));
 
-                kAddIfAnyEnd.clear();
+            return { reg, 0 };
+        }
+        case kNodeDeref:
+        {
+            return { GenExpr(expr->fChildren[0]), 0 };
+        }
+        case kNodeMember:
+        {
+            CompilerAddress addr;
 
-                kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-            }
+            if (expr->fValue)
+                addr = { GenExpr(expr->fChildren[0]), 0 };
             else
-            {
-                if (kOnWhileLoop ||
-                    kOnForLoop)
-                {
-                    if (kOnForLoop)
-                        kOnForLoop = false;
-
-                    if (kOnWhileLoop)
-                        kOnWhileLoop = false;
-
-                    std::string symbol_loop = "_loop_for_";
-                    symbol_loop += std::to_string(time_off.raw);
-                    symbol_loop += " ";
-
-                    syntax_tree.fUserValue = "beq ";
-                    syntax_tree.fUserValue += kState.kStackFrame[kState.kStackFrame.size() - 2].fRegister;
-                    syntax_tree.fUserValue += ",";
-                    syntax_tree.fUserValue += kState.kStackFrame[kState.kStackFrame.size() - 1].fRegister;
-                    syntax_tree.fUserValue += ", __end%s\njb __continue%s\n__export .text __end%s\nbegin\njlr r31\nend\nvoid __export .text __continue%s\nbegin\njb _L";
-                    syntax_tree.fUserValue += std::to_string(kBracesCount + 1) + "_" + std::to_string(time_off.raw);
-                    syntax_tree.fUserValue += "\nend\nend";
+                addr = GenAddr(expr->fChildren[0]);
 
-                    while (syntax_tree.fUserValue.find("%s") != std::string::npos)
-                    {
-                        syntax_tree.fUserValue.replace(syntax_tree.fUserValue.find("%s"), strlen("%s"), symbol_loop);
-                    }
+            addr.fOffset += expr->fField->fOffset;
 
-                    kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-                }
-                else
-                {
-                    syntax_tree.fUserValue = "\nend ";
-                    kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-                }
-            }
+            return addr;
+        }
+        default:
+        {
+            // rejected by CompilerSema.
+            return { NewReg(), 0 };
+        }
         }
-
-        syntax_tree.fUserValue.clear();
     }
 
-    syntax_tree.fUserValue = "\n";
-    kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
-}
+    /// @brief turn an address into a pointer value held in a register.
+    Int32 CompilerGenerator::GenMaterialize(const CompilerAddress& addr)
+    {
+        auto reg = NewReg();
 
-static bool kShouldHaveBraces = false;
-static std::string kFnName;
+        if (addr.fBase < 0)
+        {
+            fCode->FrameAddress(reg, addr.fBase, addr.fOffset);
+            return reg;
+        }
 
-std::string CompilerBackendClang::Check(const char* text, const char* file)
-{
-    std::string err_str;
-    std::string ln = text;
+        if (addr.fOffset == 0)
+            return addr.fBase;
 
-    if (ln.empty())
-    {
-        return err_str;
+        fCode->ArithImm(reg, addr.fBase, addr.fOffset);
+
+        return reg;
     }
 
-    bool non_ascii_found = false;
+    Int32 CompilerGenerator::GenLoad(CompilerDataType* type, const CompilerAddress& addr)
+    {
+        auto reg = NewReg();
+        fCode->Load(reg, addr.fBase, addr.fOffset, type_width(type));
 
-    for (int i = 0; i < ln.size(); ++i) {
-        if (isalnum(ln[i]))
-        {
-            non_ascii_found = true;
-            break;
-        }
+        return reg;
     }
 
-    if (kShouldHaveBraces &&
-        ln.find('{') != std::string::npos) {
-        kShouldHaveBraces = false;
+    void CompilerGenerator::GenStore(CompilerDataType* type, Int32 value, const CompilerAddress& addr)
+    {
+        fCode->Store(value, addr.fBase, addr.fOffset, type_width(type));
     }
 
-    if (!non_ascii_found)
-        return err_str;
-
-    size_t string_index = 1UL;
-
-    if (ln.find('\'') != std::string::npos)
+    void CompilerGenerator::GenCopy(SizeType size, const CompilerAddress& dst, Int32 src)
     {
-        string_index = ln.find('\'') + 1;
+        SizeType offset = 0;
 
-        for (; string_index < ln.size(); ++string_index)
+        for (; offset + kWordSize <= size; offset += kWordSize)
         {
-            if (ln[string_index] == '\'')
-            {
-                if (ln[string_index + 1] != ';')
-                {
-                    ln.erase(string_index, 1);
-                }
+            auto word = NewReg();
 
-                return err_str;
-            }
+            fCode->Load(word, src, offset, kWordSize);
+            fCode->Store(word, dst.fBase, dst.fOffset + offset, kWordSize);
         }
-    }
-    else if (ln.find('"') != std::string::npos)
-    {
-        string_index = ln.find('"') + 1;
 
-        for (; string_index < ln.size(); ++string_index)
+        // a record of bytes only may end anywhere.
+        for (; offset < size; ++offset)
         {
-            if (ln[string_index] == '"')
-            {
-                if (ln[string_index + 1] != ';')
-                {
-                    ln.erase(string_index, 1);
-                }
-                else
-                {
-                    break;
-                }
-            }
+            auto byte = NewReg();
+
+            fCode->Load(byte, src, offset, 1);
+            fCode->Store(byte, dst.fBase, dst.fOffset + offset, 1);
         }
     }
-    else if (ln.find('"') == std::string::npos &&
-            ln.find('\'') == std::string::npos)
+
+    Int32 CompilerGenerator::GenScale(Int32 reg, SizeType size)
     {
-        std::vector<std::string> forbidden_words;
+        if (size == 1)
+            return reg;
 
-        forbidden_words.push_back("\\");
-        forbidden_words.push_back("?");
-        forbidden_words.push_back("@");
-        forbidden_words.push_back("~");
-        forbidden_words.push_back("::");
-        forbidden_words.push_back("/*");
-        forbidden_words.push_back("*/");
+        auto scaled = NewReg();
 
-        // add them to avoid stupid mistakes.
-        forbidden_words.push_back("namespace");
-        forbidden_words.push_back("class");
-        forbidden_words.push_back("extern \"C\"");
+        fCode->Arith("mul", scaled, reg, GenConstant(size));
 
-        for (auto& forbidden : forbidden_words)
-        {
-            if (ParserKit::find_word(ln, forbidden))
-            {
-                err_str += "\nForbidden character detected: ";
-                err_str += forbidden;
+        return scaled;
+    }
 
-                return err_str;
-            }
-        }
+    Int32 CompilerGenerator::GenConstant(Int64 value)
+    {
+        auto reg = NewReg();
+        fCode->Constant(reg, value);
+
+        return reg;
     }
 
-    struct CompilerVariableRange final
+    /// @brief 1 if the comparison holds, else 0.
+    Int32 CompilerGenerator::GenCompare(Int32 op, Int32 lhs, Int32 rhs)
     {
-        std::string fBegin;
-        std::string fEnd;
-    };
+        auto label = MakeLabel();
+        auto reg = NewReg();
 
-    const std::vector<CompilerVariableRange> variables_list = {
-        { .fBegin = "static ", .fEnd = "="}, 
-        { .fBegin = "=", .fEnd = ";"},
-        { .fBegin = "if(",  .fEnd = "="},
-        { .fBegin = "if (", .fEnd = "="},
-        { .fBegin = "if(",  .fEnd = "<"},
-        { .fBegin = "if (", .fEnd = "<"},
-        { .fBegin = "if(",  .fEnd = ">"},
-        { .fBegin = "if (", .fEnd = ">"},
-        { .fBegin = "if(",  .fEnd = ")"},
-        { .fBegin = "if (", .fEnd = ")"},
-
-        { .fBegin = "else(",  .fEnd = "="},
-        { .fBegin = "else (", .fEnd = "="},
-        { .fBegin = "else(",  .fEnd = "<"},
-        { .fBegin = "else (", .fEnd = "<"},
-        { .fBegin = "else(",  .fEnd = ">"},
-        { .fBegin = "else (", .fEnd = ">"},
-        { .fBegin = "else(",  .fEnd = ")"},
-        { .fBegin = "else (", .fEnd = ")"},
-    };
+        fCode->Constant(reg, 1);
+        fCode->Branch(branch_mnemonic(op, false), lhs, rhs, label);
+        fCode->Constant(reg, 0);
+        fCode->Label(label);
+
+        return reg;
+    }
 
-    for (auto& variable : variables_list)
+    Int32 CompilerGenerator::GenExpr(CompilerNode* expr)
     {
-        if (ln.find(variable.fBegin) != std::string::npos)
+        switch (expr->fKind)
         {
-            string_index = ln.find(variable.fBegin) + variable.fBegin.size();
+        case kNodeNumber:
+        {
+            return GenConstant(expr->fValue);
+        }
+        case kNodeString:
+        case kNodeVariable:
+        case kNodeDeref:
+        case kNodeMember:
+        {
+            if (expr->fKind == kNodeDeref &&
+                expr->fType->fKind == kTypeFunction)
+                return GenExpr(expr->fChildren[0]);
 
-            while (ln[string_index] == ' ')
-                ++string_index;
+            auto addr = GenAddr(expr);
 
-            std::string keyword;
+            // arrays, records and functions stand for their address.
+            if (!cc_is_scalar(expr->fType))
+                return GenMaterialize(addr);
 
-            for (; string_index < ln.size(); ++string_index)
-            {
-                if (ln[string_index] == variable.fEnd[0])
-                {
-                    std::string varname = "";
+            return GenLoad(expr->fType, addr);
+        }
+        case kNodeAddress:
+        {
+            auto operand = expr->fChildren[0];
+
+            if (operand->fKind == kNodeDeref)
+                return GenExpr(operand->fChildren[0]);
 
-                    for (size_t index_keyword = ln.find(' '); ln[index_keyword] != variable.fBegin[0]; 
-                        ++index_keyword)
-                    {
-                        if (ln[index_keyword] == ' ')
-                        {
-                            continue;
-                        }
+            return GenMaterialize(GenAddr(operand));
+        }
+        case kNodeUnary:
+        {
+            auto operand = GenExpr(expr->fChildren[0]);
 
-                        if (isdigit(ln[index_keyword]))
-                        {
-                            goto cc_next_loop;
-                        }
+            if (expr->fOp == kOpPlus)
+                return operand;
 
-                        varname += ln[index_keyword];
-                    }
-                    
-                    if (varname.find(' ') != std::string::npos)
-                    {
-                        varname.erase(0, varname.find(' '));
+            if (expr->fOp == kOpLogicalNot)
+                return GenCompare(kOpEq, operand, kAsmZeroRegister);
 
-                        if (variable.fBegin == "extern")
-                        {
-                            varname.erase(0, varname.find(' '));
-                        }
-                    }
+            auto reg = NewReg();
 
-                    std::string reg = kAsmRegisterPrefix;
-                    reg += std::to_string(kRegisterCounter);
-                    
-                    kCompilerVariables.push_back({ .fValue = varname });
-                    goto cc_check_done;
-                }
+            fCode->Unary(expr->fOp == kOpNeg ? "neg" : "not", reg, operand);
 
-                keyword.push_back(ln[string_index]);
-            }
-            
-            goto cc_next_loop;
+            return reg;
+        }
+        case kNodeCast:
+        {
+            auto operand = GenExpr(expr->fChildren[0]);
 
-        cc_check_done:
+            if (expr->fType->fKind == kTypeBool)
+                return GenCompare(kOpNe, operand, kAsmZeroRegister);
 
-            // skip digit value.
-            if (isdigit(keyword[0]) ||
-                keyword[0] == '"')
+            if (cc_type_size(expr->fType) == 1 &&
+                (is_address(expr->fChildren[0]->fType) || cc_type_size(expr->fChildren[0]->fType) > 1))
             {
-                goto cc_next_loop;
-            }
+                auto reg = NewReg();
 
-            while (keyword.find(' ') != std::string::npos)
-                keyword.erase(keyword.find(' '), 1);
+                fCode->Arith("and", reg, operand, GenConstant(255));
 
-            for (auto& var : kCompilerVariables)
-            {
-                if (var.fValue.find(keyword) != std::string::npos)
-                {
-                    err_str.clear();
-                    goto cc_next;
-                }
+                return reg;
             }
 
-            for (auto& fn : kCompilerFunctions)
-            {
-                if (fn.find(keyword[0]) != std::string::npos)
-                {
-                    auto where_begin = fn.find(keyword[0]);
-                    auto keyword_begin = 0UL;
-                    auto failed = false;
+            return operand;
+        }
+        case kNodeBinary:
+        {
+            return GenBinary(expr);
+        }
+        case kNodeLogical:
+        {
+            std::string else_label;
+            auto end_label = MakeLabel();
+            auto reg = NewReg();
 
-                    for (; where_begin < keyword.size(); ++where_begin)
-                    {
-                        if (fn[where_begin] == '(' &&
-                            keyword[keyword_begin] == '(')
-                            break;
+            GenBranch(expr, else_label, false);
 
-                        if (fn[where_begin] != keyword[keyword_begin])
-                        {
-                            failed = true;
-                            break;
-                        }
+            fCode->Constant(reg, 1);
+            fCode->Jump(end_label);
+            PlaceLabel(else_label);
+            fCode->Constant(reg, 0);
+            fCode->Label(end_label);
 
-                        ++keyword_begin;
-                    }
+            return reg;
+        }
+        case kNodeTernary:
+        {
+            std::string else_label;
+            auto end_label = MakeLabel();
+            auto reg = NewReg();
 
-                    if (!failed)
-                    {
-                        err_str.clear();
-                        goto cc_next;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                }
-            }
+            GenBranch(expr->fChildren[0], else_label, false);
 
-cc_error_value:
-            if (keyword.find("->") != std::string::npos)
-                return err_str;
+            fCode->Move(reg, GenExpr(expr->fChildren[1]));
+            fCode->Jump(end_label);
 
-            if (keyword.find(".") != std::string::npos)
-                return err_str;
+            PlaceLabel(else_label);
+            fCode->Move(reg, GenExpr(expr->fChildren[2]));
+            fCode->Label(end_label);
 
-            err_str += "\nUndefined value: " + keyword;
-            return err_str;
+            return reg;
+        }
+        case kNodeAssign:
+        {
+            return GenAssign(expr);
+        }
+        case kNodeIncrement:
+        {
+            return GenIncrement(expr);
+        }
+        case kNodeComma:
+        {
+            GenExpr(expr->fChildren[0]);
+            return GenExpr(expr->fChildren[1]);
+        }
+        case kNodeCall:
+        {
+            return GenCall(expr);
+        }
+        default:
+            break;
         }
 
-cc_next_loop:
-        continue;
+        // rejected by CompilerSema.
+        return NewReg();
     }
 
-cc_next:
-
-    // extern doesnt declare anything, it imports a variable.
-    // so that's why it's not declare upper.
-    if (ParserKit::find_word(ln, "extern"))
+    Int32 CompilerGenerator::GenBinary(CompilerNode* expr)
     {
-        auto substr = ln.substr(ln.find("extern") + strlen("extern"));
-        kCompilerVariables.push_back({ .fValue = substr });
-    }
+        auto lhs_type = expr->fChildren[0]->fType;
+        auto rhs_type = expr->fChildren[1]->fType;
 
-    if (kShouldHaveBraces &&
-        ln.find('{') == std::string::npos)
-    {
-        err_str += "Missing '{' for function ";
-        err_str += kFnName;
-        err_str += "\n";
+        auto lhs = GenExpr(expr->fChildren[0]);
+        auto rhs = GenExpr(expr->fChildren[1]);
 
-        kShouldHaveBraces = false;
-        kFnName.clear();
-    }
-    else if (kShouldHaveBraces &&
-             ln.find('{') != std::string::npos)
-    {
-        kShouldHaveBraces = false;
-        kFnName.clear();
-    }
+        if (is_comparison(expr->fOp))
+            return GenCompare(expr->fOp, lhs, rhs);
 
-    bool type_not_found = true;
+        // pointer arithmetic counts in elements.
+        if (expr->fOp == kOpAdd ||
+            expr->fOp == kOpSub)
+        {
+            if (is_address(lhs_type) &&
+                cc_is_integer(rhs_type))
+                rhs = GenScale(rhs, step_size(lhs_type));
+            else if (cc_is_integer(lhs_type) &&
+                     is_address(rhs_type))
+                lhs = GenScale(lhs, step_size(rhs_type));
+        }
 
-    if (ln.find('\'') != std::string::npos)
-    {
-        ln.replace(ln.find('\''), 3, "0");
-    }
+        auto reg = NewReg();
 
-    auto first = ln.find('"');
-    if (first != std::string::npos)
-    {
-        auto second = 0UL;
-        bool found_second_quote = false;
+        fCode->Arith(op_mnemonic(expr->fOp), reg, lhs, rhs);
 
-        for (size_t i = first + 1; i < ln.size(); ++i)
+        if (expr->fOp == kOpSub &&
+            is_address(lhs_type) &&
+            is_address(rhs_type) &&
+            step_size(lhs_type) > 1)
         {
-            if (ln[i] == '\"')
-            {
-                found_second_quote = true;
-                second = i;
+            auto count = NewReg();
 
-                break;
-            }
+            fCode->Arith("div", count, reg, GenConstant(step_size(lhs_type)));
+            return count;
         }
 
-        if (!found_second_quote)
-        {
-            err_str += "Missing terminating \".";
-            err_str += " here -> " + ln.substr(ln.find('"'), second);
-        }
+        return reg;
     }
 
-    if (ln.find(')') != std::string::npos &&
-        ln.find(';') == std::string::npos)
+    Int32 CompilerGenerator::GenAssign(CompilerNode* expr)
     {
-        if (ln.find('{') == std::string::npos)
-        {
-            kFnName = ln;
-            kShouldHaveBraces = true;
+        auto target = expr->fChildren[0];
 
-            goto skip_braces_check;
-        }
-        else if (ln.find('{') != std::string::npos)
+        // the value first, so that calls in it are done before the address is taken.
+        auto value = GenExpr(expr->fChildren[1]);
+        auto addr = GenAddr(target);
+
+        if (cc_is_record(target->fType))
         {
-            kShouldHaveBraces = false;
+            GenCopy(cc_type_size(target->fType), addr, value);
+            return value;
         }
-    }
 
-skip_braces_check:
-
-    for (auto& key : kCompilerTypes)
-    {
-        if (ParserKit::find_word(ln, key.fName))
+        if (expr->fOp == kOpNone)
         {
-            if (isdigit(ln[ln.find(key.fName) + key.fName.size() + 1]))
-            {
-                err_str += "\nNumber cannot be set for ";
-                err_str += key.fName;
-                err_str += "'s name. here -> ";
-                err_str += ln;
-            }
+            GenStore(target->fType, value, addr);
+            return value;
+        }
 
-            if (ln.find(key.fName) == 0 ||
-                ln[ln.find(key.fName) - 1] == ' ' ||
-                ln[ln.find(key.fName) - 1] == '\t')
-            {
-                type_not_found = false;
+        auto type = target->fType;
 
-                if (ln[ln.find(key.fName) + key.fName.size()] != ' ')
-                {
-                    type_not_found = true;
+        if (cc_is_pointer(type) &&
+            (expr->fOp == kOpAdd || expr->fOp == kOpSub))
+            value = GenScale(value, cc_element_size(type));
 
-                    if (ln[ln.find(key.fName) + key.fName.size()] == '\t')
-                        type_not_found = false;
+        auto reg = NewReg();
 
-                    goto next;
-                }
-                else if (ln[ln.find(key.fName) + key.fName.size()] != '\t')
-                {
-                    type_not_found = true;
+        fCode->Arith(op_mnemonic(expr->fOp), reg, GenLoad(target->fType, addr), value);
+        GenStore(target->fType, reg, addr);
 
-                    if (ln[ln.find(key.fName) + key.fName.size()] == ' ')
-                        type_not_found = false;
+        return reg;
+    }
 
-                }
-            }
+    Int32 CompilerGenerator::GenIncrement(CompilerNode* expr)
+    {
+        auto target = expr->fChildren[0];
+        auto type = target->fType;
+        auto addr = GenAddr(target);
 
-next:
+        auto value = GenLoad(target->fType, addr);
+        auto updated = NewReg();
 
-            if (key.fName != "struct" ||
-                key.fName != "enum" ||
-                key.fName != "union")
-            {
-                if (ln.find(';') == std::string::npos)
-                {
-                    if (ln.find('(') != std::string::npos)
-                    {
-                        if (ln.find('=') == std::string::npos)
-                            continue;
-                    }
+        Int64 step = cc_is_pointer(type) ? cc_element_size(type) : 1;
 
-                    err_str += "\nMissing ';', here -> ";
-                    err_str += ln;
-                }
-                else
-                {
-                    continue;
-                }
+        fCode->ArithImm(updated, value, expr->fOp == kOpAdd ? step : -step);
 
-                if (ln.find('=') != std::string::npos)
-                {
-                    if (ln.find('(') != std::string::npos)
-                    {
-                        if (ln.find(')') == std::string::npos)
-                        {
-                            err_str += "\nMissing ')', after '(' here -> ";
-                            err_str += ln.substr(ln.find('('));
-                        }
-                    }
-                }
-            }
-        }
-    }
+        GenStore(target->fType, updated, addr);
 
-    if (kInBraces &&
-             ln.find("struct") != std::string::npos &&
-            ln.find("union") != std::string::npos &&
-            ln.find("enum") != std::string::npos &&
-            ln.find('=') != std::string::npos)
-    {
-        if (ln.find(';') == std::string::npos)
-        {
-            err_str += "\nMissing ';' after struct/union/enum declaration, here -> ";
-            err_str += ln;
-        }
+        // prefix yields the new value, postfix the old one.
+        return expr->fValue ? value : updated;
     }
 
-    if (ln.find(';') != std::string::npos &&
-        ln.find("for") == std::string::npos)
+    Int32 CompilerGenerator::GenCall(CompilerNode* expr)
     {
-        if (ln.find(';') + 1 != ln.size())
+        auto callee = expr->fChildren[0];
+        auto args = expr->fChildren.size() - 1;
+
+        std::vector<Int32> values(std::min<SizeType>(args, kAsmArgRegisterCount), kIRNoRegister);
+
+        fCode->CallBegin();
+
+        // right to left, the arguments past the argument registers are pushed as they come.
+        for (SizeType arg = args; arg > 0; --arg)
         {
-            for (int i = 0; i < ln.substr(ln.find(';') + 1).size(); ++i)
-            {
-                if ((ln.substr(ln.find(';') + 1)[i] != ' ') ||
-                    (ln.substr(ln.find(';') + 1)[i] != '\t'))
-                {
-                    if (auto err = this->Check(ln.substr(ln.find(';') + 1).c_str(), file);
-                        !err.empty())
-                    {
-                        err_str += "\nUnexpected text after ';' -> ";
-                        err_str += ln.substr(ln.find(';'));
-                        err_str += err;
-                    }
-                }
-            }
+            auto value = GenExpr(expr->fChildren[arg]);
+
+            if (arg - 1 < values.size())
+                values[arg - 1] = value;
+            else
+                fCode->Push(value);
         }
+
+        bool direct = callee->fKind == kNodeVariable &&
+                      callee->fSymbol->fKind == kSymbolFunction;
+
+        auto target = direct ? kIRNoRegister : GenExpr(callee);
+
+        // nothing may call between these moves and the call itself.
+        for (SizeType arg = 0; arg < values.size(); ++arg)
+            fCode->Move(kAsmArgRegister + arg, values[arg]);
+
+        if (direct)
+            fCode->Call(symbol_ref(callee->fSymbol));
+        else
+            fCode->Call("", target);
+
+        fCode->Drop((Int64)(args - values.size()) * kWordSize);
+        fCode->CallEnd();
+
+        auto result = NewReg();
+        fCode->Move(result, kAsmRetRegister);
+
+        return result;
     }
 
-    if (ln.find('(') != std::string::npos)
+    void CompilerGenerator::GenBranch(CompilerNode* cond, std::string& label, bool jump_if)
     {
-        if (ln.find(';') == std::string::npos &&
-            !ParserKit::find_word(ln, "|") &&
-            !ParserKit::find_word(ln, "||") &&
-            !ParserKit::find_word(ln, "&") &&
-            !ParserKit::find_word(ln, "&&") &&
-            !ParserKit::find_word(ln, "~"))
+        if (cond->fKind == kNodeLogical)
         {
-            bool found_func = false;
-            size_t i = ln.find('(');
-            std::vector<char> opens;
-            std::vector<char> closes;
+            bool is_and = cond->fOp == kOpLogicalAnd;
 
-            for (; i < ln.size(); ++i)
+            // 'a && b' jumps on false like either side, on true only when both hold.
+            if (is_and != jump_if)
             {
-                if (ln[i] == ')')
-                {
-                    closes.push_back(1);
-                }
-
-                if (ln[i] == '(')
-                {
-                    opens.push_back(1);
-                }
+                GenBranch(cond->fChildren[0], label, jump_if);
+                GenBranch(cond->fChildren[1], label, jump_if);
             }
-
-            if (closes.size() != opens.size())
-                err_str += "Unterminated (), here -> " + ln;
-
-            bool space_found = false;
-
-            for (int i = 0; i < ln.size(); ++i)
+            else
             {
-                if (ln[i] == ')' &&
-                    !space_found)
-                {
-                    space_found = true;
-                    continue;
-                }
+                std::string skip;
 
-                if (space_found)
-                {
-                    if (ln[i] == ' ' &&
-                        isalnum(ln[i+1]))
-                    {
-                        err_str += "\nBad function format here -> ";
-                        err_str += ln;
-                    }
-                }
+                GenBranch(cond->fChildren[0], skip, !jump_if);
+                GenBranch(cond->fChildren[1], label, jump_if);
+                PlaceLabel(skip);
             }
+
+            return;
         }
 
-        if (ln.find('(') < 1)
+        if (cond->fKind == kNodeUnary &&
+            cond->fOp == kOpLogicalNot)
         {
-            err_str += "\nMissing identifier before '(' here -> ";
-            err_str += ln;
+            GenBranch(cond->fChildren[0], label, !jump_if);
+            return;
         }
-        else
+
+        Int64 constant = 0;
+
+        if (cc_eval_constant(cond, constant))
         {
-            if (type_not_found &&
-                ln.find(';') == std::string::npos &&
-                ln.find("if") == std::string::npos &&
-                ln.find("while") == std::string::npos &&
-                ln.find("for") == std::string::npos &&
-                ln.find("static") == std::string::npos &&
-                ln.find("inline") == std::string::npos &&
-                ln.find("|") == std::string::npos &&
-                ln.find("&") == std::string::npos)
-            {
-                err_str += "\n Missing ';' or type, here -> ";
-                err_str += ln;
-            }
+            if ((constant != 0) == jump_if)
+                fCode->Jump(UseLabel(label));
+
+            return;
         }
 
-        if (ln.find(')') == std::string::npos)
+        if (cond->fKind == kNodeBinary &&
+            is_comparison(cond->fOp))
         {
-            err_str += "\nMissing ')', after '(' here -> ";
-            err_str += ln.substr(ln.find('('));
+            auto lhs = GenExpr(cond->fChildren[0]);
+            auto rhs = GenExpr(cond->fChildren[1]);
+
+            fCode->Branch(branch_mnemonic(cond->fOp, !jump_if), lhs, rhs, UseLabel(label));
+            return;
         }
+
+        fCode->Branch(jump_if ? "bne" : "beq", GenExpr(cond), kAsmZeroRegister, UseLabel(label));
     }
-    else
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name Compile
+// @brief Generate MASM from a C translation unit.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void CompilerBackendClang::Compile(const char* text, [[maybe_unused]] const char* file)
+{
+    std::vector<detail::CompilerToken> tokens;
+    std::vector<detail::CompilerNode*> unit;
+
+    cc_reset_unit();
+
     {
-        if (ln.find("for") != std::string::npos ||
-            ln.find("while") != std::string::npos)
-        {
-            err_str += "\nMissing '(', after \"for\", here -> ";
-            err_str += ln;
-        }
+        CxxKit::PhaseTimer timer(cc_report(), "lex");
+
+        if (!cc_lex(text, tokens))
+            return;
     }
 
-    if (ln.find('}') != std::string::npos &&
-        !kInBraces)
+    if (cc_report())
+        kReport.Count("tokens", tokens.size());
+
     {
-        if (!kInStruct &&
-            ln.find(';') == std::string::npos)
-        {
-            err_str += "\nMismatched '}', here -> ";
-            err_str += ln;
-        }
+        CxxKit::PhaseTimer timer(cc_report(), "parse");
+
+        detail::CompilerParser parser(tokens);
+        unit = parser.ParseTranslationUnit();
     }
 
-    if (!ln.empty())
+    if (cc_report())
+        kReport.Count("declarations", unit.size());
+
+    if (kAcceptableErrors > 0)
+        return;
+
     {
-        if (ln.find(';') == std::string::npos &&
-            ln.find("struct") == std::string::npos &&
-            ln.find("enum") == std::string::npos &&
-            ln.find("union") == std::string::npos &&
-            ln.find("for") == std::string::npos &&
-            ln.find("while") == std::string::npos &&
-            ln.find('{') == std::string::npos &&
-            ln.find('}') == std::string::npos &&
-            ln.find(')') == std::string::npos &&
-            ln.find('(') == std::string::npos &&
-            ln.find(',') == std::string::npos &&
-            ln.find("typedef") == std::string::npos)
-        {
-            if (ln.size() <= 2)
-                return err_str;
+        CxxKit::PhaseTimer timer(cc_report(), "check");
 
-            err_str += "\nMissing ';', here -> ";
-            err_str += ln;
-        }
+        detail::CompilerSema sema;
+        sema.Check(unit);
     }
 
-    return err_str;
+    if (kAcceptableErrors > 0)
+        return;
+
+    CxxKit::PhaseTimer timer(cc_report(), "codegen");
+
+    detail::CompilerGenerator generator;
+    generator.Generate(unit);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -1636,97 +5064,89 @@ public:
             dest += ch;
         }
 
-        /* According to pef abi. */
-        dest += kAsmFileExt;
-
-        kState.fOutputAssembly = std::make_unique<std::ofstream>(dest);
+        kState.fAssembly.clear();
+        kState.fModule = CxxKit::IRModule();
+        kReport.Reset(src_file);
 
-        auto fmt = CxxKit::current_date();
+        // the whole translation unit is parsed at once, constructs may span lines.
+        std::stringstream source;
 
-        (*kState.fOutputAssembly) << "# Path: " << src_file << "\n";
-        (*kState.fOutputAssembly) << "# Language: MP-UX Assembly\n";
-        (*kState.fOutputAssembly) << "# Build Date: " << fmt << "\n\n";
-
-        ParserKit::SyntaxLeafList syntax;
+        {
+            CxxKit::PhaseTimer timer(cc_report(), "read");
+            source << src_fp.rdbuf();
+        }
 
-        kState.fSyntaxTreeList.push_back(syntax);
-        kState.fSyntaxTree = &kState.fSyntaxTreeList[kState.fSyntaxTreeList.size() - 1];
+        kState.fSourceFile = src_file;
+        kState.fSourceLine = 0;
+        kState.fUnitName = detail::unit_name(src_file, source.str());
 
-        std::string source;
+        kCompilerBackend->Compile(source.str().c_str(), src.CData());
 
-        while (std::getline(src_fp, source))
+        if (cc_report())
         {
-            if (auto err = kCompilerBackend->Check(source.c_str(), src.CData());
-                err.empty())
-            {
-                kCompilerBackend->Compile(source.c_str(), src.CData());
-            }
-            else
-            {
-                detail::print_error(err, src.CData());
-            }
+            kReport.Count("symbols", kSymbolCount);
+            kReport.Count("identifiers", kIdentifiers.Size());
+            kReport.Count("functions", kCompilerFunctions.size());
+            kReport.Count("lines", kState.fAssembly.size());
+
+            kReport.Memory("arena used", kArena.Used());
+            kReport.Memory("arena peak", kArena.Peak());
+            kReport.Memory("peak resident", CxxKit::CompileReport::PeakResident());
         }
 
         if (kAcceptableErrors > 0)
             return -1;
 
-        for (auto& leaf : kState.fSyntaxTree->fLeafList)
+        if (!kEmitObject ||
+            kEmitAssembly)
         {
-            if (leaf.fUserValue.find("typedef") != std::string::npos)
-                continue;
-
-            if (ParserKit::find_word(leaf.fUserValue, "ldw") ||
-                ParserKit::find_word(leaf.fUserValue, "stw") ||
-                ParserKit::find_word(leaf.fUserValue, "add") ||
-                ParserKit::find_word(leaf.fUserValue, "dec") ||
-                ParserKit::find_word(leaf.fUserValue, "mv"))
-            {
-                for (auto & reg : kState.kStackFrame)
-                {
-                    std::string needle;
+            CxxKit::PhaseTimer timer(cc_report(), "write");
 
-                    for (size_t i = 0; i < reg.fName.size(); i++)
-                    {
-                        if (reg.fName[i] == ' ')
-                        {
-                            ++i;
+            /* According to pef abi. */
+            kState.fOutputAssembly = std::make_unique<std::ofstream>(dest + kAsmFileExt);
 
-                            for (; i < reg.fName.size(); i++)
-                            {
-                                if (reg.fName[i] == ',')
-                                {
-                                    break;
-                                }
+            auto fmt = CxxKit::current_date();
 
-                                if (reg.fName[i] == ' ')
-                                    continue;
+            (*kState.fOutputAssembly) << "# Path: " << src_file << "\n";
+            (*kState.fOutputAssembly) << "# Language: MP-UX Assembly\n";
+            (*kState.fOutputAssembly) << "# Build Date: " << fmt << "\n\n";
 
-                                needle += reg.fName[i];
-                            }
+            for (auto& line : kState.fAssembly)
+            {
+                (*kState.fOutputAssembly) << CxxKit::asm_format(line) << "\n";
+            }
 
-                            break;
-                        }
-                    }
+            kState.fOutputAssembly->flush();
+            kState.fOutputAssembly.reset();
+        }
 
-                    if (ParserKit::find_word(leaf.fUserValue, needle))
-                    {
-                        leaf.fUserValue.replace(leaf.fUserValue.find(needle),
-                                                needle.size(), reg.fRegister);
+        // the lines go to the encoder as they are, masm is not needed.
+        if (kEmitObject)
+        {
+            CxxKit::PhaseTimer timer(cc_report(), "assemble");
+            CxxKit::AEObject object(kObjectArch);
 
-                    }
-                }
+            if (kLinkTimeOptimization)
+            {
+                kState.fModule.fData = kState.fAssembly;
+                object.Add(kIRModuleRecord + kState.fUnitName, CxxKit::kPefIR, kState.fModule.Write());
+            }
+            else
+            {
+                for (auto& line : kState.fAssembly)
+                    object.Add(line);
             }
-        }
 
-        for (auto& leaf : kState.fSyntaxTree->fLeafList)
-        {
-            (*kState.fOutputAssembly) << leaf.fUserValue;
-        }
+            std::ofstream object_out(dest + kObjectFileExt, std::ofstream::binary);
 
-        kState.fSyntaxTree = nullptr;
+            if (!object.Write(object_out))
+            {
+                object_out.close();
+                std::filesystem::remove(dest + kObjectFileExt);
 
-        kState.fOutputAssembly->flush();
-        kState.fOutputAssembly.reset();
+                return -1;
+            }
+        }
 
         return kOk;
     }
@@ -1743,6 +5163,17 @@ static void cc_print_help()
     kSplashCxx();
     kPrintF(kWhite "--asm={MACHINE}: %s\n", "Compile to a specific assembler syntax. (masm)");
     kPrintF(kWhite "--compiler={COMPILER}: %s\n", "Select compiler engine (builtin -> dolvik).");
+    kPrintF(kWhite "-O{0,1,2}: %s\n", "Optimization level, -O1 folds and propagates over SSA, -O2 also reuses common subexpressions and moves invariant code out of loops.");
+    kPrintF(kWhite "-finline-limit={N}: %s\n", "Inline functions of up to N IR instructions at -O1 and up, 4N if declared inline, 0 inlines none.");
+    kPrintF(kWhite "-funroll-loops[={N}]: %s\n", "Unroll small inner loops N times at -O2, 4 without N.");
+    kPrintF(kWhite "-j{N}: %s\n", "Lower functions on N threads, -j alone uses every hardware thread.");
+    kPrintF(kWhite "--emit-obj: %s\n", "Assemble in process and write the AE object, without masm.");
+    kPrintF(kWhite "-S: %s\n", "Write the MASM text as well, it is the only output without --emit-obj.");
+    kPrintF(kWhite "-flto: %s\n", "Write the IR of the unit in the AE object for ld to inline across units and lower, implies --emit-obj, -S then only has the data.");
+    kPrintF(kWhite "-marc: %s\n", "Mark the AE object for ARC, as masm -marc does.");
+    kPrintF(kWhite "-Wpadded: %s\n", "Warn about the padding in each struct, and the order of its fields that would need less.");
+    kPrintF(kWhite "-ftime-report[=json]: %s\n", "Print the time of each phase, and what the unit holds, after each file.");
+    kPrintF(kWhite "-fmem-report[=json]: %s\n", "Print the peak memory use, and what the unit holds, after each file.");
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -1751,18 +5182,16 @@ static void cc_print_help()
 
 int main(int argc, char** argv)
 {
-    kCompilerTypes.push_back({ .fName = "bool", .fValue = "bool" });
-    kCompilerTypes.push_back({ .fName = "void", .fValue = "void" });
-    kCompilerTypes.push_back({ .fName = "char", .fValue = "byte" });
-    kCompilerTypes.push_back({ .fName = "short", .fValue = "hword" });
-    kCompilerTypes.push_back({ .fName = "int", .fValue = "dword" });
-    kCompilerTypes.push_back({ .fName = "long", .fValue = "qword" });
-
-    kCompilerTypes.push_back({ .fName = "const", .fValue = " " });
-    kCompilerTypes.push_back({ .fName = "*", .fValue = "offset" });
+    kCompilerTypes["bool"] = { .fName = "bool", .fValue = "bool", .fKind = detail::kTypeBool };
+    kCompilerTypes["_Bool"] = { .fName = "_Bool", .fValue = "bool", .fKind = detail::kTypeBool };
+    kCompilerTypes["void"] = { .fName = "void", .fValue = "void", .fKind = detail::kTypeVoid };
+    kCompilerTypes["char"] = { .fName = "char", .fValue = "byte", .fKind = detail::kTypeChar };
+    kCompilerTypes["short"] = { .fName = "short", .fValue = "hword", .fKind = detail::kTypeShort };
+    kCompilerTypes["int"] = { .fName = "int", .fValue = "dword", .fKind = detail::kTypeInt };
+    kCompilerTypes["long"] = { .fName = "long", .fValue = "qword", .fKind = detail::kTypeLong };
 
-    kCompilerTypes.push_back({ .fName = "float", .fValue = "float32" });
-    kCompilerTypes.push_back({ .fName = "double", .fValue = "float64" });
+    kCompilerTypes["float"] = { .fName = "float", .fValue = "float32", .fKind = detail::kTypeFloat };
+    kCompilerTypes["double"] = { .fName = "double", .fValue = "float64", .fKind = detail::kTypeDouble };
 
     bool skip = false;
 
@@ -1824,6 +5253,95 @@ int main(int argc, char** argv)
                 continue;
             }
 
+            if (strcmp(argv[index], "-O0") == 0 ||
+                strcmp(argv[index], "-O1") == 0 ||
+                strcmp(argv[index], "-O2") == 0)
+            {
+                kOptimizationLevel = argv[index][2] - '0';
+
+                continue;
+            }
+
+            if (strncmp(argv[index], "-finline-limit=", 15) == 0)
+            {
+                kInlineLimit = std::strtoul(argv[index] + 15, nullptr, 10);
+
+                continue;
+            }
+
+            if (strcmp(argv[index], "-funroll-loops") == 0)
+            {
+                kUnrollFactor = kUnrollDefault;
+
+                continue;
+            }
+
+            if (strncmp(argv[index], "-funroll-loops=", 15) == 0)
+            {
+                kUnrollFactor = std::strtoul(argv[index] + 15, nullptr, 10);
+
+                continue;
+            }
+
+            if (strncmp(argv[index], "-j", 2) == 0)
+            {
+                kJobs = argv[index][2] ? std::strtoul(argv[index] + 2, nullptr, 10) : std::thread::hardware_concurrency();
+
+                if (kJobs < 1)
+                    kJobs = 1;
+
+                continue;
+            }
+
+            if (strcmp(argv[index], "--emit-obj") == 0)
+            {
+                kEmitObject = true;
+
+                continue;
+            }
+
+            if (strcmp(argv[index], "-flto") == 0)
+            {
+                kLinkTimeOptimization = true;
+                kEmitObject = true;
+
+                continue;
+            }
+
+            if (strcmp(argv[index], "-S") == 0)
+            {
+                kEmitAssembly = true;
+
+                continue;
+            }
+
+            if (strncmp(argv[index], "-ftime-report", 13) == 0 ||
+                strncmp(argv[index], "-fmem-report", 12) == 0)
+            {
+                auto option = std::string(argv[index]);
+
+                (option[2] == 't' ? kTimeReport : kMemReport) = true;
+
+                if (option.ends_with("=json"))
+                    kReportJson = true;
+
+                continue;
+            }
+
+            if (strcmp(argv[index], "-Wpadded") == 0)
+            {
+                kWarnPadded = true;
+
+                continue;
+            }
+
+            if (strcmp(argv[index], "-marc") == 0)
+            {
+                kObjectArch = CxxKit::kPefArchARC;
+
+                continue;
+            }
+
             if (strcmp(argv[index], "-fmax-exceptions") == 0)
             {
                 try
@@ -1863,7 +5381,12 @@ int main(int argc, char** argv)
             return -1;
         }
 
-        if (kFactory.Compile(srcFile, kMachine) != kOk)
+        auto result = kFactory.Compile(srcFile, kMachine);
+
+        if (cc_report())
+            kReport.Print(std::cerr, kTimeReport, kMemReport, kReportJson);
+
+        if (result != kOk)
             return -1;
     }
 
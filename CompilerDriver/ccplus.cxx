@@ -7,13 +7,19 @@
  * 	========================================================
  */
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdio>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <unordered_map>
 #include <C++Kit/AsmKit/Arch/NewCPU.hpp>
 #include <C++Kit/ParserKit.hpp>
+#include <C++Kit/StdKit/Report.hpp>
 
 #define kOk 0
 
@@ -53,6 +59,8 @@ namespace detail
         std::unique_ptr<std::ofstream> fOutputAssembly;
         std::string fLastFile;
         std::string fLastError;
+        std::string fSourceFile;
+        SizeType fSourceLine{ 0 };
         bool kVerbose;
     };
 }
@@ -64,137 +72,1904 @@ static Int32 kAcceptableErrors = 0;
 
 namespace detail
 {
-    void print_error(std::string reason, std::string file) noexcept
+    void print_error(std::string reason, std::string file, SizeType line = 0) noexcept
     {
         if (reason[0] == '\n')
             reason.erase(0, 1);
 
+        if (line > 0)
+            reason = "line " + std::to_string(line) + ", " + reason;
+
         if (file.find(".pp") != std::string::npos)
         {
-            file.erase(file.find(".pp"), 3);
+            file.erase(file.find(".pp"), 3);
+        }
+
+        if (kState.fLastFile != file)
+        {
+            std::cout << kRed << "[ cxx ] " << kWhite << ((file == "cxx") ? "internal compiler error " : ("in file, " + file)) << kBlank << std::endl;
+            std::cout << kRed << "[ cxx ] " << kWhite << reason << kBlank << std::endl;
+
+            kState.fLastFile = file;
+        }
+        else
+        {
+            std::cout << kRed << "[ cxx ] [ " << kState.fLastFile <<  " ] " << kWhite << reason << kBlank << std::endl;
+        }
+
+        if (kAcceptableErrors > kErrorLimit)
+            std::exit(3);
+
+        ++kAcceptableErrors;
+    }
+
+    /// @brief reads a '# <line> "<file>"' marker left by cpp.
+    /// @return true if the line was a marker.
+    bool read_line_marker(const std::string& line) noexcept
+    {
+        if (line.size() < 3 ||
+            line[0] != '#' ||
+            line[1] != ' ' ||
+            !isdigit(line[2]))
+            return false;
+
+        auto first_quote = line.find('"');
+        auto last_quote = line.rfind('"');
+
+        if (first_quote == std::string::npos ||
+            first_quote == last_quote)
+            return false;
+
+        // the marker names the line that comes right after it.
+        kState.fSourceLine = std::strtoul(line.c_str() + 2, nullptr, 10) - 1;
+        kState.fSourceFile = line.substr(first_quote + 1, last_quote - first_quote - 1);
+
+        return true;
+    }
+
+    struct CompilerType
+    {
+        std::string fName;
+        std::string fValue;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// Target architecture.
+static int kMachine = 0;
+
+/// @brief -ftime-report and -fmem-report, printed on stderr after each file, as JSON with =json.
+static bool kTimeReport = false;
+static bool kMemReport = false;
+static bool kReportJson = false;
+static CxxKit::CompileReport kReport;
+
+/// @brief the report phases are timed in, none unless asked for.
+static CxxKit::CompileReport* cxx_report()
+{
+    return kTimeReport || kMemReport ? &kReport : nullptr;
+}
+
+/////////////////////////////////////////
+
+// REGISTERS ACCORDING TO USED ASSEMBLER
+
+/////////////////////////////////////////
+
+static size_t kRegisterCnt = kAsmRegisterLimit;
+static size_t kStartUsable = 1;
+static size_t kUsableLimit = 14;
+static size_t kRegisterCounter = kStartUsable;
+static std::string kRegisterPrefix = kAsmRegisterPrefix;
+
+/////////////////////////////////////////
+
+// COMPILER PARSING UTILITIES/STATES.
+
+/////////////////////////////////////////
+
+static std::vector<std::string> kFileList;
+static CxxKit::AssemblyFactory kFactory;
+static bool kInStruct = false;
+static bool kOnWhileLoop = false;
+static bool kOnForLoop = false;
+static bool kInBraces = false;
+static size_t kBracesCount = 0UL;
+
+/* @brief C compiler backend for Amlal El Mahrouss C */
+class CompilerBackendClang final : public ParserKit::CompilerBackend
+{
+public:
+    explicit CompilerBackendClang() = default;
+    ~CompilerBackendClang() override = default;
+
+    CXXKIT_COPY_DEFAULT(CompilerBackendClang);
+
+    std::string Check(const char* text, const char* file);
+    void Compile(const char* text, const char* file) override;
+
+    const char* Language() override { return "C++"; }
+
+};
+
+static CompilerBackendClang* kCompilerBackend = nullptr;
+static std::vector<detail::CompilerType> kCompilerVariables;
+static std::vector<std::string>          kCompilerFunctions;
+static std::vector<detail::CompilerType> kCompilerTypes;
+
+// @brief this hook code before the begin/end command.
+static std::string kAddIfAnyBegin;
+static std::string kAddIfAnyEnd;
+static std::string kLatestVar;
+
+/// @brief the name of a variable of the stack frame, as declared.
+static std::string cxx_frame_name(const detail::CompilerRegisterMap& reg)
+{
+    std::string name;
+
+    for (size_t i = 0; i < reg.fName.size(); i++)
+    {
+        if (reg.fName[i] == ' ')
+        {
+            ++i;
+
+            for (; i < reg.fName.size(); i++)
+            {
+                if (reg.fName[i] == ',')
+                    break;
+
+                name += reg.fName[i];
+            }
+
+            break;
+        }
+    }
+
+    return name;
+}
+
+/// @brief the arguments of a call, as listed between its parentheses.
+static std::vector<std::string> cxx_split_arguments(const std::string& list)
+{
+    std::vector<std::string> args;
+    std::string arg;
+
+    for (size_t index = 0; index <= list.size(); ++index)
+    {
+        if (index < list.size() &&
+            list[index] != ',')
+        {
+            if (list[index] != ' ' ||
+                !arg.empty())
+                arg += list[index];
+
+            continue;
+        }
+
+        while (!arg.empty() &&
+               arg.back() == ' ')
+            arg.pop_back();
+
+        if (!arg.empty())
+            args.push_back(arg);
+
+        arg.clear();
+    }
+
+    return args;
+}
+
+/// @brief registers of the frame the callee may overwrite, saved by the caller around a call.
+static std::vector<std::string> cxx_caller_saved()
+{
+    std::vector<std::string> saved;
+
+    for (auto& reg : kState.kStackFrame)
+    {
+        auto number = std::stoul(reg.fRegister.substr(kRegisterPrefix.size()));
+
+        if (number < kAsmCalleeSavedFirst ||
+            number > kAsmCalleeSavedLast)
+            saved.push_back(reg.fRegister);
+    }
+
+    return saved;
+}
+
+/// @brief pass the arguments of a call, as listed between its parentheses.
+/// The caller saved registers of the frame are pushed first, then the arguments after
+/// the first kAsmArgRegisterCount, right to left, the others go in the argument registers.
+static std::string cxx_pass_arguments(const std::string& list)
+{
+    auto args = cxx_split_arguments(list);
+
+    std::string code;
+
+    for (auto& reg : cxx_caller_saved())
+        code += "\tpsh " + reg + "\n";
+
+    // a variable of the frame is its register, anything else (a constant, a global) is loaded.
+    auto frame_register = [](const std::string& arg) -> std::string {
+        for (auto& reg : kState.kStackFrame)
+        {
+            if (cxx_frame_name(reg) == arg)
+                return reg.fRegister;
+        }
+
+        return "";
+    };
+
+    for (size_t index = args.size(); index > kAsmArgRegisterCount; --index)
+    {
+        auto reg = frame_register(args[index - 1]);
+        code += "\tpsh " + (reg.empty() ? args[index - 1] : reg) + "\n";
+    }
+
+    for (size_t index = 0; index < args.size() && index < kAsmArgRegisterCount; ++index)
+    {
+        auto target = kRegisterPrefix + std::to_string(kAsmArgRegister + index);
+
+        if (auto reg = frame_register(args[index]);
+            !reg.empty())
+            code += "\tmv " + target + ", " + reg + "\n";
+        else
+            code += "\tldw " + target + ", " + args[index] + "\n";
+    }
+
+    return code;
+}
+
+/// @brief what follows the 'jlr' of a call cxx_pass_arguments passed list to, the
+/// pushed arguments are dropped and the saved registers loaded back. Each line starts
+/// with its newline, it goes right after the name of the callee.
+static std::string cxx_return_from_call(const std::string& list)
+{
+    auto args = cxx_split_arguments(list);
+    auto saved = cxx_caller_saved();
+
+    std::string code;
+
+    if (args.size() > kAsmArgRegisterCount)
+        code += "\n\tadd " + kRegisterPrefix + std::to_string(kAsmSpRegister) + ", " +
+                std::to_string((args.size() - kAsmArgRegisterCount) * 8);
+
+    if (saved.empty())
+        return code;
+
+    for (size_t index = 0; index < saved.size(); ++index)
+        code += "\n\tldw " + saved[index] + ", [" + kRegisterPrefix + std::to_string(kAsmSpRegister) + "+" +
+                std::to_string((saved.size() - 1 - index) * 8) + "]";
+
+    code += "\n\tadd " + kRegisterPrefix + std::to_string(kAsmSpRegister) + ", " + std::to_string(saved.size() * 8);
+
+    return code;
+}
+
+static std::string cxx_parse_function_call(std::string& _text)
+{
+    if (_text[0] == '(') {
+        std::string substr;
+        std::string args_buffer;
+        std::string args;
+
+        bool type_crossed = false;
+
+        for (char substr_first_index: _text)
+        {
+            args_buffer += substr_first_index;
+
+            if (substr_first_index == ';')
+            {
+                args_buffer = args_buffer.erase(0, args_buffer.find('('));
+                args_buffer = args_buffer.erase(args_buffer.find(';'), 1);
+                args_buffer = args_buffer.erase(args_buffer.find(')'), 1);
+                args_buffer = args_buffer.erase(args_buffer.find('('), 1);
+
+                args += cxx_pass_arguments(args_buffer);
+                args += "\tjlr __import ";
+            }
+        }
+
+        return args;
+    }
+
+    return "";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name Constant evaluation
+// @brief constexpr functions are kept as tokens and run by an interpreter, before
+// the lines that use them are compiled. Calls with constant arguments, constants
+// and reads of constant tables in a line become numbers, and file scope data with
+// a constant initializer becomes a .data record, instead of stores run at startup.
+// A single evaluation runs kConstexprSteps expressions and statements at most.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief -fconstexpr-steps=, what one evaluation may run before it gives up.
+static SizeType kConstexprSteps = 1 << 20;
+
+#define kConstexprDepth 256 // calls nested in one evaluation.
+
+namespace detail
+{
+    struct CompilerToken final
+    {
+        std::string fText;
+        SizeType fAt{ 0 }; // offset in its line, a fold keeps the spacing around it.
+    };
+
+    /// @brief an integer as C++ sees it, its value and the type it has.
+    struct CompilerValue final
+    {
+        Int64 fValue{ 0 }; // in the range of its type, the bits of it for unsigned long.
+        UInt8 fBits{ 32 }; // 1 for bool, 8, 16, 32 or 64.
+        bool fUnsigned{ false };
+        bool fKnown{ true }; // false for what dead code reads and nothing declared, its type is a guess.
+    };
+
+    /// @brief a constexpr function, its parameters and its body, braces included.
+    struct CompilerConstFunction final
+    {
+        std::vector<std::string> fParams;
+        std::vector<CompilerValue> fParamTypes;
+        CompilerValue fReturn;
+        bool fAuto{ false }; // returns the type of what it returns.
+        std::vector<CompilerToken> fBody;
+        std::vector<std::string> fLines; // its source, compiled only if a call to it is left.
+        SizeType fLine{ 0 }; // where it starts in the source.
+        bool fRuntime{ false };
+    };
+
+    /// @brief a constant, or a table of them, and the braces it was declared in.
+    struct CompilerConstant final
+    {
+        std::vector<Int64> fValues;
+        CompilerValue fType;
+        SizeType fDepth{ 0 };
+        bool fTable{ false };
+    };
+
+    class CompilerEvaluator final
+    {
+    public:
+        explicit CompilerEvaluator() = default;
+        ~CompilerEvaluator() = default;
+
+        CXXKIT_COPY_DELETE(CompilerEvaluator);
+
+    public:
+        /// @brief the lines to compile for a source line, folded, none while a
+        /// constexpr function or a table is being read. fData takes the records made.
+        std::vector<std::string> Line(const std::string& line);
+
+        /// @brief source of the constexpr functions a call to was left for runtime,
+        /// one statement a line, with the line of the source it comes from.
+        std::vector<std::pair<SizeType, std::string>> RuntimeLines() const;
+
+        void Reset();
+
+    public:
+        std::string fData;
+
+    private:
+        enum { kStmtNext, kStmtReturn, kStmtBreak, kStmtContinue, kStmtFail };
+
+        using Tokens = std::vector<CompilerToken>;
+
+        bool Step();
+        bool Expect(const Tokens& tokens, SizeType& at, const char* text);
+
+        bool Expression(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live);
+        bool Binary(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live, SizeType level);
+        bool Unary(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live);
+        bool Primary(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live);
+        bool Call(const std::string& name, const std::vector<CompilerValue>& args, CompilerValue& value);
+
+        Int32 Statement(const Tokens& tokens, SizeType& at, CompilerValue& result, bool live);
+        Int32 Simple(const Tokens& tokens, SizeType& at, bool live);
+
+        bool Function(const Tokens& tokens);
+        bool Declaration(const Tokens& tokens, bool& taken);
+        std::string Fold(const std::string& line, const Tokens& tokens);
+
+    private:
+        std::unordered_map<std::string, CompilerConstFunction> fFunctions;
+        std::unordered_map<std::string, CompilerConstant> fConstants;
+        std::vector<std::unordered_map<std::string, CompilerValue>> fFrames;
+
+        // a constexpr function or a table that spans lines, until its end.
+        std::vector<std::string> fPendingLines;
+        Tokens fPending;
+
+        SizeType fDepth{ 0 };
+        SizeType fSteps{ 0 };
+        bool fExhausted{ false };
+
+    };
+
+    static const std::vector<std::string> kConstSpecifiers = {
+        "constexpr", "const", "static", "inline", "unsigned", "signed", "bool", "char", "short", "int", "long", "auto",
+    };
+
+    static bool is_specifier(const std::string& text)
+    {
+        return std::find(kConstSpecifiers.begin(), kConstSpecifiers.end(), text) != kConstSpecifiers.end();
+    }
+
+    static bool is_identifier(const std::string& text)
+    {
+        return !text.empty() &&
+               (isalpha(text[0]) || text[0] == '_');
+    }
+
+    /// @brief value brought back in the range of its type, as a conversion to it does.
+    static CompilerValue cxx_value_fit(CompilerValue value)
+    {
+        if (value.fBits == 1)
+            value.fValue = value.fValue != 0;
+        else if (value.fBits < 64)
+        {
+            auto bits = (UInt64)value.fValue & ((1ULL << value.fBits) - 1);
+
+            if (!value.fUnsigned &&
+                (bits >> (value.fBits - 1)) & 1)
+                bits -= 1ULL << value.fBits;
+
+            value.fValue = (Int64)bits;
+        }
+
+        return value;
+    }
+
+    /// @brief value converted to the type of type.
+    static CompilerValue cxx_value_cast(CompilerValue value, const CompilerValue& type)
+    {
+        if (type.fBits == 1)
+            value.fValue = value.fValue != 0;
+
+        value.fBits = type.fBits;
+        value.fUnsigned = type.fUnsigned;
+        value.fKnown = type.fKnown;
+
+        return cxx_value_fit(value);
+    }
+
+    /// @brief the integral promotion, what is narrower than int is an int.
+    static CompilerValue cxx_value_promote(CompilerValue value)
+    {
+        if (value.fBits < 32)
+            return cxx_value_cast(value, CompilerValue{ .fKnown = value.fKnown });
+
+        return value;
+    }
+
+    /// @brief the type both sides of a binary operator are converted to.
+    static CompilerValue cxx_value_common(CompilerValue lhs, CompilerValue rhs)
+    {
+        lhs = cxx_value_promote(lhs);
+        rhs = cxx_value_promote(rhs);
+
+        CompilerValue type{ .fKnown = lhs.fKnown && rhs.fKnown };
+
+        if (lhs.fUnsigned == rhs.fUnsigned)
+        {
+            type.fBits = std::max(lhs.fBits, rhs.fBits);
+            type.fUnsigned = lhs.fUnsigned;
+        }
+        else
+        {
+            auto& unsigned_side = lhs.fUnsigned ? lhs : rhs;
+            auto& signed_side = lhs.fUnsigned ? rhs : lhs;
+
+            // a long holds every unsigned int, an int holds no unsigned long.
+            type.fBits = std::max(unsigned_side.fBits, signed_side.fBits);
+            type.fUnsigned = unsigned_side.fBits >= signed_side.fBits;
+        }
+
+        return type;
+    }
+
+    /// @brief a binary operator on two values, false where C++ has no value for it
+    /// (division by zero, signed overflow, a shift by the width or more).
+    static bool cxx_value_binary(const std::string& op, CompilerValue lhs, CompilerValue rhs, CompilerValue& out)
+    {
+        CompilerValue boolean;
+
+        if (op == "&&" || op == "||")
+        {
+            boolean.fValue = op == "&&" ? (lhs.fValue && rhs.fValue) : (lhs.fValue || rhs.fValue);
+            out = boolean;
+
+            return true;
+        }
+
+        if (op == "<<" || op == ">>")
+        {
+            lhs = cxx_value_promote(lhs);
+            rhs = cxx_value_promote(rhs);
+
+            if ((!rhs.fUnsigned && rhs.fValue < 0) ||
+                (UInt64)rhs.fValue >= lhs.fBits)
+                return false;
+
+            out = lhs;
+
+            if (op == "<<")
+                out.fValue = (Int64)((UInt64)lhs.fValue << rhs.fValue);
+            else
+                out.fValue = lhs.fUnsigned ? (Int64)((UInt64)lhs.fValue >> rhs.fValue) : lhs.fValue >> rhs.fValue;
+
+            out = cxx_value_fit(out);
+            return true;
+        }
+
+        auto type = cxx_value_common(lhs, rhs);
+
+        lhs = cxx_value_cast(lhs, type);
+        rhs = cxx_value_cast(rhs, type);
+
+        auto x = (UInt64)lhs.fValue;
+        auto y = (UInt64)rhs.fValue;
+
+        if (op == "==" || op == "!=" || op == "<" || op == "<=" || op == ">" || op == ">=")
+        {
+            bool less = type.fUnsigned ? x < y : lhs.fValue < rhs.fValue;
+            bool equal = x == y;
+
+            if (op == "==") boolean.fValue = equal;
+            else if (op == "!=") boolean.fValue = !equal;
+            else if (op == "<") boolean.fValue = less;
+            else if (op == "<=") boolean.fValue = less || equal;
+            else if (op == ">") boolean.fValue = !less && !equal;
+            else boolean.fValue = !less;
+
+            out = boolean;
+            return true;
+        }
+
+        out = type;
+
+        if (op == "|") out.fValue = (Int64)(x | y);
+        else if (op == "^") out.fValue = (Int64)(x ^ y);
+        else if (op == "&") out.fValue = (Int64)(x & y);
+        else if (op == "/" || op == "%")
+        {
+            if (y == 0)
+                return false;
+
+            if (type.fUnsigned)
+            {
+                out.fValue = (Int64)(op == "/" ? x / y : x % y);
+            }
+            else
+            {
+                // the quotient of the most negative value by -1 does not fit.
+                if (rhs.fValue == -1 &&
+                    lhs.fValue == cxx_value_fit(CompilerValue{ .fValue = (Int64)(1ULL << (type.fBits - 1)), .fBits = type.fBits }).fValue)
+                    return false;
+
+                out.fValue = op == "/" ? lhs.fValue / rhs.fValue : lhs.fValue % rhs.fValue;
+            }
+        }
+        else if (op == "+" || op == "-" || op == "*")
+        {
+            if (type.fUnsigned)
+            {
+                out.fValue = (Int64)(op == "+" ? x + y : op == "-" ? x - y : x * y);
+            }
+            else
+            {
+                Int64 result = 0;
+                bool overflow = false;
+
+                if (op == "+") overflow = __builtin_add_overflow(lhs.fValue, rhs.fValue, &result);
+                else if (op == "-") overflow = __builtin_sub_overflow(lhs.fValue, rhs.fValue, &result);
+                else overflow = __builtin_mul_overflow(lhs.fValue, rhs.fValue, &result);
+
+                out.fValue = result;
+
+                if (overflow ||
+                    cxx_value_fit(out).fValue != result)
+                    return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        out = cxx_value_fit(out);
+        return true;
+    }
+
+    /// @brief the value as a number in the source.
+    static std::string cxx_value_text(const CompilerValue& value)
+    {
+        return value.fUnsigned ? std::to_string((UInt64)value.fValue) : std::to_string(value.fValue);
+    }
+
+    /// @brief the type named by the specifiers in [from, to), false if one of them
+    /// names no integer type. auto tells that the initializer gives the type.
+    static bool cxx_value_type(const std::vector<CompilerToken>& tokens, SizeType from, SizeType to, CompilerValue& type, bool& is_auto)
+    {
+        type = CompilerValue{};
+        is_auto = false;
+
+        for (auto at = from; at < to; ++at)
+        {
+            auto& text = tokens[at].fText;
+
+            if (text == "unsigned") type.fUnsigned = true;
+            else if (text == "bool") type.fBits = 1;
+            else if (text == "char") type.fBits = 8;
+            else if (text == "short") type.fBits = 16;
+            else if (text == "long") type.fBits = 64;
+            else if (text == "auto") is_auto = true;
+            else if (!is_specifier(text)) return false;
+        }
+
+        if (type.fBits == 1)
+            type.fUnsigned = false;
+
+        return true;
+    }
+
+    /// @brief an integer literal with the type C++ gives it, false if none can hold it.
+    static bool cxx_value_literal(const std::string& text, CompilerValue& value)
+    {
+        char* end = nullptr;
+
+        errno = 0;
+        auto number = std::strtoull(text.c_str(), &end, 0);
+
+        if (errno == ERANGE)
+            return false;
+
+        bool is_unsigned = false;
+        bool is_long = false;
+
+        for (auto suffix = (const char*)end; suffix < text.c_str() + text.size(); ++suffix)
+        {
+            if (*suffix == 'u' || *suffix == 'U') is_unsigned = true;
+            else if (*suffix == 'l' || *suffix == 'L') is_long = true;
+            else return false;
+        }
+
+        // a decimal one is never unsigned without its suffix.
+        bool is_decimal = text[0] != '0' || text.size() == 1 || (!isdigit(text[1]) && text[1] != 'x' && text[1] != 'X');
+
+        std::vector<CompilerValue> types;
+
+        if (!is_long && !is_unsigned) types.push_back({ .fBits = 32 });
+        if (!is_long && (is_unsigned || !is_decimal)) types.push_back({ .fBits = 32, .fUnsigned = true });
+        if (!is_unsigned) types.push_back({ .fBits = 64 });
+        if (is_unsigned || !is_decimal) types.push_back({ .fBits = 64, .fUnsigned = true });
+
+        for (auto& type : types)
+        {
+            if (type.fBits == 64 && type.fUnsigned)
+            {
+                value = type;
+                value.fValue = (Int64)number;
+
+                return true;
+            }
+
+            UInt64 limit = type.fBits == 64 ? (UInt64)INT64_MAX : type.fUnsigned ? UINT32_MAX : INT32_MAX;
+
+            if (number <= limit)
+            {
+                value = type;
+                value.fValue = (Int64)number;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief tokens of a line, false on a literal left open.
+    static bool cxx_tokenize(const std::string& line, std::vector<CompilerToken>& tokens)
+    {
+        static const std::vector<std::string> kPunctuators = {
+            "<<=", ">>=", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||", "++", "--",
+            "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "->", "::",
+        };
+
+        for (SizeType at = 0; at < line.size();)
+        {
+            auto start = at;
+
+            if (isspace(line[at]))
+            {
+                ++at;
+                continue;
+            }
+
+            if (line.compare(at, 2, "//") == 0)
+                break;
+
+            if (isalnum(line[at]) || line[at] == '_')
+            {
+                while (at < line.size() &&
+                       (isalnum(line[at]) || line[at] == '_'))
+                    ++at;
+            }
+            else if (line[at] == '"' || line[at] == '\'')
+            {
+                for (++at; at < line.size() && line[at] != line[start]; ++at)
+                {
+                    if (line[at] == '\\')
+                        ++at;
+                }
+
+                if (at >= line.size())
+                    return false;
+
+                ++at;
+            }
+            else
+            {
+                auto it = std::find_if(kPunctuators.begin(), kPunctuators.end(), [&](const std::string& punctuator) {
+                    return line.compare(at, punctuator.size(), punctuator) == 0;
+                });
+
+                at += it != kPunctuators.end() ? it->size() : 1;
+            }
+
+            tokens.push_back({ .fText = line.substr(start, at - start), .fAt = start });
+        }
+
+        return true;
+    }
+
+    void CompilerEvaluator::Reset()
+    {
+        fFunctions.clear();
+        fConstants.clear();
+        fFrames.clear();
+        fPendingLines.clear();
+        fPending.clear();
+        fData.clear();
+        fDepth = 0;
+    }
+
+    bool CompilerEvaluator::Step()
+    {
+        if (++fSteps <= kConstexprSteps)
+            return true;
+
+        fExhausted = true;
+        return false;
+    }
+
+    bool CompilerEvaluator::Expect(const Tokens& tokens, SizeType& at, const char* text)
+    {
+        if (at >= tokens.size() ||
+            tokens[at].fText != text)
+            return false;
+
+        ++at;
+        return true;
+    }
+
+    bool CompilerEvaluator::Expression(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live)
+    {
+        if (!this->Binary(tokens, at, value, live, 0))
+            return false;
+
+        if (at >= tokens.size() ||
+            tokens[at].fText != "?")
+            return true;
+
+        CompilerValue taken;
+        CompilerValue other;
+
+        bool cond = value.fValue != 0;
+
+        ++at;
+
+        if (!this->Expression(tokens, at, taken, live && cond) ||
+            !this->Expect(tokens, at, ":") ||
+            !this->Expression(tokens, at, other, live && !cond))
+            return false;
+
+        // both arms have the type they meet in, the one not taken too.
+        auto type = taken.fBits == 1 && other.fBits == 1 ? taken : cxx_value_common(taken, other);
+        type.fKnown = taken.fKnown && other.fKnown;
+
+        if (live &&
+            !type.fKnown)
+            return false;
+
+        value = cxx_value_cast(cond ? taken : other, type);
+        return true;
+    }
+
+    /// @brief binary operators, from the loosest to the tightest.
+    bool CompilerEvaluator::Binary(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live, SizeType level)
+    {
+        static const std::vector<std::vector<std::string>> kLevels = {
+            { "||" }, { "&&" }, { "|" }, { "^" }, { "&" }, { "==", "!=" },
+            { "<", "<=", ">", ">=" }, { "<<", ">>" }, { "+", "-" }, { "*", "/", "%" },
+        };
+
+        if (level == kLevels.size())
+            return this->Unary(tokens, at, value, live);
+
+        if (!this->Binary(tokens, at, value, live, level + 1))
+            return false;
+
+        while (at < tokens.size() &&
+               std::find(kLevels[level].begin(), kLevels[level].end(), tokens[at].fText) != kLevels[level].end())
+        {
+            auto op = tokens[at++].fText;
+
+            // the right side of && and || only runs when it decides.
+            bool rhs_live = live;
+
+            if (op == "&&") rhs_live = live && value.fValue;
+            if (op == "||") rhs_live = live && !value.fValue;
+
+            CompilerValue rhs;
+
+            if (!this->Binary(tokens, at, rhs, rhs_live, level + 1))
+                return false;
+
+            // a dead operand has no value, the result has its type still.
+            if (!live)
+            {
+                rhs.fValue = 0;
+                value.fValue = 0;
+
+                if ((op == "/" || op == "%")) rhs.fValue = 1;
+                if ((op == "<<" || op == ">>")) rhs = CompilerValue{};
+            }
+
+            if (!cxx_value_binary(op, value, rhs, value))
+                return false;
+        }
+
+        return true;
+    }
+
+    bool CompilerEvaluator::Unary(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live)
+    {
+        if (at >= tokens.size())
+            return false;
+
+        auto& op = tokens[at].fText;
+
+        if (op == "-" || op == "+" || op == "!" || op == "~")
+        {
+            ++at;
+
+            if (!this->Unary(tokens, at, value, live))
+                return false;
+
+            if (op == "!")
+            {
+                value = CompilerValue{ .fValue = !value.fValue };
+                return true;
+            }
+
+            value = cxx_value_promote(value);
+
+            if (!live)
+                return true;
+
+            if (op == "-")
+                return cxx_value_binary("-", CompilerValue{ .fBits = value.fBits, .fUnsigned = value.fUnsigned }, value, value);
+
+            if (op == "~")
+                value = cxx_value_fit(CompilerValue{ .fValue = ~value.fValue, .fBits = value.fBits, .fUnsigned = value.fUnsigned });
+
+            return true;
+        }
+
+        // a cast to an integer type, anything else is not folded.
+        if (op == "(" &&
+            at + 1 < tokens.size() &&
+            is_specifier(tokens[at + 1].fText))
+        {
+            auto from = ++at;
+
+            while (at < tokens.size() &&
+                   tokens[at].fText != ")")
+                ++at;
+
+            CompilerValue type;
+            bool is_auto = false;
+
+            if (!cxx_value_type(tokens, from, at, type, is_auto) ||
+                is_auto ||
+                !this->Expect(tokens, at, ")") ||
+                !this->Unary(tokens, at, value, live))
+                return false;
+
+            value = cxx_value_cast(value, type);
+            return true;
+        }
+
+        return this->Primary(tokens, at, value, live);
+    }
+
+    bool CompilerEvaluator::Primary(const Tokens& tokens, SizeType& at, CompilerValue& value, bool live)
+    {
+        if (at >= tokens.size() ||
+            (live && !this->Step()))
+            return false;
+
+        auto& text = tokens[at++].fText;
+
+        value = CompilerValue{};
+
+        if (isdigit(text[0]))
+            return cxx_value_literal(text, value);
+
+        if (text[0] == '\'')
+        {
+            value.fBits = 8;
+
+            if (text.size() == 3)
+            {
+                value.fValue = text[1];
+                return true;
+            }
+
+            if (text.size() != 4 ||
+                text[1] != '\\')
+                return false;
+
+            switch (text[2])
+            {
+            case 'n': value.fValue = '\n'; return true;
+            case 't': value.fValue = '\t'; return true;
+            case 'r': value.fValue = '\r'; return true;
+            case '0': value.fValue = 0; return true;
+            case '\\': case '\'': case '"': value.fValue = text[2]; return true;
+            default: return false;
+            }
+        }
+
+        if (text == "(")
+            return this->Expression(tokens, at, value, live) && this->Expect(tokens, at, ")");
+
+        if (text == "true" || text == "false")
+        {
+            value = CompilerValue{ .fValue = text == "true", .fBits = 1 };
+            return true;
+        }
+
+        if (!is_identifier(text))
+            return false;
+
+        if (at < tokens.size() &&
+            tokens[at].fText == "(")
+        {
+            std::vector<CompilerValue> args;
+
+            ++at;
+
+            while (at < tokens.size() &&
+                   tokens[at].fText != ")")
+            {
+                CompilerValue arg;
+
+                if (!this->Expression(tokens, at, arg, live))
+                    return false;
+
+                args.push_back(arg);
+
+                if (at < tokens.size() &&
+                    tokens[at].fText == ",")
+                    ++at;
+            }
+
+            if (!this->Expect(tokens, at, ")"))
+                return false;
+
+            if (!live)
+            {
+                auto it = fFunctions.find(text);
+
+                // what an auto one returns is only known by running it.
+                if (it == fFunctions.end() ||
+                    it->second.fAuto)
+                    value.fKnown = false;
+                else
+                    value = CompilerValue{ .fBits = it->second.fReturn.fBits, .fUnsigned = it->second.fReturn.fUnsigned };
+
+                return true;
+            }
+
+            return this->Call(text, args, value);
+        }
+
+        if (at < tokens.size() &&
+            tokens[at].fText == "[")
+        {
+            CompilerValue index;
+
+            ++at;
+
+            if (!this->Expression(tokens, at, index, live) ||
+                !this->Expect(tokens, at, "]"))
+                return false;
+
+            auto it = fConstants.find(text);
+
+            if (!live)
+            {
+                if (it != fConstants.end())
+                    value = it->second.fType;
+                else
+                    value.fKnown = false;
+
+                return true;
+            }
+
+            if (it == fConstants.end() ||
+                !it->second.fTable ||
+                (!index.fUnsigned && index.fValue < 0) ||
+                (UInt64)index.fValue >= it->second.fValues.size())
+                return false;
+
+            value = it->second.fType;
+            value.fValue = it->second.fValues[index.fValue];
+
+            return true;
+        }
+
+        if (!fFrames.empty())
+        {
+            if (auto it = fFrames.back().find(text);
+                it != fFrames.back().end())
+            {
+                value = it->second;
+                return true;
+            }
+        }
+
+        auto it = fConstants.find(text);
+
+        // a name a dead branch declared, its value is never read.
+        if (!live &&
+            it == fConstants.end())
+        {
+            value.fKnown = false;
+            return true;
+        }
+
+        if (it == fConstants.end() ||
+            it->second.fTable)
+            return false;
+
+        value = it->second.fType;
+        value.fValue = it->second.fValues[0];
+
+        return true;
+    }
+
+    bool CompilerEvaluator::Call(const std::string& name, const std::vector<CompilerValue>& args, CompilerValue& value)
+    {
+        auto it = fFunctions.find(name);
+
+        if (it == fFunctions.end() ||
+            it->second.fParams.size() != args.size() ||
+            fFrames.size() >= kConstexprDepth)
+            return false;
+
+        auto& function = it->second;
+
+        fFrames.emplace_back();
+
+        for (SizeType index = 0; index < args.size(); ++index)
+            fFrames.back()[function.fParams[index]] = cxx_value_cast(args[index], function.fParamTypes[index]);
+
+        SizeType at = 0;
+        auto status = this->Statement(function.fBody, at, value, true);
+
+        fFrames.pop_back();
+
+        if (!function.fAuto)
+            value = cxx_value_cast(value, function.fReturn);
+
+        // falling off the end gives no value.
+        return status == kStmtReturn;
+    }
+
+    /// @brief name = e, name op= e, name++ and the like, or an expression, without its ';'.
+    Int32 CompilerEvaluator::Simple(const Tokens& tokens, SizeType& at, bool live)
+    {
+        static const std::vector<std::string> kAssignments = {
+            "=", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "<<=", ">>=",
+        };
+
+        CompilerValue value;
+
+        std::string name;
+        std::string op;
+
+        if (at + 1 < tokens.size() &&
+            (tokens[at].fText == "++" || tokens[at].fText == "--"))
+        {
+            op = tokens[at].fText;
+            name = tokens[at + 1].fText;
+
+            at += 2;
+        }
+        else if (at + 1 < tokens.size() &&
+                 is_identifier(tokens[at].fText) &&
+                 (tokens[at + 1].fText == "++" || tokens[at + 1].fText == "--" ||
+                  std::find(kAssignments.begin(), kAssignments.end(), tokens[at + 1].fText) != kAssignments.end()))
+        {
+            name = tokens[at].fText;
+            op = tokens[at + 1].fText;
+
+            at += 2;
+
+            if (op != "++" && op != "--" &&
+                !this->Expression(tokens, at, value, live))
+                return kStmtFail;
+        }
+        else
+        {
+            return this->Expression(tokens, at, value, live) ? kStmtNext : kStmtFail;
+        }
+
+        if (!live)
+            return kStmtNext;
+
+        if (fFrames.empty() ||
+            !fFrames.back().count(name))
+            return kStmtFail;
+
+        auto& slot = fFrames.back()[name];
+
+        // a++ is a += 1, a op= b is a = a op b, the slot keeps its type.
+        if (op == "++" || op == "--")
+        {
+            value = CompilerValue{ .fValue = 1 };
+            op = op.substr(1) + "=";
+        }
+
+        if (op != "=" &&
+            !cxx_value_binary(op.substr(0, op.size() - 1), slot, value, value))
+            return kStmtFail;
+
+        slot = cxx_value_cast(value, slot);
+        return kStmtNext;
+    }
+
+    Int32 CompilerEvaluator::Statement(const Tokens& tokens, SizeType& at, CompilerValue& result, bool live)
+    {
+        if (at >= tokens.size() ||
+            (live && !this->Step()))
+            return kStmtFail;
+
+        auto& text = tokens[at].fText;
+
+        if (text == "{")
+        {
+            Int32 status = kStmtNext;
+
+            for (++at; at < tokens.size() && tokens[at].fText != "}";)
+            {
+                // once a statement leaves the block, the rest is only read.
+                auto inner = this->Statement(tokens, at, result, live);
+
+                if (inner == kStmtFail)
+                    return kStmtFail;
+
+                if (live &&
+                    inner != kStmtNext)
+                {
+                    status = inner;
+                    live = false;
+                }
+            }
+
+            return this->Expect(tokens, at, "}") ? status : kStmtFail;
+        }
+
+        if (text == ";")
+        {
+            ++at;
+            return kStmtNext;
+        }
+
+        if (text == "return")
+        {
+            CompilerValue value;
+
+            ++at;
+
+            if (!this->Expression(tokens, at, value, live) ||
+                !this->Expect(tokens, at, ";"))
+                return kStmtFail;
+
+            if (!live)
+                return kStmtNext;
+
+            result = value;
+            return kStmtReturn;
+        }
+
+        if (text == "break" || text == "continue")
+        {
+            ++at;
+
+            if (!this->Expect(tokens, at, ";"))
+                return kStmtFail;
+
+            if (!live)
+                return kStmtNext;
+
+            return text == "break" ? kStmtBreak : kStmtContinue;
+        }
+
+        if (text == "if")
+        {
+            CompilerValue cond;
+
+            ++at;
+
+            if (!this->Expect(tokens, at, "(") ||
+                !this->Expression(tokens, at, cond, live) ||
+                !this->Expect(tokens, at, ")"))
+                return kStmtFail;
+
+            auto status = this->Statement(tokens, at, result, live && cond.fValue);
+
+            if (status == kStmtFail)
+                return kStmtFail;
+
+            if (at < tokens.size() &&
+                tokens[at].fText == "else")
+            {
+                ++at;
+
+                auto other = this->Statement(tokens, at, result, live && !cond.fValue);
+
+                if (other == kStmtFail)
+                    return kStmtFail;
+
+                if (live && !cond.fValue)
+                    status = other;
+            }
+
+            return status;
+        }
+
+        if (text == "while" || text == "for")
+        {
+            bool is_for = text == "for";
+            CompilerValue cond{ .fValue = 1 };
+
+            ++at;
+
+            if (!this->Expect(tokens, at, "("))
+                return kStmtFail;
+
+            if (is_for)
+            {
+                // the init is a statement of its own, with its ';'.
+                if (this->Statement(tokens, at, result, live) != kStmtNext)
+                    return kStmtFail;
+            }
+
+            auto cond_at = at;
+
+            // read the loop once to know where it ends.
+            SizeType step_at = 0;
+            SizeType body_at = 0;
+
+            if (!(is_for && tokens[at].fText == ";") &&
+                !this->Expression(tokens, at, cond, false))
+                return kStmtFail;
+
+            if (is_for)
+            {
+                if (!this->Expect(tokens, at, ";"))
+                    return kStmtFail;
+
+                step_at = at;
+
+                if (tokens[at].fText != ")" &&
+                    this->Simple(tokens, at, false) == kStmtFail)
+                    return kStmtFail;
+            }
+
+            if (!this->Expect(tokens, at, ")"))
+                return kStmtFail;
+
+            body_at = at;
+
+            if (this->Statement(tokens, at, result, false) == kStmtFail)
+                return kStmtFail;
+
+            auto end = at;
+
+            while (live)
+            {
+                at = cond_at;
+                cond = CompilerValue{ .fValue = 1 };
+
+                if (!(is_for && tokens[at].fText == ";") &&
+                    !this->Expression(tokens, at, cond, true))
+                    return kStmtFail;
+
+                if (!cond.fValue)
+                    break;
+
+                at = body_at;
+
+                auto status = this->Statement(tokens, at, result, true);
+
+                if (status == kStmtFail ||
+                    status == kStmtReturn)
+                    return status;
+
+                if (status == kStmtBreak)
+                    break;
+
+                if (is_for &&
+                    tokens[step_at].fText != ")")
+                {
+                    at = step_at;
+
+                    if (this->Simple(tokens, at, true) == kStmtFail)
+                        return kStmtFail;
+                }
+            }
+
+            at = end;
+            return kStmtNext;
+        }
+
+        // a local, 'int a = 1, b;'.
+        if (is_specifier(text))
+        {
+            auto from = at;
+
+            while (at < tokens.size() &&
+                   is_specifier(tokens[at].fText))
+                ++at;
+
+            CompilerValue type;
+            bool is_auto = false;
+
+            cxx_value_type(tokens, from, at, type, is_auto);
+
+            while (at < tokens.size())
+            {
+                if (!is_identifier(tokens[at].fText))
+                    return kStmtFail;
+
+                auto& name = tokens[at++].fText;
+                CompilerValue value = type;
+
+                if (at < tokens.size() &&
+                    (tokens[at].fText == "=" || tokens[at].fText == "{"))
+                {
+                    bool braced = tokens[at++].fText == "{";
+
+                    if (!this->Expression(tokens, at, value, live) ||
+                        (braced && !this->Expect(tokens, at, "}")))
+                        return kStmtFail;
+                }
+
+                if (live)
+                {
+                    if (fFrames.empty())
+                        return kStmtFail;
+
+                    fFrames.back()[name] = is_auto ? value : cxx_value_cast(value, type);
+                }
+
+                if (this->Expect(tokens, at, ";"))
+                    return kStmtNext;
+
+                if (!this->Expect(tokens, at, ","))
+                    return kStmtFail;
+            }
+
+            return kStmtFail;
+        }
+
+        auto status = this->Simple(tokens, at, live);
+
+        if (status == kStmtFail ||
+            !this->Expect(tokens, at, ";"))
+            return kStmtFail;
+
+        return status;
+    }
+
+    /// @brief specifiers name ( params ) { body }, false if it is not a definition.
+    bool CompilerEvaluator::Function(const Tokens& tokens)
+    {
+        SizeType at = 0;
+
+        while (at < tokens.size() &&
+               is_specifier(tokens[at].fText))
+            ++at;
+
+        if (at + 1 >= tokens.size() ||
+            !is_identifier(tokens[at].fText) ||
+            tokens[at + 1].fText != "(")
+            return false;
+
+        CompilerConstFunction function;
+        bool is_auto = false;
+
+        if (!cxx_value_type(tokens, 0, at, function.fReturn, function.fAuto))
+            return false;
+
+        auto& name = tokens[at].fText;
+        auto from = at + 2;
+
+        for (at += 2; at < tokens.size() && tokens[at].fText != ")"; ++at)
+        {
+            // the last name before a ',' or the ')' is the parameter, its type is what precedes it.
+            if (is_identifier(tokens[at].fText) &&
+                !is_specifier(tokens[at].fText) &&
+                (tokens[at + 1].fText == "," || tokens[at + 1].fText == ")"))
+            {
+                CompilerValue type;
+
+                if (!cxx_value_type(tokens, from, at, type, is_auto) ||
+                    is_auto)
+                    return false;
+
+                function.fParams.push_back(tokens[at].fText);
+                function.fParamTypes.push_back(type);
+            }
+
+            if (tokens[at].fText == ",")
+                from = at + 1;
+        }
+
+        while (at < tokens.size() &&
+               tokens[at].fText != "{")
+            ++at;
+
+        function.fBody.assign(tokens.begin() + std::min(at, tokens.size()), tokens.end());
+
+        if (function.fBody.empty())
+            return false;
+
+        fFunctions[name] = std::move(function);
+        return true;
+    }
+
+    /// @brief an integer, or a table of them, with an initializer.
+    /// constexpr and const ones fold where used, the file scope ones are .data.
+    bool CompilerEvaluator::Declaration(const Tokens& tokens, bool& taken)
+    {
+        SizeType at = 0;
+
+        bool constant = false;
+        bool constexpr_ = false;
+
+        for (; at < tokens.size() && is_specifier(tokens[at].fText); ++at)
+        {
+            auto& text = tokens[at].fText;
+
+            constexpr_ |= text == "constexpr";
+            constant |= text == "constexpr" || text == "const";
+        }
+
+        CompilerValue type;
+        bool is_auto = false;
+
+        cxx_value_type(tokens, 0, at, type, is_auto);
+
+        taken = false;
+
+        if (at == 0 ||
+            at >= tokens.size() ||
+            !is_identifier(tokens[at].fText) ||
+            (!constant && fDepth > 0))
+            return false;
+
+        auto& name = tokens[at++].fText;
+
+        CompilerConstant entry{ .fType = type, .fDepth = fDepth };
+        CompilerValue count{ .fValue = -1 };
+
+        fSteps = 0;
+        fExhausted = false;
+
+        if (at < tokens.size() &&
+            tokens[at].fText == "[")
+        {
+            entry.fTable = true;
+            ++at;
+
+            if (is_auto ||
+                (tokens[at].fText != "]" &&
+                 (!this->Expression(tokens, at, count, true) || (!count.fUnsigned && count.fValue < 0))))
+                goto cxx_not_constant;
+
+            if (!this->Expect(tokens, at, "]"))
+                return false;
         }
 
-        if (kState.fLastFile != file)
+        if (!this->Expect(tokens, at, "="))
+            return false;
+
+        if (entry.fTable)
         {
-            std::cout << kRed << "[ cxx ] " << kWhite << ((file == "cxx") ? "internal compiler error " : ("in file, " + file)) << kBlank << std::endl;
-            std::cout << kRed << "[ cxx ] " << kWhite << reason << kBlank << std::endl;
+            if (!this->Expect(tokens, at, "{"))
+                return false;
 
-            kState.fLastFile = file;
+            while (at < tokens.size() &&
+                   tokens[at].fText != "}")
+            {
+                CompilerValue value;
+
+                if (!this->Expression(tokens, at, value, true))
+                    goto cxx_not_constant;
+
+                entry.fValues.push_back(cxx_value_cast(value, type).fValue);
+
+                if (at < tokens.size() &&
+                    tokens[at].fText == ",")
+                    ++at;
+            }
+
+            if (!this->Expect(tokens, at, "}"))
+                return false;
+
+            auto size = count.fValue == -1 && !count.fUnsigned ? entry.fValues.size() : (SizeType)count.fValue;
+
+            if (size < entry.fValues.size())
+                goto cxx_not_constant;
+
+            entry.fValues.resize(size, 0);
         }
         else
         {
-            std::cout << kRed << "[ cxx ] [ " << kState.fLastFile <<  " ] " << kWhite << reason << kBlank << std::endl;
+            CompilerValue value;
+
+            if (!this->Expression(tokens, at, value, true))
+                goto cxx_not_constant;
+
+            // auto takes the type of its initializer.
+            if (is_auto)
+                entry.fType = value;
+
+            entry.fValues.push_back(cxx_value_cast(value, entry.fType).fValue);
         }
 
-        if (kAcceptableErrors > kErrorLimit)
-            std::exit(3);
+        if (!this->Expect(tokens, at, ";") ||
+            at != tokens.size())
+            goto cxx_not_constant;
 
-        ++kAcceptableErrors;
+        taken = true;
+
+        if (constant)
+            fConstants[name] = entry;
+
+        // nothing is stored at startup, the record is loaded with its value.
+        if (fDepth == 0)
+        {
+            auto bits = entry.fType.fBits;
+            std::string width = bits <= 8 ? "byte" : bits == 16 ? "hword" : bits == 32 ? "dword" : "qword";
+
+            fData += "__export .data " + name + "\n\t" + width;
+
+            for (SizeType index = 0; index < entry.fValues.size(); ++index)
+            {
+                auto value = (UInt64)entry.fValues[index];
+
+                // the record holds the bits of it.
+                if (bits < 64)
+                    value &= (1ULL << std::max<UInt8>(bits, 8)) - 1;
+
+                fData += (index ? ", " : " ") + std::to_string(value);
+            }
+
+            fData += "\n\n";
+
+            kCompilerVariables.push_back({ .fValue = name });
+        }
+
+        return true;
+
+    cxx_not_constant:
+        if (constexpr_)
+        {
+            taken = true;
+
+            detail::print_error("constexpr variable " + name + " is not a constant expression" +
+                                (fExhausted ? ", it takes more than -fconstexpr-steps." : "."),
+                                kState.fSourceFile, kState.fSourceLine);
+        }
+
+        return false;
     }
 
-    struct CompilerType
+    /// @brief constant calls, constants and table reads become numbers, and so do
+    /// whole constant expressions after '=', 'return', '(', '[', ',' and '{'.
+    std::string CompilerEvaluator::Fold(const std::string& line, const Tokens& tokens)
     {
-        std::string fName;
-        std::string fValue;
-    };
-}
+        static const std::vector<std::string> kStarts = { "=", "return", "(", "[", ",", "{" };
+        static const std::vector<std::string> kEnds = { ";", "]", ")", ",", "}" };
 
-/////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::pair<SizeType, std::string>> folds; // token range [first, second) as text.
+        std::vector<SizeType> ends;
 
-// Target architecture.
-static int kMachine = 0;
+        for (SizeType index = 0; index < tokens.size();)
+        {
+            auto& text = tokens[index].fText;
 
-/////////////////////////////////////////
+            bool start = index > 0 &&
+                         std::find(kStarts.begin(), kStarts.end(), tokens[index - 1].fText) != kStarts.end();
 
-// REGISTERS ACCORDING TO USED ASSEMBLER
+            // a declaration names what it declares, it does not read it.
+            bool declared = index > 0 &&
+                            (is_specifier(tokens[index - 1].fText) || tokens[index - 1].fText == "." ||
+                             tokens[index - 1].fText == "->" || tokens[index - 1].fText == "*");
 
-/////////////////////////////////////////
+            bool known = fFunctions.count(text) || fConstants.count(text);
 
-static size_t kRegisterCnt = kAsmRegisterLimit;
-static size_t kStartUsable = 1;
-static size_t kUsableLimit = 14;
-static size_t kRegisterCounter = kStartUsable;
-static std::string kRegisterPrefix = kAsmRegisterPrefix;
+            if ((start || known) &&
+                !declared)
+            {
+                SizeType at = index;
+                CompilerValue value;
 
-/////////////////////////////////////////
+                fSteps = 0;
+                fExhausted = false;
 
-// COMPILER PARSING UTILITIES/STATES.
+                bool folded = start ? this->Expression(tokens, at, value, true) : this->Primary(tokens, at, value, true);
 
-/////////////////////////////////////////
+                if (folded && start &&
+                    (at >= tokens.size() || std::find(kEnds.begin(), kEnds.end(), tokens[at].fText) == kEnds.end()))
+                    folded = false;
 
-static std::vector<std::string> kFileList;
-static CxxKit::AssemblyFactory kFactory;
-static bool kInStruct = false;
-static bool kOnWhileLoop = false;
-static bool kOnForLoop = false;
-static bool kInBraces = false;
-static size_t kBracesCount = 0UL;
+                // a span from a start that is not whole may still hold a constant call.
+                if (!folded &&
+                    start &&
+                    known)
+                {
+                    at = index;
+                    fSteps = 0;
 
-/* @brief C compiler backend for Amlal El Mahrouss C */
-class CompilerBackendClang final : public ParserKit::CompilerBackend
-{
-public:
-    explicit CompilerBackendClang() = default;
-    ~CompilerBackendClang() override = default;
+                    folded = this->Primary(tokens, at, value, true);
+                }
 
-    CXXKIT_COPY_DEFAULT(CompilerBackendClang);
+                if (folded &&
+                    (at - index > 1 || known))
+                {
+                    folds.emplace_back(index, cxx_value_text(value));
+                    ends.push_back(at);
 
-    std::string Check(const char* text, const char* file);
-    void Compile(const char* text, const char* file) override;
+                    index = at;
+                    continue;
+                }
 
-    const char* Language() override { return "C++"; }
+                if (fFunctions.count(text) &&
+                    index + 1 < tokens.size() &&
+                    tokens[index + 1].fText == "(")
+                    fFunctions[text].fRuntime = true;
+            }
 
-};
+            ++index;
+        }
 
-static CompilerBackendClang* kCompilerBackend = nullptr;
-static std::vector<detail::CompilerType> kCompilerVariables;
-static std::vector<std::string>          kCompilerFunctions;
-static std::vector<detail::CompilerType> kCompilerTypes;
+        auto folded = line;
 
-// @brief this hook code before the begin/end command.
-static std::string kAddIfAnyBegin;
-static std::string kAddIfAnyEnd;
-static std::string kLatestVar;
+        // from the last one back, the offsets of the others stay.
+        for (SizeType fold = folds.size(); fold-- > 0;)
+        {
+            auto first = tokens[folds[fold].first].fAt;
+            auto last = tokens[ends[fold] - 1].fAt + tokens[ends[fold] - 1].fText.size();
 
-static std::string cxx_parse_function_call(std::string& _text)
-{
-    if (_text[0] == '(') {
-        std::string substr;
-        std::string args_buffer;
-        std::string args;
+            folded.replace(first, last - first, folds[fold].second);
+        }
 
-        bool type_crossed = false;
+        return folded;
+    }
 
-        for (char substr_first_index: _text)
+    std::vector<std::string> CompilerEvaluator::Line(const std::string& line)
+    {
+        Tokens tokens;
+
+        if (!cxx_tokenize(line, tokens))
+            return { line };
+
+        // the rest of a constexpr function, or of a table, read so far.
+        if (!fPendingLines.empty())
         {
-            args_buffer += substr_first_index;
+            fPendingLines.push_back(line);
+            fPending.insert(fPending.end(), tokens.begin(), tokens.end());
 
-            if (substr_first_index == ';')
+            tokens = fPending;
+        }
+
+        SizeType braces = 0;
+        SizeType opened = 0;
+
+        for (auto& token : tokens)
+        {
+            if (token.fText == "{") ++braces, ++opened;
+            if (token.fText == "}" && braces > 0) --braces;
+        }
+
+        bool specified = !tokens.empty() &&
+                         is_specifier(tokens[0].fText);
+
+        bool is_constexpr = std::any_of(tokens.begin(), tokens.end(), [](const CompilerToken& token) { return token.fText == "constexpr"; });
+
+        auto paren = std::find_if(tokens.begin(), tokens.end(), [](const CompilerToken& token) { return token.fText == "(" || token.fText == "="; });
+        bool is_function = specified && is_constexpr && paren != tokens.end() && paren->fText == "(";
+
+        auto lines = fPendingLines.empty() ? std::vector<std::string>{ line } : fPendingLines;
+
+        if (is_function)
+        {
+            // a declaration alone.
+            if (!opened &&
+                tokens.back().fText == ";")
             {
-                args_buffer = args_buffer.erase(0, args_buffer.find('('));
-                args_buffer = args_buffer.erase(args_buffer.find(';'), 1);
-                args_buffer = args_buffer.erase(args_buffer.find(')'), 1);
-                args_buffer = args_buffer.erase(args_buffer.find('('), 1);
+                fPendingLines.clear();
+                fPending.clear();
+
+                return {};
+            }
+
+            if (!opened || braces > 0)
+            {
+                fPendingLines = lines;
+                fPending = tokens;
+
+                return {};
+            }
+
+            fPendingLines.clear();
+            fPending.clear();
+
+            if (!this->Function(tokens))
+                return lines;
+
+            auto& function = fFunctions[paren[-1].fText];
+            function.fLine = kState.fSourceLine + 1 - lines.size();
+
+            // compiled as any function if a call is left, constexpr means nothing there.
+            for (auto& source : lines)
+            {
+                auto text = source;
+
+                if (auto keyword = text.find("constexpr ");
+                    keyword != std::string::npos)
+                    text.erase(keyword, strlen("constexpr "));
+
+                function.fLines.push_back(text);
+            }
+
+            return {};
+        }
+
+        if (specified &&
+            std::any_of(tokens.begin(), tokens.end(), [](const CompilerToken& token) { return token.fText == "="; }))
+        {
+            // a table whose initializer goes on.
+            if (braces > 0 ||
+                tokens.back().fText != ";")
+            {
+                fPendingLines = lines;
+                fPending = tokens;
+
+                return {};
+            }
+
+            fPendingLines.clear();
+            fPending.clear();
+
+            bool taken = false;
+
+            if (this->Declaration(tokens, taken) ||
+                taken)
+                return {};
+        }
+
+        fPendingLines.clear();
+        fPending.clear();
+
+        std::vector<std::string> folded;
+
+        for (auto& source : lines)
+        {
+            Tokens source_tokens;
+            cxx_tokenize(source, source_tokens);
+
+            folded.push_back(this->Fold(source, source_tokens));
 
-                if (!args_buffer.empty())
-                    args += "\tpsh ";
+            for (auto& token : source_tokens)
+            {
+                if (token.fText == "{")
+                    ++fDepth;
+
+                if (token.fText != "}" ||
+                    fDepth == 0)
+                    continue;
+
+                --fDepth;
+
+                // constants of the scope that closed.
+                std::erase_if(fConstants, [&](const auto& entry) { return entry.second.fDepth > fDepth; });
+            }
+        }
+
+        return folded;
+    }
+
+    std::vector<std::pair<SizeType, std::string>> CompilerEvaluator::RuntimeLines() const
+    {
+        std::vector<std::pair<SizeType, std::string>> lines;
+
+        for (auto& [name, function] : fFunctions)
+        {
+            if (!function.fRuntime)
+                continue;
+
+            for (SizeType index = 0; index < function.fLines.size(); ++index)
+            {
+                auto& source = function.fLines[index];
+                Tokens tokens;
 
-                while (args_buffer.find(',') != std::string::npos)
+                if (!cxx_tokenize(source, tokens))
                 {
-                    args_buffer.replace(args_buffer.find(','), 1, "\n\tpsh ");
+                    lines.emplace_back(function.fLine + index, source);
+                    continue;
+                }
+
+                // the compiler reads a function as a line with its '{', a statement a line
+                // and a '}' alone, a body written on one line is laid out that way.
+                SizeType start = 0;
+                SizeType parens = 0;
+
+                auto cut = [&](SizeType end) {
+                    auto text = source.substr(start, end - start);
+
+                    if (text.find_first_not_of(" \t") != std::string::npos)
+                        lines.emplace_back(function.fLine + index, text);
+
+                    start = end;
+                };
+
+                for (auto& token : tokens)
+                {
+                    if (token.fText == "(") ++parens;
+                    if (token.fText == ")" && parens > 0) --parens;
+
+                    if (token.fText == "}")
+                        cut(token.fAt);
+
+                    if (token.fText == "{" ||
+                        token.fText == "}" ||
+                        (token.fText == ";" && parens == 0))
+                        cut(token.fAt + 1);
                 }
 
-                args += args_buffer;
-                args += "\n\tjlr __import ";
+                cut(source.size());
             }
         }
 
-        return args;
+        return lines;
     }
-
-    return "";
 }
 
+static detail::CompilerEvaluator kEvaluator;
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 // @name Compile
@@ -694,6 +2469,7 @@ void CompilerBackendClang::Compile(const char* text, const char* file)
             std::string substr;
             std::string args_buffer;
             std::string args;
+            std::string returned;
 
             bool type_crossed = false;
 
@@ -720,16 +2496,10 @@ void CompilerBackendClang::Compile(const char* text, const char* file)
                     args_buffer = args_buffer.erase(args_buffer.find(')'), 1);
                     args_buffer = args_buffer.erase(args_buffer.find('('), 1);
 
-                    if (!args_buffer.empty())
-                        args += "\tpsh ";
-
-                    while (args_buffer.find(',') != std::string::npos)
-                    {
-                        args_buffer.replace(args_buffer.find(','), 1, "\n\tpsh ");
-                    }
+                    args += cxx_pass_arguments(args_buffer);
+                    args += "\tjlr __import ";
 
-                    args += args_buffer;
-                    args += "\n\tjlr __import ";
+                    returned = cxx_return_from_call(args_buffer);
                 }
             }
 
@@ -758,6 +2528,7 @@ void CompilerBackendClang::Compile(const char* text, const char* file)
                 syntax_tree.fUserValue = args;
 
                 syntax_tree.fUserValue += substr;
+                syntax_tree.fUserValue += returned;
 
                 kState.fSyntaxTree->fLeafList.push_back(syntax_tree);
 
@@ -1457,6 +3228,27 @@ std::string CompilerBackendClang::Check(const char* text, const char* file)
     return err_str;
 }
 
+/// @brief checks a line, then compiles it.
+static void cxx_compile_line(const std::string& line, const char* file)
+{
+    std::string err;
+
+    {
+        CxxKit::PhaseTimer timer(cxx_report(), "check");
+        err = kCompilerBackend->Check(line.c_str(), file);
+    }
+
+    if (err.empty())
+    {
+        CxxKit::PhaseTimer timer(cxx_report(), "parse");
+        kCompilerBackend->Compile(line.c_str(), file);
+    }
+    else
+    {
+        detail::print_error(err, kState.fSourceFile, kState.fSourceLine);
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -1516,19 +3308,48 @@ public:
 
         std::string source;
 
-        while (std::getline(src_fp, source))
+        kState.fSourceFile = src_file;
+        kState.fSourceLine = 0;
+
+        kReport.Reset(src_file);
+        kEvaluator.Reset();
+
+        for (;;)
         {
-            if (auto err = kCompilerBackend->Check(source.c_str(), src.CData());
-                    err.empty())
             {
-                kCompilerBackend->Compile(source.c_str(), src.CData());
+                CxxKit::PhaseTimer timer(cxx_report(), "read");
+
+                if (!std::getline(src_fp, source))
+                    break;
             }
-            else
+
+            ++kState.fSourceLine;
+
+            if (detail::read_line_marker(source))
+                continue;
+
+            std::vector<std::string> lines;
+
             {
-                detail::print_error(err, src.CData());
+                CxxKit::PhaseTimer timer(cxx_report(), "evaluate");
+                lines = kEvaluator.Line(source);
             }
+
+            for (auto& line : lines)
+                cxx_compile_line(line, src.CData());
         }
 
+        // constexpr functions still called at runtime, an error is reported where they are.
+        auto last_line = kState.fSourceLine;
+
+        for (auto& [line_number, line] : kEvaluator.RuntimeLines())
+        {
+            kState.fSourceLine = line_number;
+            cxx_compile_line(line, src.CData());
+        }
+
+        kState.fSourceLine = last_line;
+
         if (src_fp.eof())
         {
             if (kInBraces ||
@@ -1537,58 +3358,60 @@ public:
                 std::string err;
 
                 err += "Unterminated struct/function.\n";
-                detail::print_error(err, src.CData());
+                detail::print_error(err, kState.fSourceFile, kState.fSourceLine);
             }
         }
 
+        if (cxx_report())
+        {
+            kReport.Count("lines", kState.fSourceLine);
+            kReport.Count("leaves", kState.fSyntaxTree->fLeafList.size());
+            kReport.Count("symbols", kCompilerVariables.size() + kCompilerFunctions.size());
+            kReport.Count("stack slots", kState.kStackFrame.size());
+
+            kReport.Memory("peak resident", CxxKit::CompileReport::PeakResident());
+        }
+
         if (kAcceptableErrors > 0)
             return -1;
 
-        for (auto& leaf : kState.fSyntaxTree->fLeafList)
         {
-            if (ParserKit::find_word(leaf.fUserValue, "ldw") ||
-                ParserKit::find_word(leaf.fUserValue, "stw"))
+            CxxKit::PhaseTimer timer(cxx_report(), "register substitution");
+
+            for (auto& leaf : kState.fSyntaxTree->fLeafList)
             {
-                for (auto & reg : kState.kStackFrame)
+                if (ParserKit::find_word(leaf.fUserValue, "ldw") ||
+                    ParserKit::find_word(leaf.fUserValue, "stw"))
                 {
-                    std::string needle;
-
-                    for (size_t i = 0; i < reg.fName.size(); i++)
+                    for (auto & reg : kState.kStackFrame)
                     {
-                        if (reg.fName[i] == ' ')
-                        {
-                            ++i;
-
-                            for (; i < reg.fName.size(); i++)
-                            {
-                                if (reg.fName[i] == ',')
-                                {
-                                    break;
-                                }
+                        std::string needle = cxx_frame_name(reg);
 
-                                needle += reg.fName[i];
-                            }
+                        if (ParserKit::find_word(leaf.fUserValue, needle))
+                        {
+                            leaf.fUserValue.replace(leaf.fUserValue.find(needle),
+                                                    needle.size(), reg.fRegister);
 
                             break;
                         }
                     }
-
-                    if (ParserKit::find_word(leaf.fUserValue, needle))
-                    {
-                        leaf.fUserValue.replace(leaf.fUserValue.find(needle),
-                                                needle.size(), reg.fRegister);
-
-                        break;
-                    }
                 }
             }
+        }
+
+        {
+            CxxKit::PhaseTimer timer(cxx_report(), "write");
+
+            for (auto& leaf : kState.fSyntaxTree->fLeafList)
+                (*kState.fOutputAssembly) << leaf.fUserValue;
 
-            (*kState.fOutputAssembly) << leaf.fUserValue;
+            (*kState.fOutputAssembly) << kEvaluator.fData;
+
+            kState.fOutputAssembly->flush();
         }
 
         kState.fSyntaxTree = nullptr;
 
-        kState.fOutputAssembly->flush();
         kState.fOutputAssembly.reset();
 
         return kOk;
@@ -1606,6 +3429,9 @@ static void cxx_print_help()
     kSplashCxx();
     kPrintF(kWhite "--asm={MACHINE}: %s\n", "Compile to a specific assembler syntax. (masm)");
     kPrintF(kWhite "--compiler={COMPILER}: %s\n", "Select compiler engine (builtin -> dolvik++).");
+    kPrintF(kWhite "-ftime-report[=json]: %s\n", "Print the time of each phase, and what the unit holds, after each file.");
+    kPrintF(kWhite "-fmem-report[=json]: %s\n", "Print the peak memory use, and what the unit holds, after each file.");
+    kPrintF(kWhite "-fconstexpr-steps=N: %s\n", "Give up on a constant expression after N steps. (1048576)");
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -1695,6 +3521,25 @@ int main(int argc, char** argv)
                 continue;
             }
 
+            if (strncmp(argv[index], "-ftime-report", 13) == 0 ||
+                strncmp(argv[index], "-fmem-report", 12) == 0)
+            {
+                auto option = std::string(argv[index]);
+
+                (option[2] == 't' ? kTimeReport : kMemReport) = true;
+
+                if (option.ends_with("=json"))
+                    kReportJson = true;
+
+                continue;
+            }
+
+            if (strncmp(argv[index], "-fconstexpr-steps=", 18) == 0)
+            {
+                kConstexprSteps = std::strtoull(argv[index] + 18, nullptr, 10);
+                continue;
+            }
+
             if (strcmp(argv[index], "-fmax-exceptions") == 0)
             {
                 try
@@ -1734,7 +3579,12 @@ int main(int argc, char** argv)
             return -1;
         }
 
-        if (kFactory.Compile(srcFile, kMachine) != kOk)
+        auto result = kFactory.Compile(srcFile, kMachine);
+
+        if (cxx_report())
+            kReport.Print(std::cerr, kTimeReport, kMemReport, kReportJson);
+
+        if (result != kOk)
             return -1;
     }
 
@@ -12,8 +12,35 @@
 #include <sstream>
 #include <iostream>
 #include <fstream>
+#include <chrono>
+#include <unordered_map>
+#include <filesystem>
+#include <algorithm>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-typedef Int32(*cpp_parser_fn_t)(std::string& line, std::ifstream& hdr_file, std::ofstream& pp_out);
+/// @brief size of the in-memory output buffer, output is only written when it fills up.
+#define kCppOutputBufferSize (1 << 20)
+
+/// @brief largest gap (in lines) filled with blank lines instead of a line marker.
+#define kCppMaxLineGap 8
+
+#define kCppVersion "MP-UX Preprocessor v1.11, (c) Amlal El Mahrouss"
+
+#define kCppHashSeed  0x9E3779B97F4A7C15ULL
+#define kCppHashPrime 0x100000001B3ULL
+
+namespace details
+{
+	class cpp_output_sink;
+	class cpp_mapped_file;
+}
+
+typedef Int32(*cpp_parser_fn_t)(std::string& line, const details::cpp_mapped_file& hdr_file, details::cpp_output_sink& pp_out);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,7 +82,148 @@ namespace details
 		CXXKIT_COPY_DEFAULT(cpp_pragma);
 
 		std::string fMacroName{ "" };
-		Int32(*fParse)(std::string& line, std::ifstream& hdr_file, std::ofstream& pp_out);
+		Int32(*fParse)(std::string& line, const cpp_mapped_file& hdr_file, cpp_output_sink& pp_out);
+
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @brief Read-only mapping of a source file.
+	// The whole file is visible as one buffer, which lets inactive blocks be
+	// skipped with memchr instead of being read line by line.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	class cpp_mapped_file final
+	{
+	public:
+		explicit cpp_mapped_file(const std::string& path)
+		{
+			int fd = ::open(path.c_str(), O_RDONLY);
+
+			if (fd < 0)
+				return;
+
+			struct stat st;
+
+			if (::fstat(fd, &st) == 0)
+			{
+				fOpen = true;
+				fSize = static_cast<SizeType>(st.st_size);
+
+				// mmap refuses empty mappings, an empty file is just an empty buffer.
+				if (fSize > 0)
+				{
+					void* data = ::mmap(nullptr, fSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+					if (data == MAP_FAILED)
+					{
+						fOpen = false;
+						fSize = 0;
+					}
+					else
+					{
+						fData = static_cast<const char*>(data);
+						::madvise(data, fSize, MADV_SEQUENTIAL);
+					}
+				}
+			}
+
+			::close(fd);
+		}
+
+		~cpp_mapped_file()
+		{
+			if (fData)
+				::munmap(const_cast<char*>(fData), fSize);
+		}
+
+		CXXKIT_COPY_DELETE(cpp_mapped_file);
+
+		bool is_open() const { return fOpen; }
+		const char* data() const { return fData; }
+		SizeType size() const { return fSize; }
+
+	private:
+		const char* fData{ nullptr };
+		SizeType fSize{ 0 };
+		bool fOpen{ false };
+
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	// @brief Buffered output of the preprocessor.
+	// Lines are kept in memory and written in large chunks, a '# <line> "<file>"'
+	// marker is written whenever the source position jumps, so that cc/ccplus
+	// can report errors against the original file.
+
+	/////////////////////////////////////////////////////////////////////////////////////////
+
+	class cpp_output_sink final
+	{
+	public:
+		explicit cpp_output_sink(std::ofstream& out, bool markers = true)
+			: fOut(out), fMarkers(markers)
+		{
+			fBuffer.reserve(kCppOutputBufferSize);
+		}
+
+		~cpp_output_sink()
+		{
+			this->flush();
+		}
+
+		CXXKIT_COPY_DELETE(cpp_output_sink);
+
+		void write_line(const std::string& line, const std::string& file, SizeType line_no)
+		{
+			if (fMarkers)
+			{
+				if (file != fLastFile ||
+					line_no <= fLastLine ||
+					line_no > fLastLine + kCppMaxLineGap)
+				{
+					fBuffer += "# ";
+					fBuffer += std::to_string(line_no);
+					fBuffer += " \"";
+					fBuffer += file;
+					fBuffer += "\"\n";
+
+					fLastFile = file;
+				}
+				else
+				{
+					// small gap, resync with blank lines, cheaper than a marker.
+					for (SizeType gap = fLastLine + 1; gap < line_no; ++gap)
+						fBuffer += '\n';
+				}
+
+				fLastLine = line_no;
+			}
+
+			fBuffer += line;
+			fBuffer += '\n';
+
+			if (fBuffer.size() >= kCppOutputBufferSize)
+				this->flush();
+		}
+
+		void flush()
+		{
+			if (fBuffer.empty())
+				return;
+
+			fOut.write(fBuffer.data(), fBuffer.size());
+			fBuffer.clear();
+		}
+
+	private:
+		std::ofstream& fOut;
+		std::string fBuffer;
+		std::string fLastFile;
+		SizeType fLastLine{ 0 };
+		bool fMarkers{ true };
 
 	};
 }
@@ -65,6 +233,11 @@ static std::vector<details::cpp_macro> kMacros;
 static std::vector<std::string> kIncludes;
 
 static std::string kWoringDir;
+static bool kLineMarkers = true;
+static bool kDependencyFile = false;
+static std::string kIncludeGraphPath;
+static bool kCacheEnabled = false;
+static std::string kCacheDir;
 
 static std::vector<std::string> kKeywords = {
 	"include",
@@ -272,25 +445,572 @@ std::vector<std::string> kAllIncludes;
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+// @brief include tracking, used by -MD and --include-graph.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace details
+{
+	struct cpp_include_node final
+	{
+		std::string fPath;
+		std::vector<SizeType> fIncludes;
+		double fTotalMs{ 0 };
+		double fSelfMs{ 0 };
+		SizeType fCount{ 0 };
+	};
+
+	struct cpp_include_frame final
+	{
+		SizeType fNode;
+		std::chrono::steady_clock::time_point fStart;
+		double fChildrenMs{ 0 };
+	};
+}
+
+/// @brief resolved paths of the files included by the current input.
+static std::vector<std::string> kDependencies;
+
+/// @brief '#include' line -> resolved path, to keep edges of already included headers.
+static std::unordered_map<std::string, std::string> kIncludePaths;
+
+static std::vector<details::cpp_include_node> kIncludeGraph;
+static std::unordered_map<std::string, SizeType> kIncludeGraphIndex;
+static std::vector<details::cpp_include_frame> kIncludeStack;
+
+static SizeType cpp_graph_node(const std::string& path)
+{
+	if (auto it = kIncludeGraphIndex.find(path);
+		it != kIncludeGraphIndex.end())
+		return it->second;
+
+	kIncludeGraph.push_back({ .fPath = path });
+	kIncludeGraphIndex[path] = kIncludeGraph.size() - 1;
+
+	return kIncludeGraph.size() - 1;
+}
+
+static void cpp_graph_edge(const std::string& path)
+{
+	if (kIncludeGraphPath.empty() ||
+		kIncludeStack.empty())
+		return;
+
+	auto child = cpp_graph_node(path);
+	auto& edges = kIncludeGraph[kIncludeStack.back().fNode].fIncludes;
+
+	if (std::find(edges.cbegin(), edges.cend(), child) == edges.cend())
+		edges.push_back(child);
+}
+
+static void cpp_graph_enter(const std::string& path)
+{
+	if (kIncludeGraphPath.empty())
+		return;
+
+	cpp_graph_edge(path);
+	kIncludeStack.push_back({ .fNode = cpp_graph_node(path), .fStart = std::chrono::steady_clock::now() });
+}
+
+static void cpp_graph_leave()
+{
+	if (kIncludeGraphPath.empty())
+		return;
+
+	auto frame = kIncludeStack.back();
+	kIncludeStack.pop_back();
+
+	double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame.fStart).count();
+
+	auto& node = kIncludeGraph[frame.fNode];
+
+	node.fTotalMs += elapsed;
+	node.fSelfMs += elapsed - frame.fChildrenMs;
+	++node.fCount;
+
+	if (!kIncludeStack.empty())
+		kIncludeStack.back().fChildrenMs += elapsed;
+}
+
+static std::string cpp_make_escape(const std::string& path)
+{
+	std::string escaped;
+
+	for (auto& ch : path)
+	{
+		if (ch == ' ' ||
+			ch == '#')
+			escaped += '\\';
+
+		if (ch == '$')
+			escaped += '$';
+
+		escaped += ch;
+	}
+
+	return escaped;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name cpp_write_dependencies
+// @brief write a make rule '<file>.pp: <file> <headers...>' into <file>.d
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void cpp_write_dependencies(const std::string& file)
+{
+	std::ofstream dep_out(file + ".d");
+	std::string rule = cpp_make_escape(file + ".pp") + ": " + cpp_make_escape(file);
+
+	for (auto& dep : kDependencies)
+	{
+		rule += " \\\n  ";
+		rule += cpp_make_escape(dep);
+	}
+
+	rule += "\n";
+
+	// phony targets, so that make doesn't fail when a header is removed.
+	for (auto& dep : kDependencies)
+	{
+		rule += "\n";
+		rule += cpp_make_escape(dep);
+		rule += ":\n";
+	}
+
+	dep_out << rule;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name cpp_write_include_graph
+// @brief dump the include DAG as a graphviz file, with the time spent in each header.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void cpp_write_include_graph(const std::string& graph_path)
+{
+	auto quote = [](const std::string& str) {
+		std::string quoted = "\"";
+
+		for (auto& ch : str)
+		{
+			if (ch == '"' ||
+				ch == '\\')
+				quoted += '\\';
+
+			quoted += ch;
+		}
+
+		return quoted + "\"";
+	};
+
+	std::ofstream graph_out(graph_path);
+
+	graph_out << "digraph includes {\n";
+
+	for (auto& node : kIncludeGraph)
+	{
+		char times[128] = { 0 };
+		snprintf(times, sizeof(times), "\\n%.3f ms (self %.3f ms), %zux", node.fTotalMs, node.fSelfMs, node.fCount);
+
+		// the times go in unescaped, their \n is the line break of graphviz.
+		auto label = quote(node.fPath);
+		label.insert(label.size() - 1, times);
+
+		graph_out << "\t" << quote(node.fPath) << " [label=" << label << "];\n";
+	}
+
+	for (auto& node : kIncludeGraph)
+	{
+		for (auto& child : node.fIncludes)
+		{
+			graph_out << "\t" << quote(node.fPath) << " -> " << quote(kIncludeGraph[child].fPath) << ";\n";
+		}
+	}
+
+	graph_out << "}\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Preprocessing cache.
+// The output only depends on the input, on the headers it includes and on the
+// command line. An input key (command line + source) points to a manifest listing
+// the headers and their hashes from the last run, the result key is the input key
+// mixed with the current hashes of those headers. The output is kept as
+// <cache-dir>/<result key>.pp and hard linked on a hit.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static UInt64 cpp_hash(const void* data, SizeType len, UInt64 hash = kCppHashSeed)
+{
+	auto bytes = static_cast<const UInt8*>(data);
+
+	hash ^= len * kCppHashPrime;
+
+	// eight bytes at a time, then the tail.
+	for (; len >= sizeof(UInt64); len -= sizeof(UInt64), bytes += sizeof(UInt64))
+	{
+		UInt64 word = 0;
+		memcpy(&word, bytes, sizeof(UInt64));
+
+		word *= kCppHashSeed;
+		word ^= word >> 29;
+
+		hash = (hash ^ word) * kCppHashPrime;
+	}
+
+	for (; len > 0; --len, ++bytes)
+	{
+		hash = (hash ^ *bytes) * kCppHashPrime;
+	}
+
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+
+	return hash;
+}
+
+static UInt64 cpp_hash_mix(const std::string& str, UInt64 hash)
+{
+	return cpp_hash(str.data(), str.size(), hash);
+}
+
+static bool cpp_hash_file(const std::string& path, UInt64& hash)
+{
+	details::cpp_mapped_file file(path);
+
+	if (!file.is_open())
+		return false;
+
+	hash = cpp_hash(file.data(), file.size(), kCppHashSeed);
+
+	return true;
+}
+
+static std::string cpp_hash_hex(UInt64 hash)
+{
+	char hex[17] = { 0 };
+	snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+
+	return hex;
+}
+
+static std::string cpp_cache_default_dir()
+{
+	if (auto dir = getenv("MPCC_CACHE_DIR"))
+		return dir;
+
+	if (auto dir = getenv("XDG_CACHE_HOME"))
+		return std::string(dir) + "/mpcc/pp";
+
+	if (auto dir = getenv("HOME"))
+		return std::string(dir) + "/.cache/mpcc/pp";
+
+	return "";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name cpp_cache_lookup
+// @brief look for a cached output of file, links it to <file>.pp on a hit.
+// @param input_key set to the command line + source key, for cpp_cache_store.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool cpp_cache_lookup(const std::string& file, UInt64& input_key)
+{
+	UInt64 source_hash = 0;
+
+	if (!cpp_hash_file(file, source_hash))
+		return false;
+
+	input_key = cpp_hash_mix(kCppVersion, source_hash);
+	input_key = cpp_hash_mix(file, input_key);
+	input_key = cpp_hash_mix(kWoringDir, input_key);
+	input_key = cpp_hash_mix(kLineMarkers ? "markers" : "no-markers", input_key);
+
+	for (auto& include : kIncludes)
+	{
+		input_key = cpp_hash_mix(include, input_key);
+	}
+
+	for (auto& macro : kMacros)
+	{
+		input_key = cpp_hash_mix(macro.fName + "=" + macro.fValue, input_key);
+	}
+
+	std::ifstream manifest(kCacheDir + "/" + cpp_hash_hex(input_key) + ".manifest");
+
+	if (!manifest.is_open())
+		return false;
+
+	std::vector<std::string> dependencies;
+	UInt64 result_key = input_key;
+	std::string entry;
+
+	while (std::getline(manifest, entry))
+	{
+		if (entry.find(' ') == std::string::npos)
+			return false;
+
+		auto path = entry.substr(entry.find(' ') + 1);
+		UInt64 header_hash = 0;
+
+		// header is gone or changed, preprocess again.
+		if (!cpp_hash_file(path, header_hash) ||
+			cpp_hash_hex(header_hash) != entry.substr(0, entry.find(' ')))
+			return false;
+
+		result_key = cpp_hash_mix(path, result_key ^ header_hash);
+		dependencies.push_back(path);
+	}
+
+	auto cached = kCacheDir + "/" + cpp_hash_hex(result_key) + ".pp";
+
+	if (!std::filesystem::exists(cached))
+		return false;
+
+	std::error_code err;
+
+	std::filesystem::remove(file + ".pp", err);
+	std::filesystem::create_hard_link(cached, file + ".pp", err);
+
+	// cache lives on another file system.
+	if (err)
+	{
+		if (!std::filesystem::copy_file(cached, file + ".pp",
+										std::filesystem::copy_options::overwrite_existing, err))
+			return false;
+	}
+
+	kDependencies = dependencies;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name cpp_cache_store
+// @brief store <file>.pp and the manifest of the headers it used.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void cpp_cache_store(const std::string& file, UInt64 input_key)
+{
+	std::string manifest;
+	UInt64 result_key = input_key;
+
+	for (auto& dep : kDependencies)
+	{
+		UInt64 header_hash = 0;
+
+		if (!cpp_hash_file(dep, header_hash))
+			return;
+
+		manifest += cpp_hash_hex(header_hash) + " " + dep + "\n";
+		result_key = cpp_hash_mix(dep, result_key ^ header_hash);
+	}
+
+	std::error_code err;
+	std::filesystem::create_directories(kCacheDir, err);
+
+	auto cached = kCacheDir + "/" + cpp_hash_hex(result_key) + ".pp";
+	auto manifest_path = kCacheDir + "/" + cpp_hash_hex(input_key) + ".manifest";
+
+	// write to a temporary name first, so that concurrent builds never see a partial file.
+	auto tmp_suffix = ".tmp" + std::to_string(getpid());
+
+	if (!std::filesystem::copy_file(file + ".pp", cached + tmp_suffix,
+									std::filesystem::copy_options::overwrite_existing, err))
+		return;
+
+	std::filesystem::rename(cached + tmp_suffix, cached, err);
+
+	std::ofstream(manifest_path + tmp_suffix) << manifest;
+	std::filesystem::rename(manifest_path + tmp_suffix, manifest_path, err);
+}
+
+void cpp_parse_file(const details::cpp_mapped_file& hdr_file, const std::string& hdr_path, details::cpp_output_sink& pp_out);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name cpp_parse_include
+// @brief parse an included header, records it as a dependency of the current input.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void cpp_parse_include(const details::cpp_mapped_file& header, const std::string& include_line,
+							const std::string& header_path, details::cpp_output_sink& pp_out)
+{
+	kIncludePaths[include_line] = header_path;
+
+	if (std::find(kDependencies.cbegin(), kDependencies.cend(), header_path) == kDependencies.cend())
+		kDependencies.push_back(header_path);
+
+	cpp_graph_enter(header_path);
+	cpp_parse_file(header, header_path, pp_out);
+	cpp_graph_leave();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @name cpp_skip_inactive
+// @brief fast path for the body of a false conditional.
+// Only lines whose first non-blank character is '#' are looked at, nested
+// #if/#endif pairs are skipped whole, and so are block comments, with the
+// directives in them.
+// @return start of the #else/#elif/#endif line closing the block, or end.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const char* cpp_skip_inactive(const char* begin, const char* cursor, const char* end, SizeType& line_no)
+{
+	const char* from = cursor;
+	SizeType depth = 0UL;
+
+	while (cursor < end)
+	{
+		auto hash = static_cast<const char*>(memchr(cursor, '#', end - cursor));
+
+		// up to the next '#' only, so that the input is looked at once.
+		auto comment = static_cast<const char*>(memmem(cursor, (hash ? hash : end) - cursor, "/*", 2));
+
+		if (comment)
+		{
+			auto line_start = comment;
+
+			while (line_start > begin &&
+				line_start[-1] != '\n')
+				--line_start;
+
+			// after a '//' it is no comment, as in cpp_parse_file.
+			if (std::string_view(line_start, comment - line_start).find("//") != std::string_view::npos)
+			{
+				auto eol = static_cast<const char*>(memchr(comment, '\n', end - comment));
+				cursor = eol ? eol + 1 : end;
+
+				continue;
+			}
+
+			// the directives of a comment are not directives, go on after its end.
+			auto close = static_cast<const char*>(memmem(comment + 2, end - comment - 2, "*/", 2));
+			cursor = close ? close + 2 : end;
+
+			continue;
+		}
+
+		if (!hash)
+			break;
+
+		cursor = hash + 1;
+
+		auto line_start = hash;
+
+		while (line_start > begin &&
+			(line_start[-1] == ' ' || line_start[-1] == '\t'))
+			--line_start;
+
+		if (line_start > begin &&
+			line_start[-1] != '\n')
+			continue;
+
+		auto name = hash + 1;
+
+		while (name < end &&
+			(*name == ' ' || *name == '\t'))
+			++name;
+
+		auto name_end = name;
+
+		while (name_end < end &&
+			isalpha(*name_end))
+			++name_end;
+
+		std::string_view directive(name, name_end - name);
+
+		if (directive == "if" ||
+			directive == "ifdef" ||
+			directive == "ifndef")
+		{
+			++depth;
+		}
+		else if (directive == "endif" ||
+			directive == "else" ||
+			directive == "elif")
+		{
+			if (depth == 0)
+			{
+				line_no += std::count(from, line_start, '\n');
+				return line_start;
+			}
+
+			if (directive == "endif")
+				--depth;
+		}
+
+		// a comment may start on the rest of the line.
+		cursor = name_end;
+	}
+
+	line_no += std::count(from, end, '\n');
+	return end;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 // @name cpp_parse_file
 // @brief parse file to preprocess it.
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-void cpp_parse_file(std::ifstream& hdr_file, std::ofstream& pp_out)
+void cpp_parse_file(const details::cpp_mapped_file& hdr_file, const std::string& hdr_path, details::cpp_output_sink& pp_out)
 {
 	std::string hdr_line;
 	std::string line_after_include;
 
+	SizeType line_no = 0UL;
+
 	bool inactive_code = false;
 	bool comment = false;
 	bool defined = false;
 	bool else_branch = false;
 
+	const char* cursor = hdr_file.data();
+	const char* end = cursor + hdr_file.size();
+
 	try
 	{
-		while (std::getline(hdr_file, hdr_line))
+		while (cursor < end)
 		{
+			if (inactive_code &&
+				!comment)
+			{
+				cursor = cpp_skip_inactive(hdr_file.data(), cursor, end, line_no);
+
+				if (cursor >= end)
+					break;
+			}
+
+			auto eol = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+
+			hdr_line.assign(cursor, eol ? eol : end);
+			cursor = eol ? eol + 1 : end;
+
+			++line_no;
+
+			// indented directives, '  #if' is the same as '#if'.
+			if (auto first = hdr_line.find_first_not_of(" \t");
+				first != std::string::npos &&
+				first > 0 &&
+				hdr_line[first] == '#')
+			{
+				hdr_line.erase(0, first);
+			}
+
             if (hdr_line.find("//") != std::string::npos)
             {
                 hdr_line.erase(hdr_line.find("//"));
@@ -328,8 +1048,7 @@ void cpp_parse_file(std::ifstream& hdr_file, std::ofstream& pp_out)
 			if (hdr_line[0] == '#' &&
 				hdr_line.find("endif") != std::string::npos)
 			{
-				if (!defined &&
-					inactive_code)
+				if (inactive_code)
 				{
 					inactive_code = false;
 					defined = false;
@@ -340,19 +1059,17 @@ void cpp_parse_file(std::ifstream& hdr_file, std::ofstream& pp_out)
 				continue;
 			}
 
-			if (!defined &&
-				inactive_code)
+			// while inactive only the #else/#elif closing the block gets through,
+			// see cpp_skip_inactive.
+			if (inactive_code &&
+				(hdr_line[0] != '#' ||
+				(hdr_line.find("else") == std::string::npos &&
+				hdr_line.find("elif") == std::string::npos)))
 			{
 				continue;
 			}
 
-			if (defined &&
-				inactive_code)
-			{
-				continue;
-			}
-
-            for (auto macro : kMacros)
+            for (const auto& macro : kMacros)
             {
                 if (ParserKit::find_word(hdr_line, macro.fName) &&
                     hdr_line.find("#define") == std::string::npos)
@@ -544,7 +1261,7 @@ void cpp_parse_file(std::ifstream& hdr_file, std::ofstream& pp_out)
 					}
 				}
 
-				pp_out << hdr_line << std::endl;
+				pp_out.write_line(hdr_line, hdr_path, line_no);
 
 				continue;
 			}
@@ -828,6 +1545,10 @@ kIncludeFile:
 
 				if (it != kAllIncludes.cend())
 				{
+					if (auto resolved = kIncludePaths.find(line_after_include);
+						resolved != kIncludePaths.end())
+						cpp_graph_edge(resolved->second);
+
 					continue;
 				}	
 
@@ -869,14 +1590,15 @@ kIncludeFile:
 
 					for (auto& include : kIncludes)
 					{
-						std::ifstream header(include + '/' + path);
+						std::string header_path = include + '/' + path;
+						details::cpp_mapped_file header(header_path);
 
 						if (!header.is_open())
 							continue;
 						
 						open = true;
 
-						cpp_parse_file(header, pp_out);
+						cpp_parse_include(header, line_after_include, header_path, pp_out);
 
 						break;
 					}
@@ -888,12 +1610,13 @@ kIncludeFile:
 				}
 				else
 				{
-					std::ifstream header(kWoringDir + path);
+					std::string header_path = kWoringDir + path;
+					details::cpp_mapped_file header(header_path);
 
 					if (!header.is_open())
 						throw std::runtime_error("cpp: no such include file: " + path);
 
-					cpp_parse_file(header, pp_out);
+					cpp_parse_include(header, line_after_include, header_path, pp_out);
 				}
 			}
 			else
@@ -954,17 +1677,22 @@ int main(int argc, char** argv)
 				if (strcmp(argv[index], "-v") == 0 ||
 					strcmp(argv[index], "--version") == 0)
 				{
-					printf("%s\n", "MP-UX Preprocessor v1.11, (c) Amlal El Mahrouss");
+					printf("%s\n", kCppVersion);
 					return 0;
 				}
 
 				if (strcmp(argv[index], "-h") == 0 ||
 					strcmp(argv[index], "--help") == 0)
 				{
-					printf("%s\n", "MP-UX Preprocessor v1.11, (c) Amlal El Mahrouss");
+					printf("%s\n", kCppVersion);
 					printf("%s\n", "--working-dir: set directory to working path.");
 					printf("%s\n", "--include-dir: add directory to include path.");
 					printf("%s\n", "--define: define macro.");
+					printf("%s\n", "--no-line-markers: don't emit '# <line> \"<file>\"' markers.");
+					printf("%s\n", "-MD: write the included files as a make rule into <file>.d");
+					printf("%s\n", "--include-graph: dump the include graph (graphviz) with the time spent per header.");
+					printf("%s\n", "--cache: reuse outputs from the preprocessing cache (~/.cache/mpcc/pp).");
+					printf("%s\n", "--cache-dir: set the preprocessing cache directory, implies --cache.");
 
 					return 0;
 				}
@@ -978,6 +1706,41 @@ int main(int argc, char** argv)
 					kIncludes.push_back(inc);
                 }
 
+				if (strcmp(argv[index], "--cache") == 0)
+				{
+					kCacheEnabled = true;
+					continue;
+				}
+
+				if (strcmp(argv[index], "--cache-dir") == 0)
+				{
+					kCacheEnabled = true;
+					kCacheDir = argv[index+1];
+					skip = true;
+
+					continue;
+				}
+
+				if (strcmp(argv[index], "-MD") == 0)
+				{
+					kDependencyFile = true;
+					continue;
+				}
+
+				if (strcmp(argv[index], "--include-graph") == 0)
+				{
+					kIncludeGraphPath = argv[index+1];
+					skip = true;
+
+					continue;
+				}
+
+				if (strcmp(argv[index], "--no-line-markers") == 0)
+				{
+					kLineMarkers = false;
+					continue;
+				}
+
 				if (strcmp(argv[index], "--working-dir") == 0)
 				{
 					std::string inc = argv[index+1];
@@ -1030,17 +1793,63 @@ int main(int argc, char** argv)
 		if (kFiles.empty())
 			return CXXKIT_EXEC_ERROR;
 
+		if (kCacheEnabled &&
+			kCacheDir.empty())
+			kCacheDir = cpp_cache_default_dir();
+
+		if (kCacheDir.empty())
+			kCacheEnabled = false;
+
+		// macros given on the command line, every input starts from these.
+		auto command_line_macros = kMacros;
+
 		for (auto& file : kFiles)
 		{
 			if (!std::filesystem::exists(file))
 				continue;
 
-			std::ifstream file_descriptor(file);
+			// every input starts from a clean state.
+			kMacros = command_line_macros;
+			kAllIncludes.clear();
+			kIncludePaths.clear();
+			kDependencies.clear();
+
+			UInt64 input_key = 0;
+
+			if (kCacheEnabled &&
+				cpp_cache_lookup(file, input_key))
+			{
+				if (kDependencyFile)
+					cpp_write_dependencies(file);
+
+				continue;
+			}
+
+			// the old output may be a hard link into the cache, never write through it.
+			std::filesystem::remove(file + ".pp");
+
+			details::cpp_mapped_file file_descriptor(file);
 			std::ofstream file_descriptor_pp(file + ".pp");
-			
-			cpp_parse_file(file_descriptor, file_descriptor_pp);
+
+			details::cpp_output_sink pp_out(file_descriptor_pp, kLineMarkers);
+
+			cpp_graph_enter(file);
+			cpp_parse_file(file_descriptor, file, pp_out);
+			cpp_graph_leave();
+
+			pp_out.flush();
+			file_descriptor_pp.close();
+
+			if (kCacheEnabled)
+				cpp_cache_store(file, input_key);
+
+			if (kDependencyFile)
+				cpp_write_dependencies(file);
 		}
 
+		if (!kIncludeGraphPath.empty())
+			cpp_write_include_graph(kIncludeGraphPath);
+
 		return 0;
 	}
 	catch(const std::runtime_error& e)
@@ -17,8 +17,13 @@
 
 #include <C++Kit/StdKit/ErrorID.hpp>
 
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <set>
+#include <sstream>
+#include <unordered_map>
 #include <uuid/uuid.h>
 
 //! Portable Executable Format
@@ -27,6 +32,10 @@
 //! Advanced Executable Object Format
 #include <C++Kit/StdKit/AE.hpp>
 
+//! IR of the objects built with -flto
+#include <C++Kit/AsmKit/Module.hpp>
+#include <C++Kit/AsmKit/SSA.hpp>
+
 //! @brief standard PEF entry.
 #define kPefStart "__start"
 
@@ -72,6 +81,236 @@ static const char* kLdDynamicSym = ":mld_reloc:";
 
 static std::vector<char> kObjectBytes;
 static std::vector<std::string> kObjectList;
+static std::set<std::string> kPoolRecords; // constant pool records kept so far.
+
+static std::vector<CxxKit::IRModule> kModules; // IR records, lowered once every object is read.
+static std::set<std::string> kImports; // what the other objects import, the modules must keep it.
+static CharType kModuleArch = kPefNoCpu;
+static std::string kModulesAssembly; // --lto-asm, where the lowered IR is written as masm.
+
+#define kLdModulesName "(lto)"
+#define kLdLocalPrefix "__lto_" // a static of the IR of an object is __lto_<module>_<name>.
+
+/// @brief gives the static functions and data of a module a name no other module has,
+/// as they share one object once merged.
+static void ld_rename_locals(CxxKit::IRModule& module, size_t module_index)
+{
+    const std::string prefix = kAsmImport " ";
+
+    std::unordered_map<std::string, std::string> renamed;
+
+    for (auto& name : module.fLocals)
+        renamed.emplace(name, kLdLocalPrefix + std::to_string(module_index) + "_" + name);
+
+    auto rename = [&](std::string& symbol) {
+        bool imported = symbol.starts_with(prefix);
+
+        if (auto it = renamed.find(imported ? symbol.substr(prefix.size()) : symbol);
+            it != renamed.end())
+            symbol = it->second;
+    };
+
+    for (auto& function : module.fFunctions)
+    {
+        rename(function.fName);
+
+        for (auto& instr : function.fCode)
+            rename(instr.fSymbol);
+    }
+
+    for (auto& line : module.fData)
+    {
+        for (auto& operand : line.fOperands)
+            rename(operand.fSymbol);
+    }
+
+    module.fLocals.clear();
+}
+
+/// @brief the IR modules as one more AE object: calls across them are inlined,
+/// functions nothing reaches are dropped, and the rest is lowered as cc would.
+static bool ld_link_modules(bool is_executable, std::ostream& out)
+{
+    const std::string prefix = kAsmImport " ";
+
+    std::vector<CxxKit::IRFunction> bodies;
+    std::vector<CxxKit::IRModule*> owners;
+    std::vector<CxxKit::AsmLine> data;
+    std::unordered_map<std::string, size_t> names;
+    std::set<std::string> pooled;
+
+    bool duplicates = false;
+
+    for (size_t module_index = 0; module_index < kModules.size(); ++module_index)
+    {
+        auto& module = kModules[module_index];
+
+        ld_rename_locals(module, module_index);
+
+        for (auto& function : module.fFunctions)
+        {
+            if (!names.emplace(function.fName, bodies.size()).second)
+            {
+                kStdOut << "ld: multiple symbols of " << function.fName << " in the IR of the objects.\n";
+                duplicates = true;
+            }
+
+            owners.push_back(&module);
+            bodies.push_back(std::move(function));
+        }
+
+        // each unit has its own copy of the pool records it uses.
+        bool skip = false;
+
+        for (auto& line : module.fData)
+        {
+            if (line.fKind == CxxKit::kAsmLineExport)
+            {
+                auto& symbol = line.fOperands[0].fSymbol;
+                skip = symbol.starts_with(kAEPoolPrefix) && !pooled.insert(symbol).second;
+            }
+
+            if (!skip)
+                data.push_back(line);
+        }
+    }
+
+    if (duplicates)
+        return false;
+
+    // a call into another module was an import, it is a direct call now.
+    for (auto& body : bodies)
+    {
+        for (auto& instr : body.fCode)
+        {
+            if (instr.fSymbol.starts_with(prefix) &&
+                names.count(instr.fSymbol.substr(prefix.size())))
+                instr.fSymbol.erase(0, prefix.size());
+        }
+    }
+
+    // every function inlines from the bodies as generated, as in cc.
+    std::vector<CxxKit::IRFunction> code(bodies);
+
+    for (size_t index = 0; index < code.size(); ++index)
+    {
+        if (owners[index]->fLevel > 0 &&
+            owners[index]->fInlineLimit > 0)
+            CxxKit::ir_inline_calls(code[index], bodies, names, owners[index]->fInlineLimit);
+    }
+
+    // from the entry point, the imports of the other objects and the data, whatever is reached.
+    std::vector<bool> live(code.size(), false);
+    std::vector<size_t> work;
+
+    auto reach = [&](std::string symbol) {
+        if (symbol.starts_with(prefix))
+            symbol.erase(0, prefix.size());
+
+        if (auto it = names.find(symbol);
+            it != names.end() &&
+            !live[it->second])
+        {
+            live[it->second] = true;
+            work.push_back(it->second);
+        }
+    };
+
+    reach(kPefStart);
+
+    for (auto& symbol : kImports)
+        reach(symbol);
+
+    for (auto& line : data)
+    {
+        for (auto& operand : line.fOperands)
+            reach(operand.fSymbol);
+    }
+
+    // a library keeps what it defines.
+    for (size_t index = 0; index < code.size() && !is_executable; ++index)
+        reach(code[index].fName);
+
+    while (!work.empty())
+    {
+        auto index = work.back();
+        work.pop_back();
+
+        for (auto& instr : code[index].fCode)
+            reach(instr.fSymbol);
+    }
+
+    std::vector<CxxKit::AsmLine> object;
+    std::vector<CxxKit::AsmLine> tables;
+
+    for (size_t index = 0; index < code.size(); ++index)
+    {
+        if (!live[index])
+            continue;
+
+        auto& function = code[index];
+
+        if (owners[index]->fLevel > 0)
+        {
+            CxxKit::IRPassManager passes;
+            CxxKit::ir_add_passes(passes, owners[index]->fLevel);
+
+            CxxKit::ir_optimize(function, passes);
+        }
+
+        function.Allocate(kIRFirstUsable, kIRLastUsable);
+
+        std::vector<CxxKit::AsmLine> lines;
+        function.Lower(lines);
+
+        // jump tables, with the labels they were left with once optimized.
+        for (auto& instr : function.fCode)
+        {
+            if (instr.fOpcode != CxxKit::kIRJumpTable)
+                continue;
+
+            tables.push_back(CxxKit::AsmLine::Export(".data", instr.fSymbol));
+
+            for (auto& target : instr.fTargets)
+            {
+                tables.push_back(CxxKit::AsmLine::Data("qword"));
+                tables.back().fOperands.push_back(CxxKit::AsmOperand::Symbol(target));
+            }
+        }
+
+        object.push_back(CxxKit::AsmLine::Export(".text", function.fName));
+        object.push_back(CxxKit::AsmLine::Begin());
+
+        object.insert(object.end(), lines.begin(), lines.end());
+
+        object.push_back(CxxKit::AsmLine::End());
+    }
+
+    // data goes after the code, so that no record cuts a function in two.
+    object.insert(object.end(), tables.begin(), tables.end());
+    object.insert(object.end(), data.begin(), data.end());
+
+    if (!kModulesAssembly.empty())
+    {
+        std::ofstream assembly(kModulesAssembly);
+
+        for (auto& line : object)
+            assembly << CxxKit::asm_format(line) << "\n";
+
+        if (!assembly.good())
+        {
+            kStdOut << "ld: could not write " << kModulesAssembly << "\n";
+            return false;
+        }
+    }
+
+    CxxKit::AEObject ae_object(kModuleArch);
+
+    for (auto& line : object)
+        ae_object.Add(line);
+
+    return ae_object.Write(out);
+}
 
 int main(int argc, char** argv)
 {
@@ -87,6 +326,7 @@ int main(int argc, char** argv)
             kStdOut << "-marc, -mrv64, -m64: Compile to specific ISA.\n";
             kStdOut << "--fat-binary: Output as FAT PEF.\n";
             kStdOut << "-o: Select output filename.\n";	
+            kStdOut << "--lto-asm: Write the code linked from -flto objects as masm.\n";
 
             // bye
             return 0;
@@ -146,6 +386,14 @@ int main(int argc, char** argv)
 
             continue;
         }
+        else if (StringCompare(argv[i], "--lto-asm") == 0 &&
+            i + 1 < argc)
+        {
+            kModulesAssembly = argv[i+1];
+            ++i;
+
+            continue;
+        }
         else
         {
             kObjectList.emplace_back(argv[i]);
@@ -193,14 +441,36 @@ int main(int argc, char** argv)
 
     std::vector<CxxKit::PEFCommandHeader> pef_command_hdrs;
 
-    for (const auto& i : kObjectList)
+    // the IR modules come last, as one object, once every other object told what it imports.
+    for (size_t object_index = 0; object_index <= kObjectList.size(); ++object_index)
     {
-        if (!std::filesystem::exists(i))
-            continue;
+        std::string i = object_index < kObjectList.size() ? kObjectList[object_index] : kLdModulesName;
+        std::stringstream input_object;
+
+        if (object_index == kObjectList.size())
+        {
+            if (kModules.empty())
+                break;
+
+            if (!ld_link_modules(is_executable, input_object))
+            {
+                kStdOut << "ld: could not link the IR of " << kModules.size() << " objects.\n";
+
+                std::remove(kOutput.c_str());
+                return -CXXKIT_EXEC_ERROR;
+            }
+
+            kModules.clear();
+        }
+        else
+        {
+            if (!std::filesystem::exists(i))
+                continue;
+
+            input_object << std::ifstream(i, std::ifstream::binary).rdbuf();
+        }
 
         CxxKit::AEHeader hdr{};
-        
-        std::ifstream input_object(i, std::ifstream::binary);
 
         input_object.read((char*)&hdr, sizeof(CxxKit::AEHeader));
     
@@ -223,8 +493,6 @@ int main(int argc, char** argv)
         {
             std::size_t cnt = ae_header.fCount;
 
-            pef_container.Count = cnt;
-
             char* raw_ae_records = new char[cnt * sizeof(CxxKit::AERecordHeader)];
             memset(raw_ae_records, 0, cnt * sizeof(CxxKit::AERecordHeader));
 
@@ -232,12 +500,54 @@ int main(int argc, char** argv)
 
             auto* ae_records = (CxxKit::AERecordHeader*)raw_ae_records;
 
+            // byte ranges left out of the program, pool records another object already
+            // brought in, and IR records.
+            std::vector<std::pair<size_t, size_t>> dropped_ranges;
+            std::vector<std::pair<size_t, size_t>> ir_ranges;
+
+            // where the bytes of this object start in the program, and how many of them were dropped so far.
+            const size_t object_start = kObjectBytes.size();
+            size_t dropped_size = 0;
+
             for (size_t ae_record_index = 0; ae_record_index < cnt; ++ae_record_index)
             {
 				CxxKit::PEFCommandHeader command_header{ 0 };
 
 				memcpy(command_header.Name, ae_records[ae_record_index].fName, kPefNameLen);
 
+                // a record ends where the next one starts.
+                std::pair<size_t, size_t> range(ae_record_index == 0 ? 0 : size_t(ae_records[ae_record_index - 1].fSize),
+                                                size_t(ae_records[ae_record_index].fSize));
+
+                if (ae_records[ae_record_index].fKind == CxxKit::kPefIR)
+                {
+                    ir_ranges.push_back(range);
+                    dropped_ranges.push_back(range);
+                    dropped_size += range.second - range.first;
+
+                    continue;
+                }
+
+                // the same pool record is the same bytes, keep the first one only.
+                if (std::string(command_header.Name).find(kAEPoolPrefix) != std::string::npos &&
+                    std::string(command_header.Name).find(kLdDefineSymbol) == std::string::npos &&
+                    !kPoolRecords.insert(command_header.Name).second)
+                {
+                    dropped_ranges.push_back(range);
+                    dropped_size += range.second - range.first;
+
+                    continue;
+                }
+
+                if (auto name = std::string(command_header.Name);
+                    name.find(kLdDefineSymbol) != std::string::npos)
+                {
+                    name.erase(0, name.find(kLdDefineSymbol) + strlen(kLdDefineSymbol));
+                    std::erase(name, '$');
+
+                    kImports.insert(name);
+                }
+
                 // check this header if it's any valid.
                 if (std::string(command_header.Name).find(".text") == std::string::npos &&
                     std::string(command_header.Name).find(".data") == std::string::npos &&
@@ -269,6 +579,10 @@ ld_mark_header:
 				command_header.Kind = ae_records[ae_record_index].fKind;
 				command_header.Size = ae_records[ae_record_index].fSize;
 
+                // the end of a record, in the program bytes once the dropped ranges are left out.
+                if (std::string(command_header.Name).find(kLdDefineSymbol) == std::string::npos)
+                    command_header.Size = object_start + command_header.Size - dropped_size;
+
                 pef_command_hdrs.emplace_back(command_header);
             }
 
@@ -280,9 +594,31 @@ ld_mark_header:
             input_object.seekg(ae_header.fStartCode);
             input_object.read(bytes.data(), ae_header.fCodeSize);
 
-            for (auto& byte : bytes)
+            for (size_t byte_index = 0; byte_index < bytes.size(); ++byte_index)
+            {
+                bool dropped = std::any_of(dropped_ranges.begin(), dropped_ranges.end(), [&](auto& range) {
+                    return byte_index >= range.first && byte_index < range.second;
+                });
+
+                if (!dropped)
+                    kObjectBytes.push_back(bytes[byte_index]);
+            }
+
+            for (auto& [start, end] : ir_ranges)
             {
-                kObjectBytes.push_back(byte);
+                CxxKit::IRModule module;
+
+                if (end > bytes.size() ||
+                    !module.Read(std::string(bytes.begin() + start, bytes.begin() + end)))
+                {
+                    kStdOut << "ld: object " << i << " has IR of another version, rebuild it.\n";
+
+                    std::remove(kOutput.c_str());
+                    return -CXXKIT_EXEC_ERROR;
+                }
+
+                kModules.push_back(std::move(module));
+                kModuleArch = ae_header.fArch;
             }
 
             continue;  
@@ -483,6 +819,15 @@ ld_continue_search:
         return -CXXKIT_EXEC_ERROR;
     }
     
+    // the container tells how many command headers there are, the program bytes follow them.
+    auto headers_end = output_fc.tellp();
+
+    pef_container.Count = (size_t(headers_end) - pef_container.HdrSz) / sizeof(CxxKit::PEFCommandHeader);
+
+    output_fc.seekp(0);
+    output_fc << pef_container;
+    output_fc.seekp(headers_end);
+
     // step 2.5: write program bytes.
 
     for (auto byte : kObjectBytes)
@@ -22,9 +22,11 @@
 #include <C++Kit/ParserKit.hpp>
 #include <C++Kit/StdKit/PEF.hpp>
 #include <C++Kit/StdKit/AE.hpp>
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 /////////////////////
 
@@ -59,6 +61,7 @@ static std::string masm_check_line(std::string& line, const std::string& file);
 static void masm_check_export(std::string& line);
 static void masm_read_labels(std::string& line);
 static void masm_read_instr(std::string& line, const std::string& file);
+static bool masm_read_data(std::string& line, const std::string& file);
 
 namespace detail
 {
@@ -181,6 +184,10 @@ int main(int argc, char** argv)
 
             masm_check_export(line);
             masm_read_labels(line);
+
+            if (masm_read_data(line, argv[i]))
+                continue;
+
             masm_read_instr(line, argv[i]);
         }
 
@@ -404,6 +411,24 @@ namespace detail::algorithm
 
         return find_if(str.begin(), str.end(), is_not_alnum_space) == str.end();
     }
+
+    // \brief width in bytes of a data directive, zero if the line is not one.
+    SizeType data_width(const std::string &str)
+    {
+        auto first = str.find_first_not_of(" \t");
+
+        if (first == std::string::npos)
+            return 0;
+
+        auto word = str.substr(first, str.find_first_of(" \t", first) - first);
+
+        if (word == "byte") return 1;
+        if (word == "hword") return 2;
+        if (word == "dword") return 4;
+        if (word == "qword") return 8;
+
+        return 0;
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -437,6 +462,9 @@ static std::string masm_check_line(std::string& line, const std::string& file)
         return err_str;
     }
 
+    if (detail::algorithm::data_width(line) > 0)
+        return err_str;
+
     if (!detail::algorithm::is_valid(line))
     {
         err_str = "Line contains non alphanumeric characters.\nhere -> ";
@@ -490,7 +518,7 @@ static std::string masm_check_line(std::string& line, const std::string& file)
         }
     }
 
-    std::vector<std::string> opcodes_list = { "jb", "psh", "stw", "ldw", "lda" };
+    std::vector<std::string> opcodes_list = { "jb", "psh", "stw", "ldw", "lda", "stb", "ldb" };
 
     for (auto& opcodes : kOpcodesStd)
     {
@@ -552,6 +580,10 @@ namespace detail
 
 static bool masm_write_number(std::size_t pos, std::string& jump_label)
 {
+    // a label such as xbuf is not 0xbuf.
+    if (!isdigit(jump_label[pos]))
+        return false;
+
     switch (jump_label[pos+1])
     {
         case 'x':
@@ -704,13 +736,17 @@ static void masm_read_instr(std::string& line, const std::string& file)
                 name == "jb" ||
                 name == "stw" ||
                 name == "ldw" ||
-                name == "lda")
+                name == "lda" ||
+                name == "stb" ||
+                name == "ldb")
             {
                 auto where_string = name;
 
                 if (name == "stw" ||
                     name == "ldw" ||
-                    name == "lda")
+                    name == "lda" ||
+                    name == "stb" ||
+                    name == "ldb")
                     where_string = ",";
 
                 jump_label = line.substr(line.find(where_string) + where_string.size());
@@ -781,4 +817,72 @@ masm_write_label:
         }
     }
 
-}
\ No newline at end of file
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @brief Read a data directive (byte, hword, dword, qword) of a .data record.
+// Operands are comma separated numbers, a label operand is relocated by ld
+// the same way jb labels are.
+// @return true if the line was a data directive.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool masm_read_data(std::string& line, const std::string& file)
+{
+    auto width = detail::algorithm::data_width(line);
+
+    if (width == 0)
+        return false;
+
+    auto operands = line.substr(line.find_first_not_of(" \t"));
+    operands.erase(0, operands.find_first_of(" \t"));
+
+    std::stringstream operand_stream(operands);
+    std::string operand;
+
+    while (std::getline(operand_stream, operand, ','))
+    {
+        while (!operand.empty() &&
+               isspace(operand.front()))
+            operand.erase(0, 1);
+
+        while (!operand.empty() &&
+               isspace(operand.back()))
+            operand.pop_back();
+
+        if (operand.empty())
+        {
+            detail::print_error("data directive lacks a value.\nline: " + line, file);
+            continue;
+        }
+
+        if (isdigit(operand[0]))
+        {
+            detail::number_type num(strtoull(operand.c_str(), nullptr, 0));
+
+            for (SizeType i = 0; i < width; ++i)
+                kBytes.push_back(num.number[i]);
+
+            continue;
+        }
+
+        // a label, only a full word can hold an address.
+        if (width != sizeof(UInt64))
+        {
+            detail::print_error("only qword can hold a label.\nline: " + line, file);
+            continue;
+        }
+
+        auto mld_reloc_str = std::to_string(operand.size());
+        mld_reloc_str += ":mld_reloc:";
+        mld_reloc_str += operand;
+
+        for (auto& reloc_chr : mld_reloc_str)
+            kBytes.push_back(reloc_chr);
+
+        kBytes.push_back(0);
+    }
+
+    return true;
+}